@@ -19,6 +19,9 @@
 #include "Net/Core/PushModel/PushModel.h"
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "Settings/MounteaDialogueSystemSettings.h"
+#include "Subsystems/MounteaDialoguePrefetchSubsystem.h"
+#include "Subsystems/MounteaDialogueSessionRecorderSubsystem.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 
 UMounteaDialogueManager::UMounteaDialogueManager()
@@ -300,6 +303,42 @@ bool UMounteaDialogueManager::SetupEnvironmentDialogue(AActor* DialogueInitiator
 	return true;
 }
 
+bool UMounteaDialogueManager::SetupDialogueParticipants(AActor* DialogueInitiator, TSet<TScriptInterface<IMounteaDialogueParticipantInterface>>& DialogueParticipants, TArray<FText>& ErrorMessages)
+{
+	bool bSetupSuccess = false;
+	switch (DialogueManagerType)
+	{
+		case EDialogueManagerType::EDMT_PlayerDialogue:
+			bSetupSuccess = SetupPlayerDialogue(DialogueParticipants, ErrorMessages);
+			break;
+		case EDialogueManagerType::EDMT_EnvironmentDialogue:
+			bSetupSuccess = SetupEnvironmentDialogue(DialogueInitiator, DialogueParticipants, ErrorMessages);
+			break;
+		default:
+			ErrorMessages.Add(NSLOCTEXT("RequestStartDialogue", "WrongManager", "This Manager Type is not valid!"));
+			bSetupSuccess = false;
+			break;
+	}
+
+	for (const auto& dialogueParticipant : DialogueParticipants)
+	{
+		const UObject* dialogueParticipantObject = dialogueParticipant.GetObject();
+		if (!dialogueParticipantObject)
+		{
+			ErrorMessages.Add(NSLOCTEXT("RequestStartDialogue", "EmptyParticipant", "Dialogue Participant is not Valid!"));
+			bSetupSuccess = false;
+		}
+		else if (!dialogueParticipant->Execute_CanParticipateInDialogue(dialogueParticipantObject))
+		{
+			const FText message = FText::Format(NSLOCTEXT("RequestStartDialogue", "ParticipantCannotStart", "Dialogue Participant {0} cannot Participate in Dialogue!"), FText::FromString(dialogueParticipantObject->GetName()));
+			ErrorMessages.Add(message);
+			bSetupSuccess = false;
+		}
+	}
+
+	return bSetupSuccess;
+}
+
 bool UMounteaDialogueManager::ValidateMainParticipant(AActor* MainParticipant, TScriptInterface<IMounteaDialogueParticipantInterface>& OutParticipant, TArray<FText>& ErrorMessages)
 {
 	bool bFound = true;
@@ -521,6 +560,11 @@ void UMounteaDialogueManager::RequestStartDialogue_Implementation(AActor* Dialog
 	TArray<FText> errorMessages;
 	errorMessages.Add(FText::FromString("[Request Start Dialogue]"));
 
+	// Decorators are evaluated while Context is created, so Recording has to start before that
+	UMounteaDialogueSessionRecorderSubsystem* recorderSubsystem = IsAuthority() ? UMounteaDialogueSessionRecorderSubsystem::Get(this) : nullptr;
+	if (recorderSubsystem)
+		recorderSubsystem->BeginSession(this);
+
 	if (!DialogueInitiator)
 	{
 		errorMessages.Add(NSLOCTEXT("RequestStartDialogue", "MissingInitiator", "`DialogueInitiator` is not valid!"));
@@ -550,42 +594,16 @@ void UMounteaDialogueManager::RequestStartDialogue_Implementation(AActor* Dialog
 	else
 		bSatisfied = false;
 
-	bool bSetupSuccess = false;
-	switch (DialogueManagerType)
-	{
-		case EDialogueManagerType::EDMT_PlayerDialogue:
-			bSetupSuccess = SetupPlayerDialogue(dialogueParticipants, errorMessages);
-			break;
-		case EDialogueManagerType::EDMT_EnvironmentDialogue:
-			bSetupSuccess = SetupEnvironmentDialogue(DialogueInitiator, dialogueParticipants, errorMessages);
-			break;
-		default:
-			errorMessages.Add(NSLOCTEXT("RequestStartDialogue", "WrongManager", "This Manager Type is not valid!"));
-			bSetupSuccess = false;
-			break;
-	}
-	bSatisfied &= bSetupSuccess;
-
-	for (const auto& dialogueParticipant : dialogueParticipants)
-	{
-		const UObject* dialogueParticipantObject = dialogueParticipant.GetObject();
-		if (!dialogueParticipantObject)
-		{
-			errorMessages.Add(NSLOCTEXT("RequestStartDialogue", "EmptyParticipant", "Dialogue Participant is not Valid!"));
-			bSatisfied = false;
-		}
-		else if (!dialogueParticipant->Execute_CanParticipateInDialogue(dialogueParticipantObject))
-		{
-			const FText message = FText::Format(NSLOCTEXT("RequestStartDialogue", "ParticipantCannotStart", "Dialogue Participant {0} cannot Participate in Dialogue!"), FText::FromString(dialogueParticipantObject->GetName()));
-			errorMessages.Add(message);
-			bSatisfied = false;
-		}
-	}
+	bSatisfied &= SetupDialogueParticipants(DialogueInitiator, dialogueParticipants, errorMessages);
 
 	if (bSatisfied)
 	{
 		if (IsAuthority())
+		{
 			SetDialogueContext(UMounteaDialogueSystemBFC::CreateDialogueContext(this, mainParticipant, dialogueParticipants.Array()));
+			if (recorderSubsystem)
+				recorderSubsystem->SessionContextCreated(this, DialogueContext);
+		}
 		errorMessages.Add(NSLOCTEXT("RequestStartDialogue", "OK", "OK"));
 	}
 	const FText finalErrorMessage = FText::Join(FText::FromString("\n"), errorMessages);
@@ -593,6 +611,13 @@ void UMounteaDialogueManager::RequestStartDialogue_Implementation(AActor* Dialog
 	if (bSatisfied)
 	{
 		DialogueInstigator = DialogueInitiator;
+
+		// Stream in Dialogue Widget while Server processes the request
+		if (DialogueManagerType == EDialogueManagerType::EDMT_PlayerDialogue)
+		{
+			if (auto prefetchSubsystem = UMounteaDialoguePrefetchSubsystem::Get(this))
+				prefetchSubsystem->PrefetchWidgetClass(UMounteaDialogueSystemBFC::GetDialogueSystemSettings_Internal()->GetDefaultDialogueWidget());
+		}
 		
 		// Request Start on Server
 		switch (DialogueManagerType)
@@ -610,7 +635,11 @@ void UMounteaDialogueManager::RequestStartDialogue_Implementation(AActor* Dialog
 		OnDialogueStartRequestedResult.Broadcast(bSatisfied, finalErrorMessage.ToString());
 	}
 	else
+	{
+		if (recorderSubsystem)
+			recorderSubsystem->EndSession(this);
 		OnDialogueFailed.Broadcast(finalErrorMessage.ToString());
+	}
 }
 
 void UMounteaDialogueManager::RequestStartDialogue_Server_Implementation(AActor* DialogueInitiator,const FDialogueParticipants& InitialParticipants)
@@ -620,6 +649,9 @@ void UMounteaDialogueManager::RequestStartDialogue_Server_Implementation(AActor*
 
 void UMounteaDialogueManager::RequestCloseDialogue_Implementation()
 {
+	if (auto recorderSubsystem = UMounteaDialogueSessionRecorderSubsystem::Get(this))
+		recorderSubsystem->RecordInput(this, EMounteaDialogueRecordedInputType::CloseDialogue);
+	
 	if (IsAuthority())
 		SetManagerState(DefaultManagerState);
 	
@@ -734,6 +766,14 @@ void UMounteaDialogueManager::StartDialogue_Implementation()
 
 	if (!IsAuthority())
 		OnDialogueStarted.Broadcast(DialogueContext);
+
+	if (PendingSessionRestore.IsSet())
+	{
+		const FMounteaDialogueSessionSnapshot restoredSession = PendingSessionRestore.GetValue();
+		PendingSessionRestore.Reset();
+		ResumeDialogueSession(restoredSession);
+		return;
+	}
 	
 	Execute_PrepareNode(this);
 }
@@ -746,6 +786,22 @@ void UMounteaDialogueManager::CloseDialogue_Implementation()
 	
 	Execute_CleanupDialogue(this);
 
+	if (auto prefetchSubsystem = UMounteaDialoguePrefetchSubsystem::Get(this))
+		prefetchSubsystem->ReleaseSession(this);
+
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+		tickSubsystem->UnregisterSession(this);
+
+	if (auto recorderSubsystem = UMounteaDialogueSessionRecorderSubsystem::Get(this))
+		recorderSubsystem->EndSession(this);
+
+	if (IsValid(DialogueContext))
+	{
+		const FMounteaDialogueDecoratorCacheStats decoratorCacheStats = DialogueContext->GetDecoratorCacheStats();
+		if (decoratorCacheStats.Hits + decoratorCacheStats.Misses > 0)
+			LOG_INFO(TEXT("[Close Dialogue] Decorator Evaluation cache: %s"), *decoratorCacheStats.ToString())
+	}
+
 	SetDialogueContext(nullptr);
 	
 	if (!IsAuthority())
@@ -802,6 +858,9 @@ void UMounteaDialogueManager::NodePrepared_Implementation()
 	}
 	
 	DialogueContext->AddTraversedNode(DialogueContext->ActiveNode);
+
+	if (auto prefetchSubsystem = UMounteaDialoguePrefetchSubsystem::Get(this))
+		prefetchSubsystem->PrefetchUpcomingNodes(this, DialogueContext->ActiveNode);
 	
 	Execute_ProcessNode(this);
 }
@@ -834,7 +893,16 @@ void UMounteaDialogueManager::NodeProcessed_Implementation()
 		return;
 	}
 
-	DialogueContext->ActiveNode->Execute_UnregisterTick(DialogueContext->ActiveNode, DialogueContext->ActiveNode->Graph);
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		tickSubsystem->UnregisterTickable(this, DialogueContext->ActiveNode);
+		for (const auto& nodeDecorator : DialogueContext->ActiveNode->GetNodeDecorators())
+		{
+			tickSubsystem->UnregisterTickable(this, nodeDecorator.DecoratorType);
+		}
+	}
+	else
+		DialogueContext->ActiveNode->Execute_UnregisterTick(DialogueContext->ActiveNode, DialogueContext->ActiveNode->Graph);
 
 	// TODO: This is extremely similar to NodeSelected!
 	TArray<UMounteaDialogueGraphNode*> allowedChildrenNodes = UMounteaDialogueSystemBFC::GetAllowedChildNodes(DialogueContext->ActiveNode);
@@ -909,6 +977,9 @@ void UMounteaDialogueManager::SelectNode_Implementation(const FGuid& NodeGuid)
 		return;
 	}
 
+	if (auto recorderSubsystem = UMounteaDialogueSessionRecorderSubsystem::Get(this))
+		recorderSubsystem->RecordInput(this, EMounteaDialogueRecordedInputType::SelectNode, NodeGuid);
+
 	// Straight up set dialogue row from Node and index to 0
 	auto allowedChildNodes = UMounteaDialogueSystemBFC::GetAllowedChildNodes(selectedNode);
 	UMounteaDialogueSystemBFC::SortNodes(allowedChildNodes);
@@ -1067,6 +1138,9 @@ void UMounteaDialogueManager::SkipDialogueRow_Implementation()
 		return;
 	}
 	
+	if (auto recorderSubsystem = UMounteaDialogueSessionRecorderSubsystem::Get(this))
+		recorderSubsystem->RecordInput(this, EMounteaDialogueRecordedInputType::SkipRow);
+	
 	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_RowTimer);
 
 	DialogueContext->ActiveDialogueParticipant->Execute_SkipParticipantVoice(DialogueContext->ActiveDialogueParticipant.GetObject(), nullptr);
@@ -1074,6 +1148,219 @@ void UMounteaDialogueManager::SkipDialogueRow_Implementation()
 	Execute_DialogueRowProcessed(this, true);
 }
 
+bool UMounteaDialogueManager::CaptureDialogueSession(FMounteaDialogueSessionSnapshot& OutSnapshot) const
+{
+	OutSnapshot = FMounteaDialogueSessionSnapshot();
+
+	if (ManagerState != EDialogueManagerState::EDMS_Active || !UMounteaDialogueSystemBFC::IsContextValid(DialogueContext))
+	{
+		LOG_WARNING(TEXT("[Capture Dialogue Session] There is no active Dialogue to capture!"))
+		return false;
+	}
+
+	const UMounteaDialogueGraphNode* activeNode = DialogueContext->ActiveNode;
+	if (!IsValid(activeNode) || !IsValid(activeNode->Graph))
+	{
+		LOG_WARNING(TEXT("[Capture Dialogue Session] Active Node is not valid!"))
+		return false;
+	}
+
+	OutSnapshot.DialogueGraph = activeNode->Graph.Get();
+	OutSnapshot.ActiveNodeGuid = activeNode->GetNodeGUID();
+	OutSnapshot.PreviousActiveNodeGuid = DialogueContext->PreviousActiveNode;
+	OutSnapshot.ActiveDialogueRowDataIndex = DialogueContext->ActiveDialogueRowDataIndex;
+	OutSnapshot.TraversedPath = DialogueContext->TraversedPath;
+
+	for (const auto& allowedChildNode : DialogueContext->AllowedChildNodes)
+	{
+		if (IsValid(allowedChildNode))
+			OutSnapshot.AllowedChildNodeGuids.Add(allowedChildNode->GetNodeGUID());
+	}
+
+	const FTimerManager& timerManager = GetWorld()->GetTimerManager();
+	if (timerManager.IsTimerActive(TimerHandle_RowTimer))
+	{
+		OutSnapshot.SessionStage = EMounteaDialogueSessionStage::EMDSS_PlayingRow;
+		OutSnapshot.RowTimeRemaining = timerManager.GetTimerRemaining(TimerHandle_RowTimer);
+	}
+	else if (DialogueContext->LastWidgetCommand == MounteaDialogueWidgetCommands::AddDialogueOptions)
+		OutSnapshot.SessionStage = EMounteaDialogueSessionStage::EMDSS_AwaitingSelection;
+	else
+		OutSnapshot.SessionStage = EMounteaDialogueSessionStage::EMDSS_AwaitingInput;
+
+	if (const UObject* mainParticipant = DialogueContext->DialogueParticipant.GetObject())
+		OutSnapshot.MainParticipantTag = IMounteaDialogueParticipantInterface::Execute_GetParticipantTag(mainParticipant);
+	if (const UObject* activeParticipant = DialogueContext->ActiveDialogueParticipant.GetObject())
+		OutSnapshot.ActiveParticipantTag = IMounteaDialogueParticipantInterface::Execute_GetParticipantTag(activeParticipant);
+
+	return true;
+}
+
+bool UMounteaDialogueManager::RestoreDialogueSession(AActor* DialogueInitiator, const FDialogueParticipants& Participants, const FMounteaDialogueSessionSnapshot& Snapshot)
+{
+	if (!IsAuthority())
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] Dialogue session can be restored only by Authority!"))
+		return false;
+	}
+
+	// Dialogue pipeline runs where cosmetic events run, restored stage would be lost otherwise
+	if (!UMounteaDialogueSystemBFC::CanExecuteCosmeticEvents(GetWorld()))
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] Dialogue session cannot be restored on Dedicated Server!"))
+		return false;
+	}
+
+	// Remote Clients prepare Active Node on their own once Manager State replicates, which would run Node Decorators again
+	if (GetNetMode() != NM_Standalone)
+	{
+		int32 searchDepth = 0;
+		const APlayerController* playerController = UMounteaDialogueSystemBFC::FindPlayerController(GetOwner(), searchDepth);
+		if (!playerController || !playerController->IsLocalController())
+		{
+			LOG_WARNING(TEXT("[Restore Dialogue Session] Dialogue session can be restored only by locally controlled Manager!"))
+			return false;
+		}
+	}
+
+	if (ManagerState == EDialogueManagerState::EDMS_Active || !Execute_CanStartDialogue(this))
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] Manager cannot start Dialogue!"))
+		return false;
+	}
+
+	if (!Snapshot.IsValid())
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] Dialogue session snapshot is not valid!"))
+		return false;
+	}
+
+	UMounteaDialogueGraph* dialogueGraph = Snapshot.DialogueGraph.LoadSynchronous();
+	UMounteaDialogueGraphNode* activeNode = dialogueGraph ? dialogueGraph->FindNodeByGuid(Snapshot.ActiveNodeGuid) : nullptr;
+	if (!IsValid(activeNode))
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] Active Node %s no longer exists in Graph %s!"), *Snapshot.ActiveNodeGuid.ToString(), *Snapshot.DialogueGraph.ToString())
+		return false;
+	}
+
+	TArray<FText> errorMessages;
+	TScriptInterface<IMounteaDialogueParticipantInterface> mainParticipant;
+	TSet<TScriptInterface<IMounteaDialogueParticipantInterface>> dialogueParticipants;
+	if (!ValidateMainParticipant(Participants.MainParticipant, mainParticipant, errorMessages))
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] %s"), *FText::Join(FText::FromString(" "), errorMessages).ToString())
+		return false;
+	}
+	dialogueParticipants.Add(mainParticipant);
+	GatherOtherParticipants(Participants.OtherParticipants, dialogueParticipants);
+
+	if (mainParticipant->Execute_GetDialogueGraph(mainParticipant.GetObject()) != dialogueGraph)
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] Main Participant does not use Graph %s!"), *dialogueGraph->GetName())
+		return false;
+	}
+
+	if (Snapshot.MainParticipantTag.IsValid() && mainParticipant->Execute_GetParticipantTag(mainParticipant.GetObject()) != Snapshot.MainParticipantTag)
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] Main Participant is not %s, which was captured in the snapshot!"), *Snapshot.MainParticipantTag.ToString())
+		return false;
+	}
+
+	// Same setup as 'RequestStartDialogue', so Player Participant is part of restored Context
+	if (!SetupDialogueParticipants(DialogueInitiator, dialogueParticipants, errorMessages))
+	{
+		LOG_WARNING(TEXT("[Restore Dialogue Session] %s"), *FText::Join(FText::FromString(" "), errorMessages).ToString())
+		return false;
+	}
+
+	TArray<UMounteaDialogueGraphNode*> allowedChildNodes;
+	for (const FGuid& allowedChildNodeGuid : Snapshot.AllowedChildNodeGuids)
+	{
+		if (UMounteaDialogueGraphNode* allowedChildNode = dialogueGraph->FindNodeByGuid(allowedChildNodeGuid))
+			allowedChildNodes.Add(allowedChildNode);
+	}
+
+	const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>> restoredParticipants = dialogueParticipants.Array();
+
+	UMounteaDialogueContext* restoredContext = NewObject<UMounteaDialogueContext>(this);
+	restoredContext->SetDialogueContext(mainParticipant, activeNode, allowedChildNodes);
+	restoredContext->AddDialogueParticipants(restoredParticipants);
+
+	if (const auto activeDialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(activeNode))
+	{
+		FDataTableRowHandle activeDialogueTableHandle = FDataTableRowHandle();
+		activeDialogueTableHandle.DataTable = activeDialogueNode->GetDataTable();
+		activeDialogueTableHandle.RowName = activeDialogueNode->GetRowName();
+		restoredContext->UpdateActiveDialogueTable(activeDialogueTableHandle);
+	}
+	restoredContext->UpdateActiveDialogueRow(UMounteaDialogueSystemBFC::GetDialogueRow(activeNode));
+	restoredContext->UpdateActiveDialogueRowDataIndex(Snapshot.ActiveDialogueRowDataIndex);
+	restoredContext->TraversedPath = Snapshot.TraversedPath;
+	restoredContext->PreviousActiveNode = Snapshot.PreviousActiveNodeGuid;
+
+	const TScriptInterface<IMounteaDialogueParticipantInterface>* activeParticipant = restoredParticipants.FindByPredicate([&Snapshot](const TScriptInterface<IMounteaDialogueParticipantInterface>& Participant)
+	{
+		return Participant.GetObject() && Participant->Execute_GetParticipantTag(Participant.GetObject()) == Snapshot.ActiveParticipantTag;
+	});
+	if (activeParticipant)
+		restoredContext->SetActiveDialogueParticipant(*activeParticipant);
+	else
+		UMounteaDialogueSystemBFC::UpdateMatchingDialogueParticipant(restoredContext, UMounteaDialogueSystemBFC::SwitchActiveParticipant(restoredContext));
+
+	DialogueInstigator = DialogueInitiator;
+	SetDialogueContext(restoredContext);
+
+	PendingSessionRestore = Snapshot;
+	SetManagerState(EDialogueManagerState::EDMS_Active);
+
+	return true;
+}
+
+void UMounteaDialogueManager::ResumeDialogueSession(const FMounteaDialogueSessionSnapshot& Snapshot)
+{
+	if (!UMounteaDialogueSystemBFC::IsContextValid(DialogueContext) || !IsValid(DialogueContext->ActiveNode))
+	{
+		OnDialogueFailed.Broadcast(TEXT("[Resume Dialogue Session] Invalid Dialogue Context!"));
+		return;
+	}
+
+	DialogueContext->ActiveNode->RegisterNodeTickables(this);
+
+	if (auto prefetchSubsystem = UMounteaDialoguePrefetchSubsystem::Get(this))
+		prefetchSubsystem->PrefetchUpcomingNodes(this, DialogueContext->ActiveNode);
+
+	OnDialogueNodeStarted.Broadcast(DialogueContext);
+
+	FString resultMessage;
+	switch (Snapshot.SessionStage)
+	{
+		case EMounteaDialogueSessionStage::EMDSS_PlayingRow:
+		case EMounteaDialogueSessionStage::EMDSS_AwaitingInput:
+			{
+				if (!Execute_UpdateDialogueUI(this, resultMessage, MounteaDialogueWidgetCommands::ShowDialogueRow))
+					LOG_INFO(TEXT("[Resume Dialogue Session] UpdateUI Message: %s"), *resultMessage)
+
+				OnDialogueRowStarted.Broadcast(DialogueContext);
+
+				if (Snapshot.SessionStage == EMounteaDialogueSessionStage::EMDSS_PlayingRow)
+				{
+					FTimerDelegate Delegate;
+					Delegate.BindUObject(this, &UMounteaDialogueManager::DialogueRowProcessed_Implementation, false);
+					GetWorld()->GetTimerManager().SetTimer(TimerHandle_RowTimer, Delegate, FMath::Max(Snapshot.RowTimeRemaining, UE_KINDA_SMALL_NUMBER), false);
+				}
+			}
+			break;
+		case EMounteaDialogueSessionStage::EMDSS_AwaitingSelection:
+			if (!Execute_UpdateDialogueUI(this, resultMessage, MounteaDialogueWidgetCommands::AddDialogueOptions))
+				LOG_INFO(TEXT("[Resume Dialogue Session] UpdateUI Message: %s"), *resultMessage)
+			break;
+		case EMounteaDialogueSessionStage::Default:
+			break;
+	}
+
+	LOG_INFO(TEXT("[Resume Dialogue Session] Dialogue resumed at Node %s"), *DialogueContext->ActiveNode->GetNodeTitle().ToString())
+}
+
 void UMounteaDialogueManager::UpdateWorldDialogueUI_Implementation(const FString& Command)
 {
 	if (!IsAuthority())
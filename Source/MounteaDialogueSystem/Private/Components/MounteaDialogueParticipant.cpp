@@ -4,6 +4,7 @@
 #include "Components/MounteaDialogueParticipant.h"
 
 #include "Components/AudioComponent.h"
+#include "Data/MounteaDialogueSaveSerializer.h"
 #include "Graph/MounteaDialogueGraph.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Helpers/MounteaDialogueSystemBFC.h"
@@ -11,6 +12,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
 #include "Settings/MounteaDialogueSystemSettings.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 UMounteaDialogueParticipant::UMounteaDialogueParticipant()
 	: DefaultParticipantState(EDialogueParticipantState::EDPS_Enabled)
@@ -321,9 +323,57 @@ void UMounteaDialogueParticipant::SaveTraversedPath_Implementation(TArray<FDialo
 	}
 }
 
+void UMounteaDialogueParticipant::WriteDialogueSaveData(TArray<uint8>& OutSaveData) const
+{
+	FMounteaDialogueSaveState saveState;
+	saveState.TraversedPath = TraversedPath;
+	if (StartingNode && DialogueGraph)
+	{
+		saveState.StartingGraphGuid = DialogueGraph->GetGraphGUID();
+		saveState.StartingNodeGuid = StartingNode->GetNodeGUID();
+	}
+
+	FMounteaDialogueSaveSerializer::Write(saveState, OutSaveData);
+}
+
+bool UMounteaDialogueParticipant::ReadDialogueSaveData(const TArray<uint8>& SaveData)
+{
+	FMounteaDialogueSaveState saveState;
+	if (!FMounteaDialogueSaveSerializer::Read(SaveData, saveState))
+	{
+		LOG_ERROR(TEXT("[ReadDialogueSaveData] Participant %s failed to read Dialogue save data!"), *GetName())
+		return false;
+	}
+
+	FMounteaDialogueSaveSerializer::MigrateToGraph(saveState, DialogueGraph);
+
+	TraversedPath = MoveTemp(saveState.TraversedPath);
+
+	UMounteaDialogueGraphNode* savedStartingNode = nullptr;
+	if (DialogueGraph && saveState.StartingGraphGuid == DialogueGraph->GetGraphGUID())
+	{
+		savedStartingNode = DialogueGraph->FindNodeByGuid(saveState.StartingNodeGuid);
+	}
+
+	if (StartingNode != savedStartingNode)
+	{
+		StartingNode = savedStartingNode;
+		OnStartingNodeSaved.Broadcast(StartingNode);
+	}
+
+	return true;
+}
+
 void UMounteaDialogueParticipant::RegisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	SetComponentTickEnabled(true);
+	// Component Tick is only a fallback when Dialogue Tick Subsystem is not available
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		const UObject* tickSession = DialogueManager.GetObject() ? DialogueManager.GetObject() : this;
+		tickSubsystem->RegisterTickable(tickSession, this, nullptr, EMounteaDialogueTickGroup::EMDTG_Participant);
+	}
+	else
+		SetComponentTickEnabled(true);
 
 	if (auto dialogueGraph = Execute_GetDialogueGraph(this))
 		dialogueGraph->Execute_RegisterTick(dialogueGraph, this);
@@ -332,6 +382,9 @@ void UMounteaDialogueParticipant::RegisterTick_Implementation(const TScriptInter
 void UMounteaDialogueParticipant::UnregisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
 	SetComponentTickEnabled(false);
+
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+		tickSubsystem->UnregisterTickableFromParent(this, nullptr);
 	
 	if (auto parentGraph = Execute_GetDialogueGraph(this))
 		parentGraph->Execute_UnregisterTick(parentGraph, this);
@@ -67,10 +67,12 @@ void UMounteaDialogueContext::SetDialogueContext(const TScriptInterface<IMountea
 	
 	ActiveNode = NewActiveNode;
 	AllowedChildNodes = NewAllowedChildNodes;
+	DecoratorCache.InvalidateTraversal();
 
 	if (!DialogueParticipants.Contains(NewParticipant))
 	{
 		DialogueParticipants.Add(NewParticipant);
+		DecoratorCache.InvalidateParticipants();
 	}
 }
 
@@ -89,6 +91,7 @@ void UMounteaDialogueContext::UpdateActiveDialogueNode(UMounteaDialogueGraphNode
 	}
 	
 	ActiveNode = NewActiveNode;
+	DecoratorCache.InvalidateTraversal();
 
 	OnDialogueContextUpdated.Broadcast();
 }
@@ -156,6 +159,8 @@ void UMounteaDialogueContext::AddTraversedNode(const UMounteaDialogueGraphNode*
 		}
 		TraversedPath.Add(NewRow);
 	}
+
+	DecoratorCache.InvalidateTraversal();
 }
 
 bool UMounteaDialogueContext::AddDialogueParticipants(const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& NewParticipants)
@@ -178,6 +183,7 @@ bool UMounteaDialogueContext::AddDialogueParticipant(const TScriptInterface<IMou
 	}
 
 	DialogueParticipants.Add(NewParticipant);
+	DecoratorCache.InvalidateParticipants();
 	return true;
 }
 
@@ -198,6 +204,7 @@ bool UMounteaDialogueContext::RemoveDialogueParticipant(const TScriptInterface<I
 	if (DialogueParticipants.Contains(NewParticipant))
 	{
 		DialogueParticipants.Remove(NewParticipant);
+		DecoratorCache.InvalidateParticipants();
 		return true;
 	}
 
@@ -207,6 +214,17 @@ bool UMounteaDialogueContext::RemoveDialogueParticipant(const TScriptInterface<I
 void UMounteaDialogueContext::ClearDialogueParticipants()
 {
 	DialogueParticipants.Empty();
+	DecoratorCache.InvalidateParticipants();
+}
+
+void UMounteaDialogueContext::InvalidateDecoratorCacheKey(const FGameplayTag& Key)
+{
+	DecoratorCache.InvalidateTag(Key);
+}
+
+void UMounteaDialogueContext::ClearDecoratorCache()
+{
+	DecoratorCache.Reset();
 }
 
 void UMounteaDialogueContext::SetDialogueContextBP(const TScriptInterface<IMounteaDialogueParticipantInterface> NewParticipant, UMounteaDialogueGraphNode* NewActiveNode,TArray<UMounteaDialogueGraphNode*> NewAllowedChildNodes)
@@ -350,6 +368,10 @@ UMounteaDialogueContext* UMounteaDialogueContext::operator += (const UMounteaDia
 		ActiveDialogueRowDataIndex = Other->ActiveDialogueRowDataIndex;
 	if (Other->LastWidgetCommand != LastWidgetCommand)
 		LastWidgetCommand = Other->LastWidgetCommand;
+
+	// Synced state might differ in anything Decorators depend on
+	DecoratorCache.InvalidateTraversal();
+	DecoratorCache.InvalidateParticipants();
 	
 	return this;
 }
@@ -389,6 +411,9 @@ UMounteaDialogueContext* UMounteaDialogueContext::operator += (const FMounteaDia
 		const FDialogueRow selectedRow = dialogueNode ? UMounteaDialogueSystemBFC::GetDialogueRow(ActiveDialogueTableHandle.DataTable,ActiveDialogueTableHandle.RowName) : FDialogueRow::Invalid();
 		if (dialogueNode)
 			ActiveDialogueRow = selectedRow.IsValid() ? selectedRow : UMounteaDialogueSystemBFC::GetDialogueRow(ActiveNode);
+
+		DecoratorCache.InvalidateTraversal();
+		DecoratorCache.InvalidateParticipants();
 	}
 
 	return this;
@@ -0,0 +1,51 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Data/MounteaDialogueContextSnapshot.h"
+
+#include "Data/MounteaDialogueContext.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+
+FMounteaDialogueContextSnapshot::FMounteaDialogueContextSnapshot(const UMounteaDialogueContext* Context)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(Context))
+		return;
+
+	bIsValid = true;
+
+	if (const UMounteaDialogueGraphNode* ActiveNode = Context->ActiveNode)
+	{
+		ActiveNodeGuid = ActiveNode->GetNodeGUID();
+		if (ActiveNode->Graph)
+		{
+			ActiveGraphGuid = ActiveNode->Graph->GetGraphGUID();
+		}
+	}
+
+	PreviousActiveNodeGuid = Context->PreviousActiveNode;
+	ActiveDialogueRowDataIndex = Context->ActiveDialogueRowDataIndex;
+
+	for (const auto& Participant : Context->DialogueParticipants)
+	{
+		if (UObject* ParticipantObject = Participant.GetObject())
+		{
+			ParticipantTags.AddTag(IMounteaDialogueParticipantInterface::Execute_GetParticipantTag(ParticipantObject));
+		}
+	}
+
+	TraverseCounts.Reserve(Context->TraversedPath.Num());
+	for (const FDialogueTraversePath& Path : Context->TraversedPath)
+	{
+		TraverseCounts.FindOrAdd(TPair<FGuid, FGuid>(Path.NodeGuid, Path.GraphGuid)) += Path.TraverseCount;
+	}
+}
+
+int32 FMounteaDialogueContextSnapshot::GetTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const
+{
+	const int32* Count = TraverseCounts.Find(TPair<FGuid, FGuid>(NodeGuid, GraphGuid));
+	return Count ? *Count : 0;
+}
@@ -0,0 +1,100 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Data/MounteaDialogueDecoratorCache.h"
+
+bool FMounteaDialogueDecoratorCache::EvaluateDecorator(UMounteaDialogueDecoratorBase* Decorator)
+{
+	if (!Decorator)
+	{
+		return false;
+	}
+
+	FCachedEvaluation* Evaluation = Evaluations.Find(Decorator);
+	if (!Evaluation)
+	{
+		// Dependencies are declared once per session, so Blueprint Decorators are not asked on every Evaluation
+		const FMounteaDialogueDecoratorDependencies Dependencies = Decorator->GetEvaluationDependencies();
+		Evaluation = &Evaluations.Add(Decorator);
+		Evaluation->Dependencies = Dependencies;
+
+		if (Dependencies.bCacheable)
+		{
+			Stats.CachedDecorators++;
+		}
+	}
+
+	if (!Evaluation->Dependencies.bCacheable)
+	{
+		return Decorator->EvaluateDecorator();
+	}
+
+	const uint64 CurrentEpoch = GetDependenciesEpoch(Evaluation->Dependencies);
+	if (Evaluation->bHasResult && Evaluation->Epoch == CurrentEpoch)
+	{
+		Stats.Hits++;
+		return Evaluation->bResult;
+	}
+
+	Stats.Misses++;
+	const bool bResult = Decorator->EvaluateDecorator();
+
+	// Evaluation might have evaluated other Decorators and reallocated the map
+	if (FCachedEvaluation* StoredEvaluation = Evaluations.Find(Decorator))
+	{
+		StoredEvaluation->Epoch = CurrentEpoch;
+		StoredEvaluation->bHasResult = true;
+		StoredEvaluation->bResult = bResult;
+	}
+
+	return bResult;
+}
+
+void FMounteaDialogueDecoratorCache::InvalidateTag(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid())
+	{
+		return;
+	}
+
+	// Parents contain the Tag itself
+	for (const FGameplayTag& Itr : Tag.GetGameplayTagParents())
+	{
+		TagEpochs.FindOrAdd(Itr)++;
+	}
+}
+
+void FMounteaDialogueDecoratorCache::Reset()
+{
+	Evaluations.Empty();
+	TagEpochs.Empty();
+	TraversalEpoch = 0;
+	ParticipantsEpoch = 0;
+	Stats.CachedDecorators = 0;
+}
+
+uint64 FMounteaDialogueDecoratorCache::GetDependenciesEpoch(const FMounteaDialogueDecoratorDependencies& Dependencies) const
+{
+	// Epochs only grow, so their sum changes whenever any dependency is invalidated
+	uint64 Epoch = 0;
+
+	if (Dependencies.bDependsOnTraversal)
+	{
+		Epoch += TraversalEpoch;
+	}
+
+	if (Dependencies.bDependsOnParticipants)
+	{
+		Epoch += ParticipantsEpoch;
+	}
+
+	for (const FGameplayTag& Itr : Dependencies.DependencyTags)
+	{
+		if (const uint32* TagEpoch = TagEpochs.Find(Itr))
+		{
+			Epoch += *TagEpoch;
+		}
+	}
+
+	return Epoch;
+}
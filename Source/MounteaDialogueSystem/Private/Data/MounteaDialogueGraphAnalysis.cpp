@@ -0,0 +1,377 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Data/MounteaDialogueGraphAnalysis.h"
+
+#include "Algo/BinarySearch.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
+
+namespace MounteaDialogueGraphAnalysis
+{
+	// Successors of each Node, including 'Return To Node' jumps
+	TArray<TArray<int32>> BuildSuccessors(const TArray<UMounteaDialogueGraphNode*>& Nodes)
+	{
+		TMap<const UMounteaDialogueGraphNode*, int32> nodeIndices;
+		nodeIndices.Reserve(Nodes.Num());
+		for (int32 i = 0; i < Nodes.Num(); i++)
+		{
+			if (Nodes[i])
+				nodeIndices.Add(Nodes[i], i);
+		}
+
+		TArray<TArray<int32>> successors;
+		successors.SetNum(Nodes.Num());
+		for (int32 i = 0; i < Nodes.Num(); i++)
+		{
+			if (!Nodes[i])
+				continue;
+
+			TArray<const UMounteaDialogueGraphNode*> targets(Nodes[i]->ChildrenNodes);
+			if (const UMounteaDialogueGraphNode_ReturnToNode* returnNode = Cast<UMounteaDialogueGraphNode_ReturnToNode>(Nodes[i]))
+			{
+				targets.Add(returnNode->SelectedNode);
+			}
+
+			for (const UMounteaDialogueGraphNode* target : targets)
+			{
+				if (const int32* targetIndex = nodeIndices.Find(target))
+				{
+					successors[i].AddUnique(*targetIndex);
+				}
+			}
+		}
+
+		return successors;
+	}
+
+	uint32 HashEdges(const TArray<TArray<int32>>& Successors, const int32 StartIndex)
+	{
+		uint32 edgesHash = GetTypeHash(StartIndex);
+		for (int32 i = 0; i < Successors.Num(); i++)
+		{
+			edgesHash = HashCombine(edgesHash, GetTypeHash(Successors[i].Num()));
+			for (const int32 successor : Successors[i])
+			{
+				edgesHash = HashCombine(edgesHash, GetTypeHash(successor));
+			}
+		}
+		return edgesHash;
+	}
+
+	// Tarjan's algorithm without recursion, components are found in reverse topological order
+	int32 FindComponents(const TArray<TArray<int32>>& Successors, TArray<int32>& OutComponents, TArray<int32>& OutCyclicComponents)
+	{
+		const int32 nodesNum = Successors.Num();
+		TArray<int32> discovery, lowLink, nodeStack;
+		TArray<bool> onStack;
+		discovery.Init(INDEX_NONE, nodesNum);
+		lowLink.Init(INDEX_NONE, nodesNum);
+		onStack.Init(false, nodesNum);
+		OutComponents.Init(INDEX_NONE, nodesNum);
+
+		// Node x next Successor to visit
+		TArray<TPair<int32, int32>> callStack;
+		int32 discoveryCounter = 0;
+		int32 componentsNum = 0;
+
+		auto visitNode = [&](const int32 Node)
+		{
+			discovery[Node] = lowLink[Node] = discoveryCounter++;
+			nodeStack.Push(Node);
+			onStack[Node] = true;
+			callStack.Emplace(Node, 0);
+		};
+
+		for (int32 root = 0; root < nodesNum; root++)
+		{
+			if (discovery[root] != INDEX_NONE)
+				continue;
+
+			visitNode(root);
+			while (callStack.Num() > 0)
+			{
+				const int32 node = callStack.Last().Key;
+				if (callStack.Last().Value < Successors[node].Num())
+				{
+					const int32 successor = Successors[node][callStack.Last().Value++];
+					if (discovery[successor] == INDEX_NONE)
+					{
+						visitNode(successor);
+					}
+					else if (onStack[successor])
+					{
+						lowLink[node] = FMath::Min(lowLink[node], discovery[successor]);
+					}
+					continue;
+				}
+
+				callStack.Pop(EAllowShrinking::No);
+				if (callStack.Num() > 0)
+				{
+					const int32 parent = callStack.Last().Key;
+					lowLink[parent] = FMath::Min(lowLink[parent], lowLink[node]);
+				}
+
+				if (lowLink[node] != discovery[node])
+					continue;
+
+				int32 componentSize = 0;
+				int32 member = INDEX_NONE;
+				do
+				{
+					member = nodeStack.Pop(EAllowShrinking::No);
+					onStack[member] = false;
+					OutComponents[member] = componentsNum;
+					componentSize++;
+				}
+				while (member != node);
+
+				if (componentSize > 1 || Successors[node].Contains(node))
+				{
+					OutCyclicComponents.Add(componentsNum);
+				}
+				componentsNum++;
+			}
+		}
+
+		return componentsNum;
+	}
+
+	// Cooper, Harvey and Kennedy iterative dominator algorithm
+	void FindDominators(const TArray<TArray<int32>>& Successors, const int32 StartIndex, TArray<int32>& OutDominators)
+	{
+		const int32 nodesNum = Successors.Num();
+		OutDominators.Init(INDEX_NONE, nodesNum);
+		if (!Successors.IsValidIndex(StartIndex))
+			return;
+
+		// Postorder of Nodes reachable from Start Node
+		TArray<int32> postorder, postorderIndex;
+		postorderIndex.Init(INDEX_NONE, nodesNum);
+		TArray<bool> visited;
+		visited.Init(false, nodesNum);
+
+		TArray<TPair<int32, int32>> callStack;
+		callStack.Emplace(StartIndex, 0);
+		visited[StartIndex] = true;
+		while (callStack.Num() > 0)
+		{
+			const int32 node = callStack.Last().Key;
+			if (callStack.Last().Value < Successors[node].Num())
+			{
+				const int32 successor = Successors[node][callStack.Last().Value++];
+				if (!visited[successor])
+				{
+					visited[successor] = true;
+					callStack.Emplace(successor, 0);
+				}
+				continue;
+			}
+
+			callStack.Pop(EAllowShrinking::No);
+			postorderIndex[node] = postorder.Add(node);
+		}
+
+		TArray<TArray<int32>> predecessors;
+		predecessors.SetNum(nodesNum);
+		for (const int32 node : postorder)
+		{
+			for (const int32 successor : Successors[node])
+			{
+				predecessors[successor].Add(node);
+			}
+		}
+
+		auto intersect = [&](int32 A, int32 B)
+		{
+			while (A != B)
+			{
+				while (postorderIndex[A] < postorderIndex[B]) A = OutDominators[A];
+				while (postorderIndex[B] < postorderIndex[A]) B = OutDominators[B];
+			}
+			return A;
+		};
+
+		OutDominators[StartIndex] = StartIndex;
+		bool bChanged = true;
+		while (bChanged)
+		{
+			bChanged = false;
+			for (int32 i = postorder.Num() - 1; i >= 0; i--)
+			{
+				const int32 node = postorder[i];
+				if (node == StartIndex)
+					continue;
+
+				int32 newDominator = INDEX_NONE;
+				for (const int32 predecessor : predecessors[node])
+				{
+					if (OutDominators[predecessor] == INDEX_NONE)
+						continue;
+
+					newDominator = newDominator == INDEX_NONE ? predecessor : intersect(predecessor, newDominator);
+				}
+
+				if (OutDominators[node] != newDominator)
+				{
+					OutDominators[node] = newDominator;
+					bChanged = true;
+				}
+			}
+		}
+
+		OutDominators[StartIndex] = INDEX_NONE;
+	}
+}
+
+FMounteaDialogueGraphAnalysis FMounteaDialogueGraphAnalysis::Analyze(const UMounteaDialogueGraph* Graph)
+{
+	FMounteaDialogueGraphAnalysis analysis;
+	if (!Graph)
+		return analysis;
+
+	const TArray<UMounteaDialogueGraphNode*> allNodes = Graph->GetAllNodes();
+	const int32 nodesNum = allNodes.Num();
+
+	analysis.NodeGuids.Reserve(nodesNum);
+	for (const UMounteaDialogueGraphNode* node : allNodes)
+	{
+		analysis.NodeGuids.Add(node ? node->GetNodeGUID() : FGuid());
+	}
+
+	const TArray<TArray<int32>> successors = MounteaDialogueGraphAnalysis::BuildSuccessors(allNodes);
+	const int32 startIndex = allNodes.IndexOfByKey(Graph->GetStartNode());
+	analysis.EdgesHash = MounteaDialogueGraphAnalysis::HashEdges(successors, startIndex);
+
+	// Reachability and shortest depth
+	analysis.Depths.Init(INDEX_NONE, nodesNum);
+	if (startIndex != INDEX_NONE)
+	{
+		TArray<int32> queue = { startIndex };
+		analysis.Depths[startIndex] = 0;
+		for (int32 queueIndex = 0; queueIndex < queue.Num(); queueIndex++)
+		{
+			const int32 node = queue[queueIndex];
+			for (const int32 successor : successors[node])
+			{
+				if (analysis.Depths[successor] != INDEX_NONE)
+					continue;
+
+				analysis.Depths[successor] = analysis.Depths[node] + 1;
+				queue.Add(successor);
+			}
+		}
+	}
+
+	// Cycles and remaining depth over condensed Graph
+	const int32 componentsNum = MounteaDialogueGraphAnalysis::FindComponents(successors, analysis.Components, analysis.CyclicComponents);
+	analysis.CyclicComponents.Sort();
+
+	TArray<TArray<int32>> componentNodes;
+	componentNodes.SetNum(componentsNum);
+	for (int32 i = 0; i < nodesNum; i++)
+	{
+		componentNodes[analysis.Components[i]].Add(i);
+	}
+
+	// Components are in reverse topological order, so all successors are resolved already
+	TArray<int32> componentDepths;
+	componentDepths.Init(0, componentsNum);
+	for (int32 component = 0; component < componentsNum; component++)
+	{
+		for (const int32 node : componentNodes[component])
+		{
+			for (const int32 successor : successors[node])
+			{
+				const int32 successorComponent = analysis.Components[successor];
+				if (successorComponent != component)
+				{
+					componentDepths[component] = FMath::Max(componentDepths[component], componentDepths[successorComponent] + 1);
+				}
+			}
+		}
+	}
+
+	analysis.RemainingDepths.SetNum(nodesNum);
+	for (int32 i = 0; i < nodesNum; i++)
+	{
+		analysis.RemainingDepths[i] = componentDepths[analysis.Components[i]];
+	}
+	analysis.MaxDepth = startIndex != INDEX_NONE ? analysis.RemainingDepths[startIndex] : 0;
+
+	MounteaDialogueGraphAnalysis::FindDominators(successors, startIndex, analysis.ImmediateDominators);
+
+	analysis.BuildLookup();
+	return analysis;
+}
+
+bool FMounteaDialogueGraphAnalysis::IsUpToDate(const UMounteaDialogueGraph* Graph) const
+{
+	if (!Graph || Graph->AllNodes.Num() != NodeGuids.Num())
+		return false;
+
+	for (int32 i = 0; i < NodeGuids.Num(); i++)
+	{
+		const UMounteaDialogueGraphNode* node = Graph->AllNodes[i];
+		if ((node ? node->GetNodeGUID() : FGuid()) != NodeGuids[i])
+			return false;
+	}
+
+	// Edges could be rewired without adding or removing any Node
+	const TArray<UMounteaDialogueGraphNode*> allNodes = Graph->GetAllNodes();
+	const int32 startIndex = allNodes.IndexOfByKey(Graph->GetStartNode());
+	return MounteaDialogueGraphAnalysis::HashEdges(MounteaDialogueGraphAnalysis::BuildSuccessors(allNodes), startIndex) == EdgesHash;
+}
+
+void FMounteaDialogueGraphAnalysis::BuildLookup()
+{
+	NodeIndices.Reset();
+	NodeIndices.Reserve(NodeGuids.Num());
+	for (int32 i = 0; i < NodeGuids.Num(); i++)
+	{
+		NodeIndices.Add(NodeGuids[i], i);
+	}
+}
+
+int32 FMounteaDialogueGraphAnalysis::FindNodeIndex(const FGuid& NodeGuid) const
+{
+	const int32* nodeIndex = NodeIndices.Find(NodeGuid);
+	return nodeIndex ? *nodeIndex : INDEX_NONE;
+}
+
+bool FMounteaDialogueGraphAnalysis::IsInCycle(const int32 NodeIndex) const
+{
+	return Components.IsValidIndex(NodeIndex) && Algo::BinarySearch(CyclicComponents, Components[NodeIndex]) != INDEX_NONE;
+}
+
+bool FMounteaDialogueGraphAnalysis::Dominates(const int32 DominatorIndex, const int32 NodeIndex) const
+{
+	if (!IsReachable(DominatorIndex) || !IsReachable(NodeIndex))
+		return false;
+
+	for (int32 node = NodeIndex; node != INDEX_NONE; node = ImmediateDominators[node])
+	{
+		if (node == DominatorIndex)
+			return true;
+	}
+
+	return false;
+}
+
+TArray<FGuid> FMounteaDialogueGraphAnalysis::GetDeadNodes() const
+{
+	TArray<FGuid> deadNodes;
+	for (int32 i = 0; i < NodeGuids.Num(); i++)
+	{
+		if (!IsReachable(i) && NodeGuids[i].IsValid())
+			deadNodes.Add(NodeGuids[i]);
+	}
+	return deadNodes;
+}
+
+FString FMounteaDialogueGraphAnalysis::ToString() const
+{
+	return FString::Printf(TEXT("Nodes: %d | Dead Nodes: %d | Cycles: %d | Max Depth: %d"),
+		NodeGuids.Num(), GetDeadNodes().Num(), CyclicComponents.Num(), MaxDepth);
+}
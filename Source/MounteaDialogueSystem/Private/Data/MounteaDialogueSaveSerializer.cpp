@@ -0,0 +1,251 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Data/MounteaDialogueSaveSerializer.h"
+
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace MounteaDialogueSave
+{
+	struct FGraphRecord
+	{
+		uint8 Flags = FMounteaDialogueSaveSerializer::GF_None;
+		TArray<FGuid> NodeTable;
+		TMap<FGuid, uint32> NodeIndices;
+		// Node index x Traverse Count
+		TArray<TPair<uint32, uint32>> TraverseCounts;
+		uint32 StartingNodeIndex = 0;
+
+		uint32 AddNode(const FGuid& NodeGuid)
+		{
+			if (const uint32* nodeIndex = NodeIndices.Find(NodeGuid))
+				return *nodeIndex;
+
+			const uint32 nodeIndex = NodeTable.Add(NodeGuid);
+			NodeIndices.Add(NodeGuid, nodeIndex);
+			return nodeIndex;
+		}
+	};
+
+	bool HasBytesLeft(const FArchive& Ar, const int64 Bytes)
+	{
+		return !Ar.IsError() && Ar.TotalSize() - Ar.Tell() >= Bytes;
+	}
+
+	bool ReadInitial(FArchive& Ar, FMounteaDialogueSaveState& OutState)
+	{
+		uint32 graphsNum = 0;
+		Ar.SerializeIntPacked(graphsNum);
+
+		// Each Graph record takes at least GUID, Flags and two packed counts
+		if (!HasBytesLeft(Ar, static_cast<int64>(graphsNum) * (sizeof(FGuid) + 3)))
+			return false;
+
+		for (uint32 graphIndex = 0; graphIndex < graphsNum; graphIndex++)
+		{
+			FGuid graphGuid;
+			uint8 flags = 0;
+			Ar << graphGuid;
+			Ar << flags;
+
+			uint32 nodesNum = 0;
+			Ar.SerializeIntPacked(nodesNum);
+			if (!HasBytesLeft(Ar, static_cast<int64>(nodesNum) * sizeof(FGuid)))
+				return false;
+
+			TArray<FGuid> nodeTable;
+			nodeTable.SetNumUninitialized(nodesNum);
+			for (FGuid& nodeGuid : nodeTable)
+			{
+				Ar << nodeGuid;
+			}
+
+			uint32 traversedNum = 0;
+			Ar.SerializeIntPacked(traversedNum);
+			if (!HasBytesLeft(Ar, static_cast<int64>(traversedNum) * 2))
+				return false;
+
+			OutState.TraversedPath.Reserve(OutState.TraversedPath.Num() + traversedNum);
+			for (uint32 i = 0; i < traversedNum; i++)
+			{
+				uint32 nodeIndex = 0;
+				uint32 traverseCount = 0;
+				Ar.SerializeIntPacked(nodeIndex);
+				Ar.SerializeIntPacked(traverseCount);
+				if (!nodeTable.IsValidIndex(nodeIndex))
+					return false;
+
+				OutState.TraversedPath.Add(FDialogueTraversePath(nodeTable[nodeIndex], graphGuid, static_cast<int32>(FMath::Min<uint32>(traverseCount, MAX_int32))));
+			}
+
+			if (flags & FMounteaDialogueSaveSerializer::GF_HasStartingNode)
+			{
+				uint32 nodeIndex = 0;
+				Ar.SerializeIntPacked(nodeIndex);
+				if (!nodeTable.IsValidIndex(nodeIndex))
+					return false;
+
+				OutState.StartingGraphGuid = graphGuid;
+				OutState.StartingNodeGuid = nodeTable[nodeIndex];
+			}
+
+			if (Ar.IsError())
+				return false;
+		}
+
+		return true;
+	}
+}
+
+void FMounteaDialogueSaveSerializer::Write(const FMounteaDialogueSaveState& State, TArray<uint8>& OutBytes)
+{
+	// Graph records keep order of first appearance, so equal states produce equal bytes
+	TArray<FGuid> graphOrder;
+	TMap<FGuid, MounteaDialogueSave::FGraphRecord> graphRecords;
+
+	auto findOrAddRecord = [&](const FGuid& GraphGuid) -> MounteaDialogueSave::FGraphRecord&
+	{
+		if (MounteaDialogueSave::FGraphRecord* graphRecord = graphRecords.Find(GraphGuid))
+			return *graphRecord;
+
+		graphOrder.Add(GraphGuid);
+		return graphRecords.Add(GraphGuid);
+	};
+
+	for (const FDialogueTraversePath& traversedNode : State.TraversedPath)
+	{
+		if (traversedNode.TraverseCount <= 0)
+			continue;
+
+		MounteaDialogueSave::FGraphRecord& graphRecord = findOrAddRecord(traversedNode.GraphGuid);
+		graphRecord.TraverseCounts.Emplace(graphRecord.AddNode(traversedNode.NodeGuid), static_cast<uint32>(traversedNode.TraverseCount));
+	}
+
+	if (State.StartingGraphGuid.IsValid() && State.StartingNodeGuid.IsValid())
+	{
+		MounteaDialogueSave::FGraphRecord& graphRecord = findOrAddRecord(State.StartingGraphGuid);
+		graphRecord.Flags |= GF_HasStartingNode;
+		graphRecord.StartingNodeIndex = graphRecord.AddNode(State.StartingNodeGuid);
+	}
+
+	OutBytes.Reset();
+	FMemoryWriter Ar(OutBytes);
+
+	uint32 magic = Magic;
+	uint16 version = static_cast<uint16>(EMounteaDialogueSaveVersion::Latest);
+	Ar << magic;
+	Ar << version;
+
+	uint32 graphsNum = graphOrder.Num();
+	Ar.SerializeIntPacked(graphsNum);
+	for (FGuid& graphGuid : graphOrder)
+	{
+		MounteaDialogueSave::FGraphRecord& graphRecord = graphRecords[graphGuid];
+		Ar << graphGuid;
+		Ar << graphRecord.Flags;
+
+		uint32 nodesNum = graphRecord.NodeTable.Num();
+		Ar.SerializeIntPacked(nodesNum);
+		for (FGuid& nodeGuid : graphRecord.NodeTable)
+		{
+			Ar << nodeGuid;
+		}
+
+		uint32 traversedNum = graphRecord.TraverseCounts.Num();
+		Ar.SerializeIntPacked(traversedNum);
+		for (TPair<uint32, uint32>& traverseCount : graphRecord.TraverseCounts)
+		{
+			Ar.SerializeIntPacked(traverseCount.Key);
+			Ar.SerializeIntPacked(traverseCount.Value);
+		}
+
+		if (graphRecord.Flags & GF_HasStartingNode)
+		{
+			Ar.SerializeIntPacked(graphRecord.StartingNodeIndex);
+		}
+	}
+}
+
+bool FMounteaDialogueSaveSerializer::Read(const TArray<uint8>& Bytes, FMounteaDialogueSaveState& OutState)
+{
+	OutState = FMounteaDialogueSaveState();
+
+	FMemoryReader Ar(Bytes);
+
+	uint32 magic = 0;
+	uint16 version = 0;
+	if (!MounteaDialogueSave::HasBytesLeft(Ar, sizeof(magic) + sizeof(version)))
+	{
+		LOG_ERROR(TEXT("[Read Dialogue Save] Save data are too short!"))
+		return false;
+	}
+
+	Ar << magic;
+	Ar << version;
+	if (magic != Magic)
+	{
+		LOG_ERROR(TEXT("[Read Dialogue Save] Save data are not Mountea Dialogue save!"))
+		return false;
+	}
+
+	bool bSuccess = false;
+	switch (static_cast<EMounteaDialogueSaveVersion>(version))
+	{
+		case EMounteaDialogueSaveVersion::Initial:
+			bSuccess = MounteaDialogueSave::ReadInitial(Ar, OutState);
+			break;
+		default:
+			LOG_ERROR(TEXT("[Read Dialogue Save] Unsupported save version %d, latest supported is %d!"), version, static_cast<int32>(EMounteaDialogueSaveVersion::Latest))
+			return false;
+	}
+
+	if (!bSuccess || Ar.IsError())
+	{
+		LOG_ERROR(TEXT("[Read Dialogue Save] Save data are corrupted!"))
+		OutState = FMounteaDialogueSaveState();
+		return false;
+	}
+
+	return true;
+}
+
+int32 FMounteaDialogueSaveSerializer::MigrateToGraph(FMounteaDialogueSaveState& State, UMounteaDialogueGraph* Graph)
+{
+	if (!Graph)
+		return 0;
+
+	const FGuid graphGuid = Graph->GetGraphGUID();
+
+	TSet<FGuid> graphNodes;
+	graphNodes.Reserve(Graph->AllNodes.Num() + 1);
+	for (const UMounteaDialogueGraphNode* graphNode : Graph->AllNodes)
+	{
+		if (graphNode)
+			graphNodes.Add(graphNode->GetNodeGUID());
+	}
+	if (const UMounteaDialogueGraphNode* startNode = Graph->GetStartNode())
+	{
+		graphNodes.Add(startNode->GetNodeGUID());
+	}
+
+	int32 droppedEntries = State.TraversedPath.RemoveAll([&graphGuid, &graphNodes](const FDialogueTraversePath& Path)
+	{
+		return Path.GraphGuid == graphGuid && !graphNodes.Contains(Path.NodeGuid);
+	});
+
+	if (State.StartingGraphGuid == graphGuid && !graphNodes.Contains(State.StartingNodeGuid))
+	{
+		State.StartingGraphGuid.Invalidate();
+		State.StartingNodeGuid.Invalidate();
+		droppedEntries++;
+	}
+
+	if (droppedEntries > 0)
+	{
+		LOG_WARNING(TEXT("[Migrate Dialogue Save] Dropped %d entries of Nodes which no longer exist in Graph %s"), droppedEntries, *Graph->GetName())
+	}
+
+	return droppedEntries;
+}
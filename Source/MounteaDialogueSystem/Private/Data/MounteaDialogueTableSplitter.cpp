@@ -0,0 +1,220 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Data/MounteaDialogueTableSplitter.h"
+
+#if WITH_EDITOR
+
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Engine/DataTable.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Internationalization/TextPackageNamespaceUtil.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+REGISTER_COOKPACKAGE_SPLITTER(FMounteaDialogueTableSplitter, UMounteaDialogueGraph);
+
+namespace MounteaDialogueTableSplit
+{
+	// Name of property which pairs Data Table reference with referenced Row
+	const FName RowNamePropertyName = TEXT("RowName");
+
+	struct FTableUsage
+	{
+		TArray<TPair<UObject*, const FObjectProperty*>> References;
+		TSet<FName> Rows;
+
+		// False once Table is referenced without Row Name which could be paired with it
+		bool bSplittable = true;
+	};
+
+	bool IsDialogueTable(const UDataTable* DataTable)
+	{
+		return DataTable && DataTable->GetRowStruct() && DataTable->GetRowStruct()->IsChildOf(FDialogueRow::StaticStruct());
+	}
+
+	void CollectTableUsages(const UMounteaDialogueGraph* Graph, TMap<UDataTable*, FTableUsage>& OutUsages)
+	{
+		TArray<UObject*> graphObjects;
+		GetObjectsWithOuter(Graph, graphObjects, true);
+		graphObjects.Add(const_cast<UMounteaDialogueGraph*>(Graph));
+
+		for (UObject* graphObject : graphObjects)
+		{
+			if (graphObject->IsEditorOnly())
+				continue;
+
+			TArray<const FObjectProperty*> tableProperties;
+			for (TFieldIterator<FObjectProperty> propertyItr(graphObject->GetClass()); propertyItr; ++propertyItr)
+			{
+				const FObjectProperty* objectProperty = *propertyItr;
+				if (objectProperty->ArrayDim == 1 && !objectProperty->HasAnyPropertyFlags(CPF_Transient) && objectProperty->PropertyClass->IsChildOf(UDataTable::StaticClass()))
+					tableProperties.Add(objectProperty);
+			}
+
+			// Single 'RowName' can only be paired with single Table, it is unknown which Table it belongs to otherwise
+			const FNameProperty* rowNameProperty = tableProperties.Num() == 1 ? FindFProperty<FNameProperty>(graphObject->GetClass(), RowNamePropertyName) : nullptr;
+			for (const FObjectProperty* objectProperty : tableProperties)
+			{
+				UDataTable* dataTable = Cast<UDataTable>(objectProperty->GetObjectPropertyValue_InContainer(graphObject));
+				if (!IsDialogueTable(dataTable))
+					continue;
+
+				FTableUsage& tableUsage = OutUsages.FindOrAdd(dataTable);
+				tableUsage.References.Emplace(graphObject, objectProperty);
+				if (rowNameProperty)
+					tableUsage.Rows.Add(rowNameProperty->GetPropertyValue_InContainer(graphObject));
+				else
+					tableUsage.bSplittable = false;
+			}
+		}
+	}
+
+	bool ShouldSplitTable(const UDataTable* DataTable, const FTableUsage& TableUsage)
+	{
+		return TableUsage.bSplittable && DataTable->GetRowMap().Num() >= GetDefault<UMounteaDialogueSystemSettings>()->GetSplitDialogueTablesMinRows();
+	}
+
+	// Generated packages of Tables with same name from different folders must not collide
+	FString GetSplitTablePath(const UDataTable* DataTable)
+	{
+		return FString::Printf(TEXT("%s_%08X"), *DataTable->GetName(), GetTypeHash(DataTable->GetPathName()));
+	}
+}
+
+bool FMounteaDialogueTableSplitter::ShouldSplit(UObject* SplitData)
+{
+	using namespace MounteaDialogueTableSplit;
+
+	const UMounteaDialogueGraph* dialogueGraph = Cast<UMounteaDialogueGraph>(SplitData);
+	if (!dialogueGraph || !GetDefault<UMounteaDialogueSystemSettings>()->IsDialogueTableSplitEnabled())
+		return false;
+
+	TMap<UDataTable*, FTableUsage> tableUsages;
+	CollectTableUsages(dialogueGraph, tableUsages);
+	for (const auto& tableUsage : tableUsages)
+	{
+		if (ShouldSplitTable(tableUsage.Key, tableUsage.Value))
+			return true;
+	}
+	return false;
+}
+
+TArray<ICookPackageSplitter::FGeneratedPackage> FMounteaDialogueTableSplitter::GetGenerateList(const UPackage* OwnerPackage, const UObject* OwnerObject)
+{
+	using namespace MounteaDialogueTableSplit;
+
+	SplitTables.Reset();
+
+	TArray<FGeneratedPackage> generatedPackages;
+	const UMounteaDialogueGraph* dialogueGraph = Cast<UMounteaDialogueGraph>(OwnerObject);
+	if (!dialogueGraph)
+		return generatedPackages;
+
+	TMap<UDataTable*, FTableUsage> tableUsages;
+	CollectTableUsages(dialogueGraph, tableUsages);
+	for (const auto& tableUsage : tableUsages)
+	{
+		UDataTable* sourceTable = tableUsage.Key;
+		if (!tableUsage.Value.bSplittable)
+		{
+			LOG_INFO(TEXT("[Split Dialogue Tables] %s: Table %s is referenced without matching Row Name and is kept shared"), *dialogueGraph->GetName(), *sourceTable->GetName())
+			continue;
+		}
+
+		if (!ShouldSplitTable(sourceTable, tableUsage.Value))
+			continue;
+
+		const FString splitTablePath = GetSplitTablePath(sourceTable);
+		FSplitTable& splitTable = SplitTables.Add(splitTablePath);
+		splitTable.SourceTable = sourceTable;
+		splitTable.Rows = tableUsage.Value.Rows.Array();
+		splitTable.Rows.Sort(FNameLexicalLess());
+		for (const auto& reference : tableUsage.Value.References)
+		{
+			splitTable.References.Emplace(reference.Key, reference.Value);
+		}
+
+		FGeneratedPackage& generatedPackage = generatedPackages.Emplace_GetRef();
+		generatedPackage.RelativePath = splitTablePath;
+		generatedPackage.PackageDependencies.Add(sourceTable->GetPackage()->GetFName());
+	}
+
+	return generatedPackages;
+}
+
+bool FMounteaDialogueTableSplitter::PopulateGeneratorPackage(FPopulateContext& PopulateContext)
+{
+	// Split Tables have to exist once Graph is saved, as it references them
+	TArray<UPackage*> keepReferencedPackages;
+	for (const FGeneratedPackageForPopulate& generatedPackage : PopulateContext.GetGeneratedPackages())
+	{
+		const FSplitTable* splitTable = SplitTables.Find(generatedPackage.RelativePath);
+		UDataTable* splitDataTable = splitTable ? FindOrCreateSplitTable(generatedPackage.Package, *splitTable) : nullptr;
+		if (!splitDataTable)
+			continue;
+
+		for (const auto& reference : splitTable->References)
+		{
+			if (UObject* referenceOwner = reference.Key.Get())
+			{
+				reference.Value->SetObjectPropertyValue_InContainer(referenceOwner, splitDataTable);
+				ReplacedReferences.Add({ referenceOwner, reference.Value, splitTable->SourceTable });
+			}
+		}
+		keepReferencedPackages.Add(generatedPackage.Package);
+	}
+
+	PopulateContext.ReportKeepReferencedPackages(keepReferencedPackages);
+	return true;
+}
+
+bool FMounteaDialogueTableSplitter::PopulateGeneratedPackage(FPopulateContext& PopulateContext)
+{
+	const FGeneratedPackageForPopulate* generatedPackage = PopulateContext.GetTargetGeneratedPackage();
+	const FSplitTable* splitTable = generatedPackage ? SplitTables.Find(generatedPackage->RelativePath) : nullptr;
+	return splitTable && FindOrCreateSplitTable(PopulateContext.GetTargetPackage(), *splitTable);
+}
+
+void FMounteaDialogueTableSplitter::Teardown(ETeardown Status)
+{
+	// Graph could stay loaded in Editor after cook, it must keep referencing source Tables
+	for (const FReplacedReference& replacedReference : ReplacedReferences)
+	{
+		if (UObject* referenceOwner = replacedReference.Owner.Get())
+			replacedReference.Property->SetObjectPropertyValue_InContainer(referenceOwner, replacedReference.OriginalTable.Get());
+	}
+
+	ReplacedReferences.Empty();
+	SplitTables.Empty();
+}
+
+UDataTable* FMounteaDialogueTableSplitter::FindOrCreateSplitTable(UPackage* TargetPackage, const FSplitTable& SplitTable)
+{
+	const UDataTable* sourceTable = SplitTable.SourceTable.Get();
+	if (!TargetPackage || !sourceTable)
+		return nullptr;
+
+	if (UDataTable* existingTable = FindObject<UDataTable>(TargetPackage, *sourceTable->GetName()))
+		return existingTable;
+
+	// Texts of Rows which are not from String Table are keyed by package namespace, split Table has to keep the one of source Table
+	TextNamespaceUtil::ForcePackageNamespace(TargetPackage, TextNamespaceUtil::GetPackageNamespace(sourceTable));
+
+	UDataTable* splitDataTable = NewObject<UDataTable>(TargetPackage, sourceTable->GetClass(), sourceTable->GetFName(), RF_Public);
+	splitDataTable->RowStruct = sourceTable->RowStruct;
+	for (const FName& rowName : SplitTable.Rows)
+	{
+		if (const uint8* rowData = sourceTable->FindRowUnchecked(rowName))
+			splitDataTable->AddRow(rowName, *reinterpret_cast<const FTableRowBase*>(rowData));
+	}
+
+	const int32 sourceRows = sourceTable->GetRowMap().Num();
+	const int32 splitRows = splitDataTable->GetRowMap().Num();
+	LOG_INFO(TEXT("[Split Dialogue Tables] %s: Table %s kept %d of %d Rows, stripped %d"), *TargetPackage->GetName(), *sourceTable->GetName(), splitRows, sourceRows, sourceRows - splitRows)
+
+	return splitDataTable;
+}
+
+#endif
@@ -1,10 +1,14 @@
 // All rights reserved Dominik Pavlicek 2023
 
 #include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "Data/MounteaDialogueContext.h"
 #include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueDecoratorProfiler.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
+#include "Subsystems/MounteaDialogueSessionRecorderSubsystem.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -12,6 +16,8 @@
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueDecoratorBase"
 
+DECLARE_CYCLE_STAT(TEXT("Decorator Evaluation"), STAT_MounteaDialogueDecoratorEvaluation, STATGROUP_MounteaDialogue);
+
 UMounteaDialogueDecoratorBase::UMounteaDialogueDecoratorBase()
 {
 #if WITH_EDITORONLY_DATA
@@ -122,6 +128,61 @@ bool UMounteaDialogueDecoratorBase::EvaluateDecorator_Implementation()
 	return OwningWorld != nullptr;
 }
 
+bool UMounteaDialogueDecoratorBase::EvaluateDecoratorCached()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MounteaDialogueDecoratorEvaluation);
+
+	const bool bProfile = FMounteaDialogueDecoratorProfiler::IsEnabled();
+	const double StartTime = bProfile ? FPlatformTime::Seconds() : 0.0;
+
+	bool bResult = false;
+	if (CanEvaluatePure())
+	{
+		// Pure Decorators depend on Context only, Replay reproduces them without recording
+		bResult = EvaluatePure(FMounteaDialogueContextSnapshot(GetContext()));
+	}
+	else
+	{
+		UObject* ManagerObject = OwningManager.GetObject();
+		UMounteaDialogueSessionRecorderSubsystem* Recorder = ManagerObject ? UMounteaDialogueSessionRecorderSubsystem::Get(ManagerObject) : nullptr;
+		if (Recorder && !Recorder->IsActive())
+		{
+			Recorder = nullptr;
+		}
+
+		// Recorded outcome replaces Evaluation during Replay, World state does not have to match
+		const bool bReplayed = Recorder && Recorder->ConsumeDecoratorOutcome(ManagerObject, bResult);
+		if (!bReplayed)
+		{
+			if (UMounteaDialogueContext* Context = GetContext())
+			{
+				bResult = Context->GetDecoratorCache().EvaluateDecorator(this);
+			}
+			else
+			{
+				bResult = EvaluateDecorator();
+			}
+
+			if (Recorder)
+			{
+				Recorder->RecordDecoratorOutcome(ManagerObject, bResult);
+			}
+		}
+	}
+
+	if (bProfile)
+	{
+		FMounteaDialogueDecoratorProfiler::Get().RecordEvaluation(this, (FPlatformTime::Seconds() - StartTime) * 1000.0, bResult);
+	}
+
+	return bResult;
+}
+
+bool UMounteaDialogueDecoratorBase::CanEvaluatePure() const
+{
+	return IsPureDecorator() && GetClass()->HasAnyClassFlags(CLASS_Native);
+}
+
 void UMounteaDialogueDecoratorBase::ExecuteDecorator_Implementation()
 {
 	if (!OwningManager)
@@ -174,7 +235,12 @@ UMounteaDialogueContext* UMounteaDialogueDecoratorBase::GetContext() const
 
 void UMounteaDialogueDecoratorBase::RegisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		const UObject* tickSession = OwningManager.GetObject() ? OwningManager.GetObject() : tickSubsystem->FindSession(ParentTickable.GetObject());
+		tickSubsystem->RegisterTickable(tickSession ? tickSession : ParentTickable.GetObject(), this, ParentTickable.GetObject(), EMounteaDialogueTickGroup::EMDTG_Decorator);
+	}
+	else if (ParentTickable.GetObject() && ParentTickable.GetInterface())
 	{
 		ParentTickable->GetMounteaDialogueTickHandle().AddUniqueDynamic(this, &UMounteaDialogueDecoratorBase::TickMounteaEvent);
 	}
@@ -182,7 +248,11 @@ void UMounteaDialogueDecoratorBase::RegisterTick_Implementation( const TScriptIn
 
 void UMounteaDialogueDecoratorBase::UnregisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		tickSubsystem->UnregisterTickableFromParent(this, ParentTickable.GetObject());
+	}
+	else if (ParentTickable.GetObject() && ParentTickable.GetInterface())
 	{
 		ParentTickable->GetMounteaDialogueTickHandle().RemoveDynamic(this, &UMounteaDialogueDecoratorBase::TickMounteaEvent);
 	}
@@ -191,8 +261,6 @@ void UMounteaDialogueDecoratorBase::UnregisterTick_Implementation( const TScript
 void UMounteaDialogueDecoratorBase::TickMounteaEvent_Implementation(UObject* SelfRef, UObject* ParentTick, float DeltaTime)
 {
 	DecoratorTickEvent.Broadcast(SelfRef, ParentTick, DeltaTime);
-
-	LOG_INFO(TEXT("[%s] %s"), *GetDecoratorName().ToString(), *(OwningManager != nullptr ? OwningManager.GetObject()->GetName() : TEXT("NO MANAGER")))
 }
 
 void FMounteaDialogueDecorator::InitializeDecorator(UWorld* World, const TScriptInterface<IMounteaDialogueParticipantInterface>& OwningParticipant, const TScriptInterface<IMounteaDialogueManagerInterface>& OwningManager) const
@@ -234,7 +302,7 @@ bool FMounteaDialogueDecorator::EvaluateDecorator() const
 {
 	if (DecoratorType)
 	{
-		return DecoratorType->EvaluateDecorator();
+		return DecoratorType->EvaluateDecoratorCached();
 	}
 		
 	LOG_ERROR(TEXT("[EvaluateDecorator] DecoratorType is null (invalid)!"))
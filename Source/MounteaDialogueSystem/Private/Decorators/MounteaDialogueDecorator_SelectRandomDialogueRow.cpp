@@ -64,7 +64,7 @@ void UMounteaDialogueDecorator_SelectRandomDialogueRow::ExecuteDecorator_Impleme
 	}
 
 	const int32 MaxValue = GetContext()->GetActiveDialogueRow().DialogueRowData.Num() - 1;
-	const int32 Range = FMath::RandRange
+	const int32 Range = GetContext()->GetDialogueRandomStream().RandRange
 	(
 		FMath::Max(0, ClampedRange.X),
 		FMath::Min(MaxValue, ClampedRange.Y)
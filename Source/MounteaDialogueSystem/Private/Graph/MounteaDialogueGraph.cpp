@@ -2,11 +2,16 @@
 
 #include "Graph/MounteaDialogueGraph.h"
 
+#include "Data/MounteaDialogueGraphDataTypes.h"
 #include "Edges/MounteaDialogueGraphEdge.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Misc/DataValidation.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
+#include "UObject/AssetRegistryTagsContext.h"
+#include "UObject/ObjectSaveContext.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueGraph"
 
@@ -258,9 +263,47 @@ void UMounteaDialogueGraph::PostInitProperties()
 #endif
 }
 
+void UMounteaDialogueGraph::PostLoad()
+{
+	Super::PostLoad();
+
+	GraphAnalysis.BuildLookup();
+}
+
+bool UMounteaDialogueGraph::IsNodeReachable(const UMounteaDialogueGraphNode* Node) const
+{
+	return Node && GraphAnalysis.IsReachable(GraphAnalysis.FindNodeIndex(Node->GetNodeGUID()));
+}
+
+bool UMounteaDialogueGraph::IsNodeInCycle(const UMounteaDialogueGraphNode* Node) const
+{
+	return Node && GraphAnalysis.IsInCycle(GraphAnalysis.FindNodeIndex(Node->GetNodeGUID()));
+}
+
+int32 UMounteaDialogueGraph::GetNodeRemainingDepth(const UMounteaDialogueGraphNode* Node) const
+{
+	const int32 nodeIndex = Node ? GraphAnalysis.FindNodeIndex(Node->GetNodeGUID()) : INDEX_NONE;
+	return GraphAnalysis.RemainingDepths.IsValidIndex(nodeIndex) ? GraphAnalysis.RemainingDepths[nodeIndex] : INDEX_NONE;
+}
+
+TArray<FGuid> UMounteaDialogueGraph::GetDeadNodes() const
+{
+	return GraphAnalysis.GetDeadNodes();
+}
+
+void UMounteaDialogueGraph::UpdateGraphAnalysis()
+{
+	GraphAnalysis = FMounteaDialogueGraphAnalysis::Analyze(this);
+}
+
 void UMounteaDialogueGraph::RegisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(ParentTickable.GetObject()))
+	{
+		const UObject* tickSession = tickSubsystem->FindSession(ParentTickable.GetObject());
+		tickSubsystem->RegisterTickable(tickSession ? tickSession : ParentTickable.GetObject(), this, ParentTickable.GetObject(), EMounteaDialogueTickGroup::EMDTG_Graph);
+	}
+	else if (ParentTickable.GetObject() && ParentTickable.GetInterface())
 	{
 		ParentTickable->GetMounteaDialogueTickHandle().AddUniqueDynamic(this, &UMounteaDialogueGraph::TickMounteaEvent);
 	}
@@ -268,7 +311,11 @@ void UMounteaDialogueGraph::RegisterTick_Implementation(const TScriptInterface<I
 
 void UMounteaDialogueGraph::UnregisterTick_Implementation(const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(ParentTickable.GetObject()))
+	{
+		tickSubsystem->UnregisterTickableFromParent(this, ParentTickable.GetObject());
+	}
+	else if (ParentTickable.GetObject() && ParentTickable.GetInterface())
 	{
 		ParentTickable->GetMounteaDialogueTickHandle().RemoveDynamic(this, &UMounteaDialogueGraph::TickMounteaEvent);
 	}
@@ -295,6 +342,21 @@ bool UMounteaDialogueGraph::ValidateGraph(FDataValidationContext& Context, bool
 {
 	bool bReturnValue = true;
 	
+	// Validate Decorators and Start Node
+	bReturnValue &= ValidateGraphScope(Context, RichTextFormat);
+
+	// Validate all nodes
+	bReturnValue &= ValidateAllNodes(Context, RichTextFormat);
+
+	ValidateReachability(Context, RichTextFormat);
+
+	return bReturnValue;
+}
+
+bool UMounteaDialogueGraph::ValidateGraphScope(FDataValidationContext& Context, bool RichTextFormat) const
+{
+	bool bReturnValue = true;
+	
 	// Validate Graph and Scoped Decorators
 	bReturnValue &= ValidateDecorators(Context, RichTextFormat, GraphDecorators, TEXT("Graph Decorators"));
 	bReturnValue &= ValidateDecorators(Context, RichTextFormat, GraphScopeDecorators, TEXT("Scoped Graph Decorators"));
@@ -302,9 +364,6 @@ bool UMounteaDialogueGraph::ValidateGraph(FDataValidationContext& Context, bool
 	// Validate Start Node
 	bReturnValue &= ValidateStartNode(Context, RichTextFormat);
 
-	// Validate all nodes
-	bReturnValue &= ValidateAllNodes(Context, RichTextFormat);
-
 	return bReturnValue;
 }
 
@@ -430,16 +489,68 @@ bool UMounteaDialogueGraph::ValidateStartNode(FDataValidationContext& Context, b
 bool UMounteaDialogueGraph::ValidateAllNodes(FDataValidationContext& Context, bool RichTextFormat) const
 {
 	bool bReturnValue = true;
+	TSet<FGuid> validatedNodes;
+	validatedNodes.Reserve(AllNodes.Num());
+	
 	for (UMounteaDialogueGraphNode* Itr : AllNodes)
 	{
-		if (Itr != nullptr && !Itr->ValidateNode(Context, RichTextFormat))
+		if (Itr == nullptr)
+			continue;
+
+		validatedNodes.Add(Itr->GetNodeGUID());
+		
+		bool bCacheHit = false;
+		if (!ValidateNodeCached(Itr, Context, RichTextFormat, bCacheHit))
 		{
 			bReturnValue = false;
 		}
 	}
+
+	// Drop results of removed Nodes
+	for (auto cacheItr = NodeValidationCache.CreateIterator(); cacheItr; ++cacheItr)
+	{
+		if (!validatedNodes.Contains(cacheItr.Key()))
+		{
+			cacheItr.RemoveCurrent();
+		}
+	}
+	
 	return bReturnValue;
 }
 
+bool UMounteaDialogueGraph::ValidateNodeCached(const UMounteaDialogueGraphNode* Node, FDataValidationContext& Context, bool RichTextFormat, bool& bOutCacheHit) const
+{
+	bOutCacheHit = false;
+	if (Node == nullptr)
+		return true;
+
+	const uint32 validationHash = Node->GetValidationHash();
+	FMounteaDialogueNodeValidationResult& validationResult = NodeValidationCache.FindOrAdd(Node->GetNodeGUID());
+
+	bOutCacheHit = validationResult.ValidationHash == validationHash && validationResult.bRichTextFormat == RichTextFormat && validationHash != 0;
+	if (!bOutCacheHit)
+	{
+		FDataValidationContext nodeContext;
+		
+		validationResult = FMounteaDialogueNodeValidationResult();
+		validationResult.ValidationHash = validationHash;
+		validationResult.bRichTextFormat = RichTextFormat;
+		validationResult.bIsValid = Node->ValidateNode(nodeContext, RichTextFormat);
+		nodeContext.SplitIssues(validationResult.Warnings, validationResult.Errors);
+	}
+
+	for (const FText& errorText : validationResult.Errors)
+	{
+		Context.AddError(errorText);
+	}
+	for (const FText& warningText : validationResult.Warnings)
+	{
+		Context.AddWarning(warningText);
+	}
+	
+	return validationResult.bIsValid;
+}
+
 
 EDataValidationResult UMounteaDialogueGraph::IsDataValid(FDataValidationContext& Context) 
 {
@@ -451,6 +562,112 @@ EDataValidationResult UMounteaDialogueGraph::IsDataValid(FDataValidationContext&
 	return EDataValidationResult::Invalid;
 }
 
+void UMounteaDialogueGraph::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		UpdateGraphAnalysis();
+	}
+}
+
+bool UMounteaDialogueGraph::ValidateReachability(FDataValidationContext& Context, bool RichTextFormat) const
+{
+	// Stored analysis is reused as long as Nodes have not changed since last save
+	const FMounteaDialogueGraphAnalysis analysis = GraphAnalysis.IsUpToDate(this) ? GraphAnalysis : FMounteaDialogueGraphAnalysis::Analyze(this);
+	if (!analysis.Depths.IsValidIndex(analysis.FindNodeIndex(StartNode ? StartNode->GetNodeGUID() : FGuid())))
+		return true;
+
+	bool bReturnValue = true;
+	for (int32 i = 0; i < AllNodes.Num(); i++)
+	{
+		const UMounteaDialogueGraphNode* dialogueNode = AllNodes[i];
+		if (!dialogueNode || analysis.IsReachable(i))
+			continue;
+
+		const FText nodeTitle = dialogueNode->GetNodeTitle();
+		const FText TempRichText = FText::Format(INVTEXT("* <RichTextBlock.Bold>{0}</>: Cannot be reached from Start Node!"), nodeTitle);
+		const FText TempText = FText::Format(INVTEXT("{0}: Cannot be reached from Start Node!"), nodeTitle);
+
+		Context.AddWarning(RichTextFormat ? TempRichText : TempText);
+		bReturnValue = false;
+	}
+
+	return bReturnValue;
+}
+
+void UMounteaDialogueGraph::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	// Search Index contains all Row texts and is only used by editor search, it must not ship with cooked asset registry
+	if (Context.IsCooking())
+		return;
+
+	// Tabulators and line breaks are used as separators
+	auto sanitizeIndexValue = [](FString Value)
+	{
+		Value.ReplaceCharInline(TEXT('\t'), TEXT(' '));
+		Value.ReplaceCharInline(TEXT('\n'), TEXT(' '));
+		Value.ReplaceCharInline(TEXT('\r'), TEXT(' '));
+		return Value;
+	};
+
+	FString searchIndex;
+	for (const UMounteaDialogueGraphNode* dialogueNode : AllNodes)
+	{
+		if (!IsValid(dialogueNode))
+		{
+			continue;
+		}
+
+		FString rowName;
+		FString textTokens;
+		if (const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNodeBase = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(dialogueNode))
+		{
+			rowName = dialogueNodeBase->GetRowName().ToString();
+
+			// Not using 'GetDialogueRow' to avoid logging errors for every unfinished Node when saving
+			const UDataTable* dataTable = dialogueNodeBase->GetDataTable();
+			if (dataTable && dataTable->RowStruct && dataTable->RowStruct->IsChildOf(FDialogueRow::StaticStruct()))
+			{
+				if (const FDialogueRow* dialogueRow = dataTable->FindRow<FDialogueRow>(dialogueNodeBase->GetRowName(), TEXT(""), false))
+				{
+					textTokens = dialogueRow->RowTitle.ToString();
+					for (const FDialogueRowData& rowData : dialogueRow->DialogueRowData)
+					{
+						textTokens.Append(TEXT(" ")).Append(rowData.RowText.ToString());
+					}
+				}
+			}
+		}
+
+		TArray<FString> decoratorNames;
+		for (const FMounteaDialogueDecorator& nodeDecorator : dialogueNode->GetNodeDecorators())
+		{
+			if (nodeDecorator.DecoratorType)
+			{
+				decoratorNames.Add(nodeDecorator.DecoratorType->GetClass()->GetName());
+			}
+		}
+
+		const TArray<FString> indexValues =
+		{
+			dialogueNode->GetNodeGUID().ToString(),
+			sanitizeIndexValue(dialogueNode->NodeTitle.ToString()),
+			sanitizeIndexValue(dialogueNode->NodeTypeName.ToString()),
+			sanitizeIndexValue(rowName),
+			sanitizeIndexValue(FString::Join(decoratorNames, TEXT(";"))),
+			sanitizeIndexValue(textTokens)
+		};
+
+		searchIndex.Append(FString::Join(indexValues, TEXT("\t"))).AppendChar(TEXT('\n'));
+	}
+
+	Context.AddTag(FAssetRegistryTag(GetSearchIndexTagName(), searchIndex, FAssetRegistryTag::TT_Hidden));
+}
+
 UMounteaDialogueGraphNode* UMounteaDialogueGraph::ConstructDialogueNode(
 	TSubclassOf<UMounteaDialogueGraphNode> NodeClass)
 {
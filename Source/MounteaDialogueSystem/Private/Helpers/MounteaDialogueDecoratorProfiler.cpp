@@ -0,0 +1,124 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Helpers/MounteaDialogueDecoratorProfiler.h"
+
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarProfileDecorators(
+	TEXT("Mountea.Dialogue.ProfileDecorators"),
+	false,
+	TEXT("Collects Evaluation timings of Dialogue Decorators. Print them with 'Mountea.Dialogue.DumpDecoratorTimings'."));
+
+static FAutoConsoleCommand DumpDecoratorTimingsCommand(
+	TEXT("Mountea.Dialogue.DumpDecoratorTimings"),
+	TEXT("Prints Evaluation timings of Dialogue Decorators, most expensive first."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FMounteaDialogueDecoratorProfiler::Get().DumpReport();
+	}));
+
+static FAutoConsoleCommand ResetDecoratorTimingsCommand(
+	TEXT("Mountea.Dialogue.ResetDecoratorTimings"),
+	TEXT("Clears collected Evaluation timings of Dialogue Decorators."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FMounteaDialogueDecoratorProfiler::Get().Reset();
+	}));
+
+FMounteaDialogueDecoratorProfiler& FMounteaDialogueDecoratorProfiler::Get()
+{
+	static FMounteaDialogueDecoratorProfiler Profiler;
+	return Profiler;
+}
+
+bool FMounteaDialogueDecoratorProfiler::IsEnabled()
+{
+	return CVarProfileDecorators.GetValueOnAnyThread();
+}
+
+void FMounteaDialogueDecoratorProfiler::RecordEvaluation(const UMounteaDialogueDecoratorBase* Decorator, const double DurationMs, const bool bResult)
+{
+	if (!Decorator)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&TimingsLock);
+
+	FMounteaDialogueDecoratorTiming& Timing = FindOrAddTiming(Decorator);
+	Timing.Evaluations++;
+	Timing.Failures += bResult ? 0 : 1;
+	Timing.TotalMs += DurationMs;
+	Timing.MaxMs = FMath::Max(Timing.MaxMs, DurationMs);
+	Timing.DeclaredCostSum += Decorator->GetEvaluationCost();
+}
+
+void FMounteaDialogueDecoratorProfiler::RecordSkipped(const UMounteaDialogueDecoratorBase* Decorator)
+{
+	if (!Decorator)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&TimingsLock);
+
+	FindOrAddTiming(Decorator).Skipped++;
+}
+
+TArray<FMounteaDialogueDecoratorTiming> FMounteaDialogueDecoratorProfiler::GetTimings() const
+{
+	TArray<FMounteaDialogueDecoratorTiming> Result;
+	{
+		FScopeLock Lock(&TimingsLock);
+		Timings.GenerateValueArray(Result);
+	}
+
+	Result.Sort([](const FMounteaDialogueDecoratorTiming& A, const FMounteaDialogueDecoratorTiming& B)
+	{
+		return A.TotalMs > B.TotalMs;
+	});
+
+	return Result;
+}
+
+void FMounteaDialogueDecoratorProfiler::Reset()
+{
+	FScopeLock Lock(&TimingsLock);
+
+	Timings.Empty();
+}
+
+void FMounteaDialogueDecoratorProfiler::DumpReport() const
+{
+	const TArray<FMounteaDialogueDecoratorTiming> SortedTimings = GetTimings();
+	if (SortedTimings.Num() == 0)
+	{
+		UE_LOG(LogMounteaDialogueSystem, Display, TEXT("[Decorator Timings] No Decorator Evaluations recorded. Enable profiling with 'Mountea.Dialogue.ProfileDecorators 1'."));
+		return;
+	}
+
+	UE_LOG(LogMounteaDialogueSystem, Display, TEXT("[Decorator Timings] %-48s %8s %8s %8s %10s %10s %10s %8s"),
+		TEXT("Decorator"), TEXT("Evals"), TEXT("Failed"), TEXT("Skipped"), TEXT("Total ms"), TEXT("Avg ms"), TEXT("Max ms"), TEXT("Cost"));
+
+	for (const FMounteaDialogueDecoratorTiming& Itr : SortedTimings)
+	{
+		const double AverageCost = Itr.Evaluations > 0 ? static_cast<double>(Itr.DeclaredCostSum) / Itr.Evaluations : 0.0;
+		UE_LOG(LogMounteaDialogueSystem, Display, TEXT("[Decorator Timings] %-48s %8d %8d %8d %10.3f %10.4f %10.4f %8.1f"),
+			*Itr.DecoratorClass, Itr.Evaluations, Itr.Failures, Itr.Skipped, Itr.TotalMs, Itr.GetAverageMs(), Itr.MaxMs, AverageCost);
+	}
+}
+
+FMounteaDialogueDecoratorTiming& FMounteaDialogueDecoratorProfiler::FindOrAddTiming(const UMounteaDialogueDecoratorBase* Decorator)
+{
+	const UClass* DecoratorClass = Decorator->GetClass();
+	FMounteaDialogueDecoratorTiming& Timing = Timings.FindOrAdd(DecoratorClass->GetFName());
+	if (Timing.DecoratorClass.IsEmpty())
+	{
+		Timing.DecoratorClass = DecoratorClass->GetName();
+	}
+
+	return Timing;
+}
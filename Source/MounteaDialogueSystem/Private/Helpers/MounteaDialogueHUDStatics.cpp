@@ -55,16 +55,105 @@ TArray<UMounteaDialogueGraphNode_DialogueNodeBase*> UMounteaDialogueHUDStatics::
 	return returnArray;
 }
 
+namespace MounteaDialogueTextCache
+{
+	// Compiled Regex Patterns keyed by pattern string
+	static TMap<FString, FRegexPattern> RegexPatterns;
+	// Compiled Text Templates keyed by source string
+	static TMap<FString, FMounteaDialogueTextTemplate> TextTemplates;
+	static FCriticalSection CacheLock;
+
+	// Caches are cleared once they grow past this size, localized texts would otherwise pile up
+	constexpr int32 MaxCachedEntries = 4096;
+
+	static bool IsLiteralPattern(const FString& Regex)
+	{
+		static const FString regexSymbols = TEXT("\\^$.|?*+()[]{}");
+		for (const TCHAR character : Regex)
+		{
+			int32 symbolIndex;
+			if (regexSymbols.FindChar(character, symbolIndex))
+				return false;
+		}
+		return true;
+	}
+
+	static FRegexPattern FindOrAddPattern(const FString& Regex)
+	{
+		FScopeLock cacheLock(&CacheLock);
+
+		if (const FRegexPattern* cachedPattern = RegexPatterns.Find(Regex))
+			return *cachedPattern;
+
+		if (RegexPatterns.Num() >= MaxCachedEntries)
+			RegexPatterns.Empty();
+
+		return RegexPatterns.Add(Regex, FRegexPattern(Regex));
+	}
+
+	static FMounteaDialogueTextTemplate Compile(const FString& SourceString)
+	{
+		FMounteaDialogueTextTemplate compiledTemplate;
+
+		int32 literalStart = 0;
+		int32 searchPosition = 0;
+		while (searchPosition < SourceString.Len())
+		{
+			const int32 slotStart = SourceString.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, searchPosition);
+			if (slotStart == INDEX_NONE)
+				break;
+
+			const int32 slotEnd = SourceString.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, slotStart + 1);
+			if (slotEnd == INDEX_NONE)
+				break;
+
+			// Nested opening brace means the first one is a literal
+			const int32 nestedStart = SourceString.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, slotStart + 1);
+			if (nestedStart != INDEX_NONE && nestedStart < slotEnd)
+			{
+				searchPosition = nestedStart;
+				continue;
+			}
+
+			compiledTemplate.Literals.Add(SourceString.Mid(literalStart, slotStart - literalStart));
+			compiledTemplate.Slots.Add(SourceString.Mid(slotStart + 1, slotEnd - slotStart - 1));
+
+			literalStart = slotEnd + 1;
+			searchPosition = literalStart;
+		}
+
+		compiledTemplate.Literals.Add(SourceString.Mid(literalStart));
+
+		for (const auto& literal : compiledTemplate.Literals)
+		{
+			compiledTemplate.LiteralsLength += literal.Len();
+		}
+
+		return compiledTemplate;
+	}
+}
+
 FText UMounteaDialogueHUDStatics::ReplaceRegexInText(const FString& Regex, const FText& Replacement, const FText& SourceText)
 {
 	FString	sourceString = SourceText.ToString();
-	FRegexPattern	regexPattern(Regex);
+	FString	replacementText = Replacement.ToString();
+
+	// Plain patterns don't need regex at all
+	if (MounteaDialogueTextCache::IsLiteralPattern(Regex))
+	{
+		if (Regex.IsEmpty())
+			return SourceText;
+		
+		return FText::FromString(sourceString.Replace(*Regex, *replacementText, ESearchCase::CaseSensitive));
+	}
+	
+	const FRegexPattern	regexPattern = MounteaDialogueTextCache::FindOrAddPattern(Regex);
 	FRegexMatcher	regexMatcher(regexPattern, sourceString);
 
 	FString	formattedString;
+	formattedString.Reserve(sourceString.Len());
 
 	int32	previousPosition = 0;
-	FString	replacementText = Replacement.ToString();
 
 	while (regexMatcher.FindNext())
 	{
@@ -78,6 +167,60 @@ FText UMounteaDialogueHUDStatics::ReplaceRegexInText(const FString& Regex, const
 	return FText::FromString(formattedString);
 }
 
+FMounteaDialogueTextTemplate UMounteaDialogueHUDStatics::CompileTextTemplate(const FText& SourceText)
+{
+	const FString sourceString = SourceText.ToString();
+
+	FScopeLock cacheLock(&MounteaDialogueTextCache::CacheLock);
+
+	if (const FMounteaDialogueTextTemplate* cachedTemplate = MounteaDialogueTextCache::TextTemplates.Find(sourceString))
+		return *cachedTemplate;
+
+	if (MounteaDialogueTextCache::TextTemplates.Num() >= MounteaDialogueTextCache::MaxCachedEntries)
+		MounteaDialogueTextCache::TextTemplates.Empty();
+
+	return MounteaDialogueTextCache::TextTemplates.Add(sourceString, MounteaDialogueTextCache::Compile(sourceString));
+}
+
+FText UMounteaDialogueHUDStatics::ResolveTextTemplate(const FMounteaDialogueTextTemplate& Template, const TMap<FString, FText>& Variables)
+{
+	if (!Template.IsValid())
+	{
+		LOG_WARNING(TEXT("[Resolve Text Template] Invalid Text Template!"))
+		return FText::GetEmpty();
+	}
+
+	if (Template.Slots.Num() == 0)
+		return FText::FromString(Template.Literals[0]);
+
+	FString resolvedString;
+	resolvedString.Reserve(Template.LiteralsLength + Template.Slots.Num() * 16);
+
+	for (int32 slotIndex = 0; slotIndex < Template.Slots.Num(); slotIndex++)
+	{
+		resolvedString += Template.Literals[slotIndex];
+
+		const FString& slotName = Template.Slots[slotIndex];
+		if (const FText* slotValue = Variables.Find(slotName))
+			resolvedString += slotValue->ToString();
+		else
+		{
+			resolvedString += TEXT("{");
+			resolvedString += slotName;
+			resolvedString += TEXT("}");
+		}
+	}
+
+	resolvedString += Template.Literals.Last();
+
+	return FText::FromString(resolvedString);
+}
+
+FText UMounteaDialogueHUDStatics::ReplaceTokensInText(const FText& SourceText, const TMap<FString, FText>& Variables)
+{
+	return ResolveTextTemplate(CompileTextTemplate(SourceText), Variables);
+}
+
 int32 UMounteaDialogueHUDStatics::GetWidgetZOrder(UUserWidget* Widget, UObject* WorldContext)
 {
 	if (!Widget || !WorldContext)
@@ -0,0 +1,362 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Helpers/MounteaDialogueMemoryReport.h"
+
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "Edges/MounteaDialogueGraphEdge.h"
+#include "Engine/DataTable.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "HAL/IConsoleManager.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+static FAutoConsoleCommandWithArgsAndOutputDevice MemoryReportCommand(
+	TEXT("Mountea.Dialogue.MemoryReport"),
+	TEXT("Prints memory footprint of loaded Dialogue Graphs and their load sets. Usage: Mountea.Dialogue.MemoryReport [PathFilter] [TopCount]"),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const FString pathFilter = Args.Num() > 0 ? Args[0] : FString();
+		const int32 topCount = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10;
+
+		FMounteaDialogueMemoryReport memoryReport;
+		for (TObjectIterator<UMounteaDialogueGraph> graphItr(RF_ClassDefaultObject); graphItr; ++graphItr)
+		{
+			if (pathFilter.IsEmpty() || graphItr->GetPathName().StartsWith(pathFilter))
+				memoryReport.AddGraph(*graphItr);
+		}
+
+		memoryReport.Finalize();
+		memoryReport.Print(Ar, topCount);
+	}));
+
+namespace MounteaDialogueMemory
+{
+	/**
+	 * Collects objects referenced by serialized object, without following them.
+	 */
+	class FReferenceCollector : public FArchiveUObject
+	{
+	public:
+
+		explicit FReferenceCollector(TSet<UObject*>& InReferences)
+			: References(InReferences)
+		{
+			ArIsObjectReferenceCollector = true;
+			ArIgnoreClassRef = true;
+			ArIgnoreArchetypeRef = true;
+			ArIgnoreOuterRef = true;
+		}
+
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			if (Object)
+				References.Add(Object);
+			return *this;
+		}
+
+		virtual FString GetArchiveName() const override
+		{ return TEXT("MounteaDialogueMemory::FReferenceCollector"); };
+
+	private:
+
+		TSet<UObject*>& References;
+	};
+
+	bool IsEditorOnlyRecursive(const UObject* Object, const UObject* StopAt)
+	{
+		for (const UObject* outer = Object; outer && outer != StopAt; outer = outer->GetOuter())
+		{
+			if (outer->IsEditorOnly())
+				return true;
+		}
+		return false;
+	}
+
+	// Collects assets referenced by given objects which live outside of their package, native and transient objects are ignored
+	void CollectReferencedAssets(const TArray<UObject*>& Objects, const UPackage* OwningPackage, TArray<UObject*>& OutAssets)
+	{
+		TSet<UObject*> references;
+		FReferenceCollector referenceCollector(references);
+		for (UObject* object : Objects)
+		{
+			object->Serialize(referenceCollector);
+		}
+
+		for (UObject* reference : references)
+		{
+			const UPackage* referencePackage = reference->GetPackage();
+			if (!referencePackage || referencePackage == OwningPackage || referencePackage == GetTransientPackage() || referencePackage->HasAnyPackageFlags(PKG_CompiledIn))
+				continue;
+
+			if (UObject* referencedAsset = reference->GetOutermostObject())
+				OutAssets.AddUnique(referencedAsset);
+		}
+	}
+
+	FString FormatBytes(const int64 Bytes)
+	{
+		return FString::Printf(TEXT("%.1f KB"), Bytes / 1024.0);
+	}
+}
+
+int64 FMounteaDialogueMemoryReport::MeasureObject(const UObject* Object)
+{
+	if (!IsValid(Object))
+		return 0;
+
+	FArchiveCountMem countMem(const_cast<UObject*>(Object));
+	return static_cast<int64>(countMem.GetMax()) + Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+}
+
+void FMounteaDialogueMemoryReport::AddGraph(const UMounteaDialogueGraph* Graph)
+{
+	using namespace MounteaDialogueMemory;
+
+	if (!IsValid(Graph))
+		return;
+
+	bFinalized = false;
+
+	FMounteaDialogueGraphMemory& graphMemory = Graphs.AddDefaulted_GetRef();
+	graphMemory.GraphPath = Graph->GetPathName();
+	graphMemory.GraphBytes = MeasureObject(Graph);
+
+	TArray<UObject*> graphObjects;
+	GetObjectsWithOuter(Graph, graphObjects, true);
+
+	for (const UObject* graphObject : graphObjects)
+	{
+		const int64 objectBytes = MeasureObject(graphObject);
+		if (IsEditorOnlyRecursive(graphObject, Graph))
+		{
+			graphMemory.EditorOnlyObjects++;
+			graphMemory.EditorOnlyBytes += objectBytes;
+		}
+		else if (graphObject->IsA<UMounteaDialogueGraphNode>())
+		{
+			graphMemory.Nodes++;
+			graphMemory.NodeBytes += objectBytes;
+		}
+		else if (graphObject->IsA<UMounteaDialogueGraphEdge>())
+		{
+			graphMemory.Edges++;
+			graphMemory.EdgeBytes += objectBytes;
+		}
+		else if (graphObject->IsA<UMounteaDialogueDecoratorBase>())
+		{
+			graphMemory.Decorators++;
+			graphMemory.DecoratorBytes += objectBytes;
+		}
+		else
+		{
+			graphMemory.GraphBytes += objectBytes;
+		}
+	}
+
+	// Editor only objects are not loaded in cooked builds, so they do not pull assets into load set
+	graphObjects.RemoveAll([Graph](const UObject* GraphObject)
+	{
+		return IsEditorOnlyRecursive(GraphObject, Graph);
+	});
+	graphObjects.Add(const_cast<UMounteaDialogueGraph*>(Graph));
+
+	TArray<UObject*> pendingAssets;
+	CollectReferencedAssets(graphObjects, Graph->GetPackage(), pendingAssets);
+
+	TSet<UObject*> loadSet;
+	while (pendingAssets.Num() > 0)
+	{
+		UObject* asset = pendingAssets.Pop(EAllowShrinking::No);
+		if (asset == Graph || loadSet.Contains(asset))
+			continue;
+
+		loadSet.Add(asset);
+
+		TArray<UObject*> referencedAssets;
+		MeasureAsset(asset, referencedAssets);
+		pendingAssets.Append(referencedAssets);
+	}
+
+	for (const UObject* asset : loadSet)
+	{
+		const FString assetPath = asset->GetPathName();
+		graphMemory.LoadSet.Add(assetPath);
+		Assets.FindChecked(assetPath).ReferencingGraphs++;
+		if (FMounteaDialogueDataTableMemory* dataTableMemory = DataTables.Find(assetPath))
+			dataTableMemory->ReferencingGraphs++;
+	}
+}
+
+void FMounteaDialogueMemoryReport::MeasureAsset(UObject* Asset, TArray<UObject*>& OutReferencedAssets)
+{
+	const FString assetPath = Asset->GetPathName();
+
+	TArray<UObject*> assetObjects;
+	GetObjectsWithOuter(Asset, assetObjects, true);
+	assetObjects.Add(Asset);
+
+	MounteaDialogueMemory::CollectReferencedAssets(assetObjects, Asset->GetPackage(), OutReferencedAssets);
+
+	// Asset could be measured already by previously added Graph
+	if (Assets.Contains(assetPath))
+		return;
+
+	FMounteaDialogueAssetMemory& assetMemory = Assets.Add(assetPath);
+	assetMemory.AssetPath = assetPath;
+	assetMemory.AssetClass = Asset->GetClass()->GetName();
+	for (const UObject* assetObject : assetObjects)
+	{
+		assetMemory.Bytes += MeasureObject(assetObject);
+	}
+
+	if (const UDataTable* dataTable = Cast<UDataTable>(Asset))
+		MeasureDataTable(dataTable);
+}
+
+void FMounteaDialogueMemoryReport::MeasureDataTable(const UDataTable* DataTable)
+{
+	FMounteaDialogueDataTableMemory& dataTableMemory = DataTables.Add(DataTable->GetPathName());
+	dataTableMemory.DataTablePath = DataTable->GetPathName();
+	dataTableMemory.Bytes = Assets.FindChecked(dataTableMemory.DataTablePath).Bytes;
+	dataTableMemory.Rows = DataTable->GetRowMap().Num();
+
+	if (!DataTable->GetRowStruct() || !DataTable->GetRowStruct()->IsChildOf(FDialogueRow::StaticStruct()))
+		return;
+
+	for (const auto& tableRow : DataTable->GetRowMap())
+	{
+		if (const FDialogueRow* dialogueRow = reinterpret_cast<const FDialogueRow*>(tableRow.Value))
+		{
+			dataTableMemory.RowData += dialogueRow->DialogueRowData.Num();
+			dataTableMemory.RowDataBytes += dialogueRow->DialogueRowData.GetAllocatedSize();
+		}
+	}
+}
+
+void FMounteaDialogueMemoryReport::Finalize()
+{
+	for (FMounteaDialogueGraphMemory& graphMemory : Graphs)
+	{
+		graphMemory.ExclusiveBytes = graphMemory.GetOwnBytes();
+		graphMemory.SharedBytes = 0;
+
+		for (const FString& assetPath : graphMemory.LoadSet)
+		{
+			const FMounteaDialogueAssetMemory& assetMemory = Assets.FindChecked(assetPath);
+			if (assetMemory.ReferencingGraphs > 1)
+				graphMemory.SharedBytes += assetMemory.Bytes;
+			else
+				graphMemory.ExclusiveBytes += assetMemory.Bytes;
+		}
+
+		graphMemory.ResidentBytes = graphMemory.ExclusiveBytes + graphMemory.SharedBytes;
+	}
+
+	Graphs.Sort([](const FMounteaDialogueGraphMemory& A, const FMounteaDialogueGraphMemory& B)
+	{
+		return A.ResidentBytes > B.ResidentBytes;
+	});
+
+	bFinalized = true;
+}
+
+TArray<FMounteaDialogueAssetMemory> FMounteaDialogueMemoryReport::GetBiggestAssets() const
+{
+	TArray<FMounteaDialogueAssetMemory> biggestAssets;
+	Assets.GenerateValueArray(biggestAssets);
+	biggestAssets.Sort([](const FMounteaDialogueAssetMemory& A, const FMounteaDialogueAssetMemory& B)
+	{
+		return A.Bytes > B.Bytes;
+	});
+	return biggestAssets;
+}
+
+void FMounteaDialogueMemoryReport::Print(FOutputDevice& Ar, const int32 TopCount) const
+{
+	using namespace MounteaDialogueMemory;
+
+	if (!bFinalized)
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("[Memory Report] Report is not finalized!"));
+		return;
+	}
+
+	int64 totalResident = 0;
+	for (const FMounteaDialogueGraphMemory& graphMemory : Graphs)
+	{
+		totalResident += graphMemory.GetOwnBytes();
+	}
+	for (const auto& assetMemory : Assets)
+	{
+		totalResident += assetMemory.Value.Bytes;
+	}
+
+	Ar.Logf(TEXT("[Memory Report] %d Graphs, %d assets in load set, %s resident in total"), Graphs.Num(), Assets.Num(), *FormatBytes(totalResident));
+
+	for (const FMounteaDialogueGraphMemory& graphMemory : Graphs)
+	{
+		Ar.Logf(TEXT("  %s | Resident %s | Exclusive %s | Shared %s | Load Set %d assets"),
+			*graphMemory.GraphPath, *FormatBytes(graphMemory.ResidentBytes), *FormatBytes(graphMemory.ExclusiveBytes), *FormatBytes(graphMemory.SharedBytes), graphMemory.LoadSet.Num());
+		Ar.Logf(TEXT("    Graph %s | Nodes %d: %s | Edges %d: %s | Decorators %d: %s"),
+			*FormatBytes(graphMemory.GraphBytes), graphMemory.Nodes, *FormatBytes(graphMemory.NodeBytes), graphMemory.Edges, *FormatBytes(graphMemory.EdgeBytes), graphMemory.Decorators, *FormatBytes(graphMemory.DecoratorBytes));
+
+		if (graphMemory.EditorOnlyObjects > 0)
+		{
+#if WITH_EDITOR
+			Ar.Logf(TEXT("    Editor only %d objects: %s, stripped on cook"), graphMemory.EditorOnlyObjects, *FormatBytes(graphMemory.EditorOnlyBytes));
+#else
+			Ar.Logf(ELogVerbosity::Warning, TEXT("    Editor only %d objects: %s leaked into cooked build!"), graphMemory.EditorOnlyObjects, *FormatBytes(graphMemory.EditorOnlyBytes));
+#endif
+		}
+	}
+
+	if (DataTables.Num() > 0)
+	{
+		TArray<FMounteaDialogueDataTableMemory> dataTables;
+		DataTables.GenerateValueArray(dataTables);
+		dataTables.Sort([](const FMounteaDialogueDataTableMemory& A, const FMounteaDialogueDataTableMemory& B)
+		{
+			return A.Bytes > B.Bytes;
+		});
+
+		Ar.Logf(TEXT("[Memory Report] Data Tables:"));
+		for (const FMounteaDialogueDataTableMemory& dataTableMemory : dataTables)
+		{
+			Ar.Logf(TEXT("  %s | %s | Rows %d | Row Data %d: %s | %s"),
+				*dataTableMemory.DataTablePath, *FormatBytes(dataTableMemory.Bytes), dataTableMemory.Rows, dataTableMemory.RowData, *FormatBytes(dataTableMemory.RowDataBytes),
+				dataTableMemory.ReferencingGraphs > 1 ? *FString::Printf(TEXT("Shared by %d Graphs"), dataTableMemory.ReferencingGraphs) : TEXT("Exclusive"));
+		}
+	}
+
+	const TArray<FMounteaDialogueAssetMemory> biggestAssets = GetBiggestAssets();
+	if (biggestAssets.Num() > 0)
+	{
+		Ar.Logf(TEXT("[Memory Report] Biggest contributors:"));
+		for (int32 i = 0; i < FMath::Min(TopCount, biggestAssets.Num()); i++)
+		{
+			const FMounteaDialogueAssetMemory& assetMemory = biggestAssets[i];
+			Ar.Logf(TEXT("  %s (%s) | %s | %.1f%% | Loaded by %d Graphs"),
+				*assetMemory.AssetPath, *assetMemory.AssetClass, *FormatBytes(assetMemory.Bytes),
+				totalResident > 0 ? 100.0 * assetMemory.Bytes / totalResident : 0.0, assetMemory.ReferencingGraphs);
+		}
+	}
+}
+
+TArray<FString> FMounteaDialogueMemoryReport::ToCSV() const
+{
+	TArray<FString> csvLines;
+	csvLines.Add(TEXT("Graph,ResidentBytes,ExclusiveBytes,SharedBytes,GraphBytes,Nodes,NodeBytes,Edges,EdgeBytes,Decorators,DecoratorBytes,EditorOnlyObjects,EditorOnlyBytes,LoadSetAssets"));
+	for (const FMounteaDialogueGraphMemory& graphMemory : Graphs)
+	{
+		csvLines.Add(FString::Printf(TEXT("%s,%lld,%lld,%lld,%lld,%d,%lld,%d,%lld,%d,%lld,%d,%lld,%d"),
+			*graphMemory.GraphPath, graphMemory.ResidentBytes, graphMemory.ExclusiveBytes, graphMemory.SharedBytes,
+			graphMemory.GraphBytes, graphMemory.Nodes, graphMemory.NodeBytes, graphMemory.Edges, graphMemory.EdgeBytes,
+			graphMemory.Decorators, graphMemory.DecoratorBytes, graphMemory.EditorOnlyObjects, graphMemory.EditorOnlyBytes, graphMemory.LoadSet.Num()));
+	}
+	return csvLines;
+}
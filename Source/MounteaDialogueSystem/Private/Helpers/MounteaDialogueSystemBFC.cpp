@@ -10,12 +10,42 @@
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
 
+#include "Async/ParallelFor.h"
 #include "Components/AudioComponent.h"
+#include "Data/MounteaDialogueContextSnapshot.h"
+#include "Helpers/MounteaDialogueDecoratorProfiler.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 #include "Data/MounteaDialogueContext.h"
 #include "GameFramework/PlayerState.h"
 #include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
 #include "Sound/SoundBase.h"
 
+DECLARE_CYCLE_STAT(TEXT("Get Allowed Child Nodes"), STAT_MounteaDialogueAllowedChildNodes, STATGROUP_MounteaDialogue);
+
+namespace
+{
+	// Fewer Children are not worth dispatching to worker threads
+	constexpr int32 MinChildNodesForParallelEvaluation = 4;
+
+	// Blueprint overrides of Node Events are separate functions owned by Blueprint class
+	bool IsNodeEventOverridden(const UMounteaDialogueGraphNode* Node, const FName EventName)
+	{
+		const UFunction* EventFunction = Node->GetClass()->FindFunctionByName(EventName);
+		return !EventFunction || EventFunction->GetOuterUClass() != UMounteaDialogueGraphNode::StaticClass();
+	}
+
+	struct FChildNodeEvaluation
+	{
+		// Whether Decorators are evaluated directly instead of calling 'CanStartNode'
+		bool bSplitDecorators = false;
+
+		bool bPurePassed = true;
+
+		TArray<const UMounteaDialogueDecoratorBase*> PureDecorators;
+		TArray<FMounteaDialogueDecorator> OtherDecorators;
+	};
+}
+
 bool UMounteaDialogueSystemBFC::IsEditor()
 {
 #if WITH_EDITOR
@@ -149,15 +179,8 @@ bool UMounteaDialogueSystemBFC::ExecuteDecorators(const UObject* WorldContextObj
 	if (ActiveNode == nullptr)
 		return false;
 
-	// First process Node Decorators, then Graph Decorators
-	// TODO: add weight to them so we can sort them by Weight and execute in correct order
-	TArray<FMounteaDialogueDecorator> AllDecorators;
-
-	AllDecorators.Append(DialogueContext->GetActiveNode()->GetNodeDecorators());
-	if (ActiveNode->DoesInheritDecorators())
-		AllDecorators.Append(DialogueContext->DialogueParticipant->Execute_GetDialogueGraph(participantObject)->GetGraphDecorators());
-		
-	for (auto Itr : AllDecorators)
+	// Sorted by Execution Priority, Node Decorators before Graph Decorators otherwise
+	for (const auto& Itr : ActiveNode->GetExecutionDecorators())
 		Itr.ExecuteDecorator();
 
 	return true;
@@ -306,12 +329,112 @@ TArray<UMounteaDialogueGraphNode*> UMounteaDialogueSystemBFC::GetAllowedChildNod
 
 	if (!ParentNode) return ReturnNodes;
 
-	if (ParentNode->GetChildrenNodes().Num() == 0) return ReturnNodes;
+	const TArray<UMounteaDialogueGraphNode*> ChildrenNodes = ParentNode->GetChildrenNodes();
+	if (ChildrenNodes.Num() == 0) return ReturnNodes;
+
+	SCOPE_CYCLE_COUNTER(STAT_MounteaDialogueAllowedChildNodes);
+
+	// Split Decorators of each Child to pure ones, which are evaluated in parallel, and those which need Game Thread
+	TArray<FChildNodeEvaluation> Evaluations;
+	Evaluations.SetNum(ChildrenNodes.Num());
+
+	const UMounteaDialogueDecoratorBase* ContextSource = nullptr;
+	for (int32 i = 0; i < ChildrenNodes.Num(); i++)
+	{
+		UMounteaDialogueGraphNode* ChildNode = ChildrenNodes[i];
+		FChildNodeEvaluation& Evaluation = Evaluations[i];
+
+		// Nodes with custom 'CanStartNode' logic are evaluated as they are
+		Evaluation.bSplitDecorators = ChildNode && ChildNode->GetGraph() && ChildNode->CanSplitDecoratorEvaluation()
+			&& !IsNodeEventOverridden(ChildNode, GET_FUNCTION_NAME_CHECKED(UMounteaDialogueGraphNode, CanStartNode))
+			&& !IsNodeEventOverridden(ChildNode, GET_FUNCTION_NAME_CHECKED(UMounteaDialogueGraphNode, EvaluateDecorators));
+		if (!Evaluation.bSplitDecorators)
+			continue;
+
+		for (const FMounteaDialogueDecorator& Decorator : ChildNode->GetEvaluationDecorators())
+		{
+			const UMounteaDialogueDecoratorBase* DecoratorObject = Decorator.DecoratorType;
+			if (DecoratorObject && DecoratorObject->CanEvaluatePure())
+			{
+				Evaluation.PureDecorators.Add(DecoratorObject);
+				ContextSource = ContextSource ? ContextSource : DecoratorObject;
+			}
+			else
+			{
+				Evaluation.OtherDecorators.Add(Decorator);
+			}
+		}
+	}
+
+	if (ContextSource)
+	{
+		const TScriptInterface<IMounteaDialogueManagerInterface> Manager = ContextSource->GetManager();
+		const FMounteaDialogueContextSnapshot Snapshot(Manager.GetObject() ? Manager->Execute_GetDialogueContext(Manager.GetObject()) : nullptr);
+		const bool bProfile = FMounteaDialogueDecoratorProfiler::IsEnabled();
+
+		// Each Child writes only its own result, so the outcome doesn't depend on scheduling
+		ParallelFor(Evaluations.Num(), [&Evaluations, &Snapshot, bProfile](const int32 Index)
+		{
+			FChildNodeEvaluation& Evaluation = Evaluations[Index];
+			for (int32 i = 0; i < Evaluation.PureDecorators.Num(); i++)
+			{
+				const UMounteaDialogueDecoratorBase* Decorator = Evaluation.PureDecorators[i];
+				const double StartTime = bProfile ? FPlatformTime::Seconds() : 0.0;
+				const bool bResult = Decorator->EvaluatePure(Snapshot);
+				if (bProfile)
+				{
+					FMounteaDialogueDecoratorProfiler::Get().RecordEvaluation(Decorator, (FPlatformTime::Seconds() - StartTime) * 1000.0, bResult);
+				}
+
+				if (!bResult)
+				{
+					Evaluation.bPurePassed = false;
+					if (bProfile)
+					{
+						for (int32 j = i + 1; j < Evaluation.PureDecorators.Num(); j++)
+						{
+							FMounteaDialogueDecoratorProfiler::Get().RecordSkipped(Evaluation.PureDecorators[j]);
+						}
+					}
+					break;
+				}
+			}
+		}, Evaluations.Num() < MinChildNodesForParallelEvaluation ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
 
-	for (UMounteaDialogueGraphNode* Itr : ParentNode->GetChildrenNodes())
+	// Remaining Decorators are evaluated on Game Thread in original Child order
+	for (int32 i = 0; i < ChildrenNodes.Num(); i++)
 	{
-		if (Itr && Itr->CanStartNode())
-			ReturnNodes.Add(Itr);
+		UMounteaDialogueGraphNode* ChildNode = ChildrenNodes[i];
+		if (!ChildNode)
+			continue;
+
+		const FChildNodeEvaluation& Evaluation = Evaluations[i];
+		if (!Evaluation.bSplitDecorators)
+		{
+			if (ChildNode->CanStartNode())
+				ReturnNodes.Add(ChildNode);
+			continue;
+		}
+
+		// Same as 'EvaluateDecorators', Decorators after the failed one are reported as skipped
+		bool bAllowed = Evaluation.bPurePassed;
+		for (const FMounteaDialogueDecorator& Decorator : Evaluation.OtherDecorators)
+		{
+			if (!bAllowed)
+			{
+				if (!FMounteaDialogueDecoratorProfiler::IsEnabled())
+					break;
+
+				FMounteaDialogueDecoratorProfiler::Get().RecordSkipped(Decorator.DecoratorType);
+				continue;
+			}
+
+			bAllowed = Decorator.EvaluateDecorator();
+		}
+
+		if (bAllowed)
+			ReturnNodes.Add(ChildNode);
 	}
 
 	return ReturnNodes;
@@ -3,9 +3,12 @@
 #include "Nodes/MounteaDialogueGraphNode.h"
 
 #include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueDecoratorProfiler.h"
 #include "Helpers/MounteaDialogueGraphHelpers.h"
 #include "Helpers/MounteaDialogueSystemBFC.h"
 #include "Misc/DataValidation.h"
+#include "Serialization/ObjectWriter.h"
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueNode"
 
@@ -68,7 +71,12 @@ void UMounteaDialogueGraphNode::SetNewWorld(UWorld* NewWorld)
 
 void UMounteaDialogueGraphNode::RegisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		const UObject* tickSession = tickSubsystem->FindSession(ParentTickable.GetObject());
+		tickSubsystem->RegisterTickable(tickSession ? tickSession : ParentTickable.GetObject(), this, ParentTickable.GetObject(), EMounteaDialogueTickGroup::EMDTG_Node);
+	}
+	else if (ParentTickable.GetObject() && ParentTickable.GetInterface())
 	{
 		ParentTickable->GetMounteaDialogueTickHandle().AddUniqueDynamic(this, &UMounteaDialogueGraphNode::TickMounteaEvent);
 	}
@@ -76,7 +84,11 @@ void UMounteaDialogueGraphNode::RegisterTick_Implementation( const TScriptInterf
 
 void UMounteaDialogueGraphNode::UnregisterTick_Implementation( const TScriptInterface<IMounteaDialogueTickableObject>& ParentTickable)
 {
-	if (ParentTickable.GetObject() && ParentTickable.GetInterface())
+	if (auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(this))
+	{
+		tickSubsystem->UnregisterTickableFromParent(this, ParentTickable.GetObject());
+	}
+	else if (ParentTickable.GetObject() && ParentTickable.GetInterface())
 	{
 		ParentTickable->GetMounteaDialogueTickHandle().RemoveDynamic(this, &UMounteaDialogueGraphNode::TickMounteaEvent);
 	}
@@ -92,13 +104,27 @@ void UMounteaDialogueGraphNode::InitializeNode_Implementation(UWorld* InWorld)
 	SetNewWorld(InWorld);
 
 	if (Graph) SetNodeIndex(Graph->AllNodes.Find(this));
+
+	UpdateDecoratorsOrder();
 	
 	OnNodeStateChanged.Broadcast(this);
 }
 
 void UMounteaDialogueGraphNode::PreProcessNode_Implementation(const TScriptInterface<IMounteaDialogueManagerInterface>& Manager)
 {
-	Execute_RegisterTick(this, Graph);
+	RegisterNodeTickables(Manager);
+	
+	Manager->Execute_NodePrepared(Manager.GetObject());
+}
+
+void UMounteaDialogueGraphNode::RegisterNodeTickables(const TScriptInterface<IMounteaDialogueManagerInterface>& Manager)
+{
+	// Node and its Decorators tick within Manager's Session, so the same Node can be active in multiple Dialogues
+	auto tickSubsystem = UMounteaDialogueTickSubsystem::Get(Manager.GetObject());
+	if (tickSubsystem)
+		tickSubsystem->RegisterTickable(Manager.GetObject(), this, Graph, EMounteaDialogueTickGroup::EMDTG_Node);
+	else
+		Execute_RegisterTick(this, Graph);
 
 	for (const auto& nodeDecorator : NodeDecorators)
 	{
@@ -106,9 +132,10 @@ void UMounteaDialogueGraphNode::PreProcessNode_Implementation(const TScriptInter
 			continue;
 
 		nodeDecorator.DecoratorType->SetOwningManager(Manager);
+
+		if (tickSubsystem)
+			tickSubsystem->RegisterTickable(Manager.GetObject(), nodeDecorator.DecoratorType, this, EMounteaDialogueTickGroup::EMDTG_Decorator);
 	}
-	
-	Manager->Execute_NodePrepared(Manager.GetObject());
 }
 
 void UMounteaDialogueGraphNode::ProcessNode_Implementation(const TScriptInterface<IMounteaDialogueManagerInterface>& Manager)
@@ -166,24 +193,107 @@ bool UMounteaDialogueGraphNode::EvaluateDecorators_Implementation() const
 		return false;
 	}
 	
-	bool bSatisfied = true;
-	TArray<FMounteaDialogueDecorator> AllDecorators;
-	if (bInheritGraphDecorators)
+	// Sorted Decorators are reused, unless Node wasn't initialized yet
+	TArray<FMounteaDialogueDecorator> DecoratorsOnDemand;
+	if (!bDecoratorsOrderValid)
+	{
+		DecoratorsOnDemand = GetEvaluationDecorators();
+	}
+	const TArray<FMounteaDialogueDecorator>& AllDecorators = bDecoratorsOrderValid ? EvaluationDecorators : DecoratorsOnDemand;
+
+	for (int32 i = 0; i < AllDecorators.Num(); i++)
+	{
+		if (AllDecorators[i].EvaluateDecorator())
+		{
+			continue;
+		}
+
+		// Cheaper Decorator failed, more expensive ones don't need to be evaluated
+		if (FMounteaDialogueDecoratorProfiler::IsEnabled())
+		{
+			for (int32 j = i + 1; j < AllDecorators.Num(); j++)
+			{
+				FMounteaDialogueDecoratorProfiler::Get().RecordSkipped(AllDecorators[j].DecoratorType);
+			}
+		}
+		return false;
+	}
+
+	return true;
+}
+
+bool UMounteaDialogueGraphNode::CanSplitDecoratorEvaluation() const
+{
+	const UClass* NativeClass = GetClass();
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+
+	return NativeClass && NativeClass->GetOutermost() == StaticClass()->GetOutermost();
+}
+
+void UMounteaDialogueGraphNode::UpdateDecoratorsOrder()
+{
+	bDecoratorsOrderValid = false;
+	EvaluationDecorators = GetEvaluationDecorators();
+	ExecutionDecorators = GetExecutionDecorators();
+	bDecoratorsOrderValid = true;
+}
+
+TArray<FMounteaDialogueDecorator> UMounteaDialogueGraphNode::GetEvaluationDecorators() const
+{
+	if (bDecoratorsOrderValid)
+	{
+		return EvaluationDecorators;
+	}
+
+	TArray<FMounteaDialogueDecorator> Return;
+	if (bInheritGraphDecorators && GetGraph())
 	{
 		// Add those Decorators rather than asking Graph to evaluate, because Nodes might introduce specific context
-		AllDecorators.Append(GetGraph()->GetGraphDecorators());
+		Return.Append(GetGraph()->GetGraphDecorators());
 	}
+	Return.Append(GetNodeDecorators());
 
-	AllDecorators.Append(GetNodeDecorators());
+	// Empty Decorator slots are sorted last, so evaluation still reports them as errors
+	Return.StableSort([](const FMounteaDialogueDecorator& A, const FMounteaDialogueDecorator& B)
+	{
+		if (!A.DecoratorType || !B.DecoratorType)
+		{
+			return A.DecoratorType != nullptr && B.DecoratorType == nullptr;
+		}
+		
+		return A.DecoratorType->GetEvaluationCost() < B.DecoratorType->GetEvaluationCost();
+	});
 
-	if (AllDecorators.Num() == 0) return bSatisfied;
+	return Return;
+}
+
+TArray<FMounteaDialogueDecorator> UMounteaDialogueGraphNode::GetExecutionDecorators() const
+{
+	if (bDecoratorsOrderValid)
+	{
+		return ExecutionDecorators;
+	}
 
-	for (auto Itr : AllDecorators)
+	TArray<FMounteaDialogueDecorator> Return = GetNodeDecorators();
+	if (bInheritGraphDecorators && GetGraph())
 	{
-		if (Itr.EvaluateDecorator() == false) bSatisfied = false;
+		Return.Append(GetGraph()->GetGraphDecorators());
 	}
 
-	return bSatisfied;
+	Return.StableSort([](const FMounteaDialogueDecorator& A, const FMounteaDialogueDecorator& B)
+	{
+		if (!A.DecoratorType || !B.DecoratorType)
+		{
+			return A.DecoratorType != nullptr && B.DecoratorType == nullptr;
+		}
+		
+		return A.DecoratorType->GetExecutionPriority() > B.DecoratorType->GetExecutionPriority();
+	});
+
+	return Return;
 }
 
 void UMounteaDialogueGraphNode::SetNodeIndex(const int32 NewIndex)
@@ -429,6 +539,30 @@ bool UMounteaDialogueGraphNode::ValidateNode(FDataValidationContext& Context, co
 	return bResult;
 }
 
+uint32 UMounteaDialogueGraphNode::GetValidationHash() const
+{
+	// References are written as raw pointers, which is enough to detect re-wiring
+	TArray<uint8> serializedData;
+	FObjectWriter nodeWriter(const_cast<UMounteaDialogueGraphNode*>(this), serializedData);
+
+	uint32 validationHash = FCrc::MemCrc32(serializedData.GetData(), serializedData.Num());
+	for (const auto& decorator : NodeDecorators)
+	{
+		if (!decorator.DecoratorType)
+		{
+			validationHash = HashCombine(validationHash, 0);
+			continue;
+		}
+
+		serializedData.Reset();
+		FObjectWriter decoratorWriter(decorator.DecoratorType, serializedData);
+		validationHash = HashCombine(validationHash, GetTypeHash(decorator.DecoratorType->GetClass()));
+		validationHash = HashCombine(validationHash, FCrc::MemCrc32(serializedData.GetData(), serializedData.Num()));
+	}
+
+	return validationHash;
+}
+
 void UMounteaDialogueGraphNode::OnPasted()
 {
 	NodeGUID = FGuid::NewGuid();
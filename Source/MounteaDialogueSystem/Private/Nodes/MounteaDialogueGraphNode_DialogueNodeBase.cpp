@@ -214,6 +214,18 @@ bool UMounteaDialogueGraphNode_DialogueNodeBase::ValidateNode(FDataValidationCon
 	return bResult;
 }
 
+uint32 UMounteaDialogueGraphNode_DialogueNodeBase::GetValidationHash() const
+{
+	uint32 validationHash = Super::GetValidationHash();
+
+	// Validation depends on Row living in Data Table, which is not part of this Node
+	const FDialogueRow* selectedRow = DataTable != nullptr ? DataTable->FindRow<FDialogueRow>(RowName, FString(), false) : nullptr;
+	validationHash = HashCombine(validationHash, GetTypeHash(selectedRow != nullptr));
+	validationHash = HashCombine(validationHash, GetTypeHash(selectedRow ? selectedRow->DialogueRowData.Num() : INDEX_NONE));
+
+	return validationHash;
+}
+
 void UMounteaDialogueGraphNode_DialogueNodeBase::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -123,6 +123,19 @@ bool UMounteaDialogueGraphNode_ReturnToNode::ValidateNode(FDataValidationContext
 	return bSatisfied;
 }
 
+uint32 UMounteaDialogueGraphNode_ReturnToNode::GetValidationHash() const
+{
+	uint32 validationHash = Super::GetValidationHash();
+
+	// Validation depends on Children of Parent Nodes
+	for (const auto& parentNode : ParentNodes)
+	{
+		validationHash = HashCombine(validationHash, parentNode ? GetTypeHash(parentNode->ChildrenNodes.Num()) : 0);
+	}
+
+	return validationHash;
+}
+
 void UMounteaDialogueGraphNode_ReturnToNode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
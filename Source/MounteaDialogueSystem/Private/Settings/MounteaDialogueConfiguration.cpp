@@ -4,11 +4,13 @@
 #include "Settings/MounteaDialogueConfiguration.h"
 
 #include "Engine/Font.h"
+#include "Subsystems/MounteaDialogueConfigurationSubsystem.h"
 
 UMounteaDialogueConfiguration::UMounteaDialogueConfiguration() :
 	InputMode(EMounteaInputMode::EIM_UIAndGame),
 	bAllowSubtitles(true),
-	bSkipRowWithAudioSkip(false)
+	bSkipRowWithAudioSkip(false),
+	bPrefetchUpcomingRows(true)
 {
 #if WITH_EDITOR
 	if (SubtitlesSettings.SettingsGUID.IsValid() == false)
@@ -56,5 +58,8 @@ void UMounteaDialogueConfiguration::PostEditChangeChainProperty(FPropertyChanged
 				Itr.Value.SubtitlesFont = SetupDefaultFontSettings();
 		}
 	}
+
+	if (auto configurationSubsystem = UMounteaDialogueConfigurationSubsystem::Get())
+		configurationSubsystem->RefreshConfiguration();
 }
 #endif
@@ -5,6 +5,7 @@
 
 #include "Engine/Font.h"
 #include "Settings/MounteaDialogueConfiguration.h"
+#include "Subsystems/MounteaDialogueConfigurationSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "MounteaDialogueSystemSettings"
 
@@ -23,6 +24,8 @@ UMounteaDialogueSystemSettings::UMounteaDialogueSystemSettings()
 
 	LogVerbosity = 14; // hack it
 
+	bSplitDialogueTablesOnCook = false;
+
 #if WITH_EDITOR
 	SubtitlesSettings.SubtitlesFont = SetupDefaultFontSettings();
 	if (SubtitlesSettings.SettingsGUID.IsValid() == false)	SubtitlesSettings.SettingsGUID = FGuid::NewGuid();
@@ -35,50 +38,62 @@ TSoftObjectPtr<UMounteaDialogueConfiguration> UMounteaDialogueSystemSettings::Ge
 	return DialogueConfiguration;
 }
 
+const UMounteaDialogueConfiguration* UMounteaDialogueSystemSettings::GetResolvedConfiguration() const
+{
+	// Only before Engine Subsystems are initialized the loader is used
+	if (const auto configurationSubsystem = UMounteaDialogueConfigurationSubsystem::Get())
+		return configurationSubsystem->GetConfiguration();
+
+	return DialogueConfiguration.LoadSynchronous();
+}
+
 TSoftClassPtr<UUserWidget> UMounteaDialogueSystemSettings::GetDefaultDialogueWidget() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->DefaultDialogueWidgetClass : nullptr;
 }
 
 bool UMounteaDialogueSystemSettings::CanSkipWholeRow() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->bSkipRowWithAudioSkip : false;
 }
 
 EMounteaInputMode UMounteaDialogueSystemSettings::GetDialogueInputMode() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->InputMode : EMounteaInputMode::EIM_UIAndGame;
 }
 
 float UMounteaDialogueSystemSettings::GetDurationCoefficient() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->DurationCoefficient : 8.f;
 }
 
 bool UMounteaDialogueSystemSettings::SubtitlesAllowed() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->bAllowSubtitles : true;
 }
 
 float UMounteaDialogueSystemSettings::GetWidgetUpdateFrequency() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->UpdateFrequency : 0.2f;
 }
 
 float UMounteaDialogueSystemSettings::GetSkipFadeDuration() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->SkipFadeDuration : 0.05f;
 }
 
 FSubtitlesSettings UMounteaDialogueSystemSettings::GetSubtitlesSettings(const FUIRowID& RowID) const
 {
+	if (const auto configurationSubsystem = UMounteaDialogueConfigurationSubsystem::Get())
+		return configurationSubsystem->GetSubtitlesSettings(RowID);
+	
 	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
 	if (!dialogueConfig)
 		return FSubtitlesSettings();
@@ -109,6 +124,9 @@ void UMounteaDialogueSystemSettings::SetSubtitlesSettings(const FSubtitlesSettin
 			dialogueConfig->SubtitlesSettingsOverrides.Add(RowID, NewSettings);
 	}
 
+	if (auto configurationSubsystem = UMounteaDialogueConfigurationSubsystem::Get())
+		configurationSubsystem->RefreshConfiguration();
+
 	SaveConfig();
 }
 
@@ -119,10 +137,40 @@ EMounteaDialogueLoggingVerbosity UMounteaDialogueSystemSettings::GetAllowedLoggV
 
 float UMounteaDialogueSystemSettings::GetSkipDuration() const
 {
-	auto dialogueConfig = DialogueConfiguration.LoadSynchronous();
+	auto dialogueConfig = GetResolvedConfiguration();
 	return dialogueConfig ? dialogueConfig->SkipDuration : 1.f;
 }
 
+bool UMounteaDialogueSystemSettings::IsRowPrefetchEnabled() const
+{
+	auto dialogueConfig = GetResolvedConfiguration();
+	return dialogueConfig ? dialogueConfig->bPrefetchUpcomingRows : true;
+}
+
+int32 UMounteaDialogueSystemSettings::GetPrefetchDepth() const
+{
+	auto dialogueConfig = GetResolvedConfiguration();
+	return dialogueConfig ? FMath::Max(1, dialogueConfig->PrefetchDepth) : 1;
+}
+
+int32 UMounteaDialogueSystemSettings::GetPrefetchMemoryBudget() const
+{
+	auto dialogueConfig = GetResolvedConfiguration();
+	return dialogueConfig ? FMath::Max(1, dialogueConfig->PrefetchMemoryBudget) : 64;
+}
+
+int32 UMounteaDialogueSystemSettings::GetPrefetchPriority() const
+{
+	auto dialogueConfig = GetResolvedConfiguration();
+	return dialogueConfig ? dialogueConfig->PrefetchPriority : 100;
+}
+
+float UMounteaDialogueSystemSettings::GetDialogueTickBudget() const
+{
+	auto dialogueConfig = GetResolvedConfiguration();
+	return dialogueConfig ? dialogueConfig->TickBudget : 0.f;
+}
+
 #if WITH_EDITOR
 
 FSlateFontInfo UMounteaDialogueSystemSettings::SetupDefaultFontSettings()
@@ -141,6 +189,12 @@ void UMounteaDialogueSystemSettings::PostEditChangeProperty(FPropertyChangedEven
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueSystemSettings, DialogueConfiguration))
+	{
+		if (auto configurationSubsystem = UMounteaDialogueConfigurationSubsystem::Get())
+			configurationSubsystem->RefreshConfiguration();
+	}
+
 	if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UMounteaDialogueSystemSettings, DialogueWidgetCommands))
 	{
 		if (DialogueWidgetCommands.Contains(MounteaDialogueWidgetCommands::CreateDialogueWidget) == false)
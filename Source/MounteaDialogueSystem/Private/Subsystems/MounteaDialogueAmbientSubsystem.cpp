@@ -0,0 +1,386 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Subsystems/MounteaDialogueAmbientSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Interfaces/Core/MounteaDialogueManagerInterface.h"
+#include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Settings/MounteaDialogueConfiguration.h"
+#include "Subsystems/MounteaDialogueConfigurationSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ambient Dialogues"), STAT_MounteaAmbientDialogue, STATGROUP_Game);
+
+namespace MounteaAmbientDialogue
+{
+	// How long Promoted Session waits for its Manager to become active
+	constexpr double PromotionTimeout = 2.0;
+}
+
+UMounteaDialogueAmbientSubsystem* UMounteaDialogueAmbientSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* world = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return world ? world->GetSubsystem<UMounteaDialogueAmbientSubsystem>() : nullptr;
+}
+
+void UMounteaDialogueAmbientSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const UMounteaDialogueConfigurationSubsystem* configurationSubsystem = UMounteaDialogueConfigurationSubsystem::Get();
+	const UMounteaDialogueConfiguration* dialogueConfig = configurationSubsystem ? configurationSubsystem->GetConfiguration() : nullptr;
+	if (!dialogueConfig)
+		return;
+
+	PromotionDistance = dialogueConfig->AmbientPromotionDistance;
+	DemotionDistance = FMath::Max(dialogueConfig->AmbientDemotionDistance, PromotionDistance);
+	MaxPromotedSessions = dialogueConfig->MaxPromotedAmbientSessions;
+	SignificanceUpdatesPerFrame = FMath::Max(1, dialogueConfig->AmbientSignificanceUpdatesPerFrame);
+	SimulationStep = FMath::Max(0.01f, dialogueConfig->AmbientSimulationStep);
+}
+
+void UMounteaDialogueAmbientSubsystem::Deinitialize()
+{
+	AmbientSessions.Empty();
+	ViewLocations.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UMounteaDialogueAmbientSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMounteaDialogueAmbientSubsystem, STATGROUP_Tickables);
+}
+
+void UMounteaDialogueAmbientSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_MounteaAmbientDialogue);
+
+	AmbientSessions.RemoveAll([](const FMounteaAmbientDialogueSession& Session)
+	{
+		return Session.bFinished || !Session.Speaker.IsValid() || !Session.Graph.IsValid();
+	});
+
+	if (AmbientSessions.Num() == 0)
+	{
+		AmbientStats = FMounteaAmbientDialogueStats();
+		return;
+	}
+
+	UpdateSignificance();
+	UpdateLOD();
+
+	SimulationAccumulator += DeltaTime;
+	if (SimulationAccumulator >= SimulationStep)
+	{
+		AdvanceSimulation(SimulationAccumulator);
+		SimulationAccumulator = 0.f;
+	}
+}
+
+FGuid UMounteaDialogueAmbientSubsystem::RegisterAmbientDialogue(AActor* Speaker, const bool bLoop)
+{
+	if (!IsValid(Speaker))
+	{
+		LOG_WARNING(TEXT("[Register Ambient Dialogue] Invalid Speaker!"))
+		return FGuid();
+	}
+
+	UActorComponent* participantComponent = Speaker->FindComponentByInterface(UMounteaDialogueParticipantInterface::StaticClass());
+	UMounteaDialogueGraph* dialogueGraph = participantComponent ? IMounteaDialogueParticipantInterface::Execute_GetDialogueGraph(participantComponent) : nullptr;
+	if (!IsValid(dialogueGraph))
+	{
+		LOG_WARNING(TEXT("[Register Ambient Dialogue] Speaker %s has no Dialogue Participant with valid Dialogue Graph!"), *Speaker->GetName())
+		return FGuid();
+	}
+
+	FMounteaAmbientDialogueSession newSession;
+	newSession.SessionGuid = FGuid::NewGuid();
+	newSession.Speaker = Speaker;
+	newSession.Graph = dialogueGraph;
+	newSession.bLoop = bLoop;
+
+	// Only Environment Managers can be used for promotion, Player Managers would create UI
+	UActorComponent* managerComponent = Speaker->FindComponentByInterface(UMounteaDialogueManagerInterface::StaticClass());
+	const IMounteaDialogueManagerInterface* dialogueManager = Cast<IMounteaDialogueManagerInterface>(managerComponent);
+	if (dialogueManager && dialogueManager->GetDialogueManagerType() == EDialogueManagerType::EDMT_EnvironmentDialogue)
+		newSession.Manager = managerComponent;
+
+	RestartSimulation(newSession);
+
+	AmbientSessions.Add(MoveTemp(newSession));
+	return AmbientSessions.Last().SessionGuid;
+}
+
+void UMounteaDialogueAmbientSubsystem::UnregisterAmbientDialogue(const FGuid& SessionGuid)
+{
+	const int32 sessionIndex = AmbientSessions.IndexOfByPredicate([&SessionGuid](const FMounteaAmbientDialogueSession& Session)
+	{
+		return Session.SessionGuid == SessionGuid;
+	});
+
+	if (sessionIndex == INDEX_NONE)
+		return;
+
+	if (AmbientSessions[sessionIndex].LOD == EMounteaAmbientDialogueLOD::EMADL_Promoted)
+		DemoteSession(AmbientSessions[sessionIndex], true);
+
+	AmbientSessions.RemoveAt(sessionIndex);
+}
+
+EMounteaAmbientDialogueLOD UMounteaDialogueAmbientSubsystem::GetAmbientDialogueLOD(const FGuid& SessionGuid) const
+{
+	const FMounteaAmbientDialogueSession* ambientSession = AmbientSessions.FindByPredicate([&SessionGuid](const FMounteaAmbientDialogueSession& Session)
+	{
+		return Session.SessionGuid == SessionGuid;
+	});
+
+	return ambientSession ? ambientSession->LOD : EMounteaAmbientDialogueLOD::Default;
+}
+
+void UMounteaDialogueAmbientSubsystem::UpdateSignificance()
+{
+	ViewLocations.Reset();
+	for (FConstPlayerControllerIterator itr = GetWorld()->GetPlayerControllerIterator(); itr; ++itr)
+	{
+		const APlayerController* playerController = itr->Get();
+		if (!playerController)
+			continue;
+
+		FVector viewLocation;
+		FRotator viewRotation;
+		playerController->GetPlayerViewPoint(viewLocation, viewRotation);
+		ViewLocations.Add(viewLocation);
+	}
+
+	// Only limited number of Sessions is updated each frame, the rest keeps last known distance
+	const int32 sessionsNum = AmbientSessions.Num();
+	const int32 updatesNum = FMath::Min(sessionsNum, SignificanceUpdatesPerFrame);
+	for (int32 updateIndex = 0; updateIndex < updatesNum; updateIndex++)
+	{
+		NextSignificanceIndex = NextSignificanceIndex % sessionsNum;
+		FMounteaAmbientDialogueSession& ambientSession = AmbientSessions[NextSignificanceIndex++];
+
+		const FVector speakerLocation = ambientSession.Speaker->GetActorLocation();
+
+		ambientSession.SquaredDistance = TNumericLimits<float>::Max();
+		for (const FVector& viewLocation : ViewLocations)
+		{
+			ambientSession.SquaredDistance = FMath::Min(ambientSession.SquaredDistance, static_cast<float>(FVector::DistSquared(speakerLocation, viewLocation)));
+		}
+	}
+}
+
+void UMounteaDialogueAmbientSubsystem::UpdateLOD()
+{
+	const float promotionDistanceSquared = FMath::Square(PromotionDistance);
+	const float demotionDistanceSquared = FMath::Square(DemotionDistance);
+
+	int32 promotedNum = 0;
+	TArray<int32> promotionCandidates;
+
+	for (int32 sessionIndex = 0; sessionIndex < AmbientSessions.Num(); sessionIndex++)
+	{
+		FMounteaAmbientDialogueSession& ambientSession = AmbientSessions[sessionIndex];
+
+		if (ambientSession.LOD == EMounteaAmbientDialogueLOD::EMADL_Promoted)
+		{
+			const bool bDialogueActive = IsPromotedDialogueActive(ambientSession);
+			ambientSession.bPromotedDialogueStarted |= bDialogueActive;
+
+			// Manager finished the Dialogue on its own, never started it or player walked away
+			const bool bStartTimedOut = !ambientSession.bPromotedDialogueStarted && GetWorld()->GetTimeSeconds() - ambientSession.PromotionTime > MounteaAmbientDialogue::PromotionTimeout;
+			if ((ambientSession.bPromotedDialogueStarted && !bDialogueActive) || bStartTimedOut)
+			{
+				DemoteSession(ambientSession, bStartTimedOut);
+				ambientSession.bPromotionBlocked = true;
+			}
+			else if (ambientSession.SquaredDistance > demotionDistanceSquared)
+				DemoteSession(ambientSession, true);
+			else
+				promotedNum++;
+
+			continue;
+		}
+
+		if (ambientSession.SquaredDistance > demotionDistanceSquared)
+			ambientSession.bPromotionBlocked = false;
+
+		if (ambientSession.Manager.IsValid() && !ambientSession.bPromotionBlocked && ambientSession.SquaredDistance <= promotionDistanceSquared)
+			promotionCandidates.Add(sessionIndex);
+	}
+
+	// Closest Sessions are promoted first
+	promotionCandidates.Sort([this](const int32 A, const int32 B)
+	{
+		return AmbientSessions[A].SquaredDistance < AmbientSessions[B].SquaredDistance;
+	});
+
+	int32 throttledNum = 0;
+	for (const int32 candidateIndex : promotionCandidates)
+	{
+		if (promotedNum >= MaxPromotedSessions)
+		{
+			throttledNum++;
+			continue;
+		}
+
+		if (PromoteSession(AmbientSessions[candidateIndex]))
+			promotedNum++;
+	}
+
+	AmbientStats.RegisteredSessions = AmbientSessions.Num();
+	AmbientStats.PromotedSessions = promotedNum;
+	AmbientStats.SimulatedSessions = AmbientSessions.Num() - promotedNum;
+	AmbientStats.ThrottledSessions = throttledNum;
+}
+
+void UMounteaDialogueAmbientSubsystem::AdvanceSimulation(const float SimulatedTime)
+{
+	for (auto& ambientSession : AmbientSessions)
+	{
+		if (ambientSession.LOD != EMounteaAmbientDialogueLOD::EMADL_Simulated || ambientSession.bFinished)
+			continue;
+
+		ambientSession.RemainingRowTime -= SimulatedTime;
+
+		// Coarse step might cover multiple short Rows
+		while (ambientSession.RemainingRowTime <= 0.f && !ambientSession.bFinished)
+		{
+			ambientSession.SimulatedRowIndex++;
+			if (ambientSession.SimulatedRowDurations.IsValidIndex(ambientSession.SimulatedRowIndex))
+				ambientSession.RemainingRowTime += ambientSession.SimulatedRowDurations[ambientSession.SimulatedRowIndex];
+			else
+			{
+				const float leftoverTime = ambientSession.RemainingRowTime;
+				AdvanceSimulatedNode(ambientSession);
+				ambientSession.RemainingRowTime += leftoverTime;
+			}
+		}
+	}
+}
+
+void UMounteaDialogueAmbientSubsystem::StartSimulatedNode(FMounteaAmbientDialogueSession& Session, UMounteaDialogueGraphNode* Node) const
+{
+	Session.SimulatedNode = Node;
+	Session.SimulatedRowIndex = 0;
+	Session.SimulatedRowDurations.Reset();
+	Session.RemainingRowTime = 0.f;
+
+	if (const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node))
+	{
+		const FDialogueRow dialogueRow = UMounteaDialogueSystemBFC::GetDialogueRow(dialogueNode);
+		for (const auto& rowData : dialogueRow.DialogueRowData)
+		{
+			// Rows without duration (no sound, awaiting input) still take one Simulation Step, so looping Sessions can't spin
+			Session.SimulatedRowDurations.Add(FMath::Max(SimulationStep, UMounteaDialogueSystemBFC::GetRowDuration(rowData)));
+		}
+	}
+
+	// Nodes without Rows still take one Simulation Step as well
+	if (Session.SimulatedRowDurations.Num() == 0)
+		Session.SimulatedRowDurations.Add(SimulationStep);
+
+	Session.RemainingRowTime = Session.SimulatedRowDurations[0];
+}
+
+void UMounteaDialogueAmbientSubsystem::AdvanceSimulatedNode(FMounteaAmbientDialogueSession& Session) const
+{
+	UMounteaDialogueGraphNode* nextNode = FindNextSimulatedNode(Session.SimulatedNode.Get());
+	if (nextNode)
+	{
+		StartSimulatedNode(Session, nextNode);
+		return;
+	}
+
+	if (Session.bLoop)
+	{
+		// Simulation played the whole Dialogue since last promotion, so it can be promoted again
+		Session.bPromotionBlocked = false;
+		RestartSimulation(Session);
+	}
+	else
+		Session.bFinished = true;
+}
+
+void UMounteaDialogueAmbientSubsystem::RestartSimulation(FMounteaAmbientDialogueSession& Session) const
+{
+	const UMounteaDialogueGraph* dialogueGraph = Session.Graph.Get();
+	UMounteaDialogueGraphNode* firstNode = dialogueGraph ? FindNextSimulatedNode(dialogueGraph->GetStartNode()) : nullptr;
+	if (!firstNode)
+	{
+		Session.bFinished = true;
+		return;
+	}
+
+	StartSimulatedNode(Session, firstNode);
+}
+
+bool UMounteaDialogueAmbientSubsystem::PromoteSession(FMounteaAmbientDialogueSession& Session)
+{
+	UObject* managerObject = Session.Manager.Get();
+	if (!IsValid(managerObject))
+		return false;
+
+	if (!IMounteaDialogueManagerInterface::Execute_CanStartDialogue(managerObject))
+		return false;
+
+	FDialogueParticipants dialogueParticipants;
+	dialogueParticipants.MainParticipant = Session.Speaker.Get();
+
+	IMounteaDialogueManagerInterface::Execute_RequestStartDialogue(managerObject, Session.Speaker.Get(), dialogueParticipants);
+
+	Session.LOD = EMounteaAmbientDialogueLOD::EMADL_Promoted;
+	Session.PromotionTime = GetWorld()->GetTimeSeconds();
+	Session.bPromotedDialogueStarted = false;
+	return true;
+}
+
+void UMounteaDialogueAmbientSubsystem::DemoteSession(FMounteaAmbientDialogueSession& Session, const bool bCloseDialogue)
+{
+	if (bCloseDialogue && IsPromotedDialogueActive(Session))
+		IMounteaDialogueManagerInterface::Execute_RequestCloseDialogue(Session.Manager.Get());
+
+	Session.LOD = EMounteaAmbientDialogueLOD::EMADL_Simulated;
+
+	// Promoted Dialogue finished on its own, non-looping Session is done
+	if (!bCloseDialogue && !Session.bLoop)
+	{
+		Session.bFinished = true;
+		return;
+	}
+
+	// Promoted Dialogue was played from the start, so simulation starts over as well
+	RestartSimulation(Session);
+}
+
+bool UMounteaDialogueAmbientSubsystem::IsPromotedDialogueActive(const FMounteaAmbientDialogueSession& Session)
+{
+	UObject* managerObject = Session.Manager.Get();
+	return IsValid(managerObject) && IMounteaDialogueManagerInterface::Execute_GetManagerState(managerObject) == EDialogueManagerState::EDMS_Active;
+}
+
+UMounteaDialogueGraphNode* UMounteaDialogueAmbientSubsystem::FindNextSimulatedNode(const UMounteaDialogueGraphNode* FromNode)
+{
+	if (!IsValid(FromNode))
+		return nullptr;
+
+	TArray<UMounteaDialogueGraphNode*> childNodes = FromNode->GetChildrenNodes();
+	UMounteaDialogueSystemBFC::SortNodes(childNodes);
+
+	for (UMounteaDialogueGraphNode* childNode : childNodes)
+	{
+		if (IsValid(childNode))
+			return childNode;
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,54 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Subsystems/MounteaDialogueConfigurationSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Settings/MounteaDialogueConfiguration.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+
+UMounteaDialogueConfigurationSubsystem* UMounteaDialogueConfigurationSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UMounteaDialogueConfigurationSubsystem>() : nullptr;
+}
+
+void UMounteaDialogueConfigurationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	RefreshConfiguration();
+}
+
+void UMounteaDialogueConfigurationSubsystem::Deinitialize()
+{
+	CachedConfiguration = nullptr;
+	CachedSubtitlesSettings.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMounteaDialogueConfigurationSubsystem::RefreshConfiguration()
+{
+	const UMounteaDialogueSystemSettings* dialogueSettings = GetDefault<UMounteaDialogueSystemSettings>();
+	CachedConfiguration = dialogueSettings ? dialogueSettings->GetDialogueConfiguration().LoadSynchronous() : nullptr;
+
+	CachedSubtitlesSettings.Empty();
+	CachedDefaultSubtitlesSettings = FSubtitlesSettings();
+
+	if (!CachedConfiguration)
+		return;
+
+	CachedDefaultSubtitlesSettings = CachedConfiguration->SubtitlesSettings;
+
+	CachedSubtitlesSettings.Reserve(CachedConfiguration->SubtitlesSettingsOverrides.Num());
+	for (const auto& subtitlesOverride : CachedConfiguration->SubtitlesSettingsOverrides)
+	{
+		CachedSubtitlesSettings.Add(subtitlesOverride.Key, subtitlesOverride.Value.SettingsGUID.IsValid() ? subtitlesOverride.Value : CachedDefaultSubtitlesSettings);
+	}
+}
+
+const FSubtitlesSettings& UMounteaDialogueConfigurationSubsystem::GetSubtitlesSettings(const FUIRowID& RowID) const
+{
+	const FSubtitlesSettings* subtitlesSettings = CachedSubtitlesSettings.Find(RowID);
+	return subtitlesSettings ? *subtitlesSettings : CachedDefaultSubtitlesSettings;
+}
@@ -0,0 +1,247 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Subsystems/MounteaDialoguePrefetchSubsystem.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+#include "Sound/SoundWave.h"
+
+namespace MounteaDialoguePrefetch
+{
+	// How long are prefetched icon mips kept resident
+	constexpr float IconResidencySeconds = 30.f;
+}
+
+UMounteaDialoguePrefetchSubsystem* UMounteaDialoguePrefetchSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* world = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return world ? world->GetSubsystem<UMounteaDialoguePrefetchSubsystem>() : nullptr;
+}
+
+void UMounteaDialoguePrefetchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const UMounteaDialogueSystemSettings* dialogueSettings = UMounteaDialogueSystemBFC::GetDialogueSystemSettings_Internal();
+	if (!dialogueSettings)
+		return;
+
+	bPrefetchEnabled = dialogueSettings->IsRowPrefetchEnabled();
+	PrefetchDepth = dialogueSettings->GetPrefetchDepth();
+	PrefetchMemoryBudget = static_cast<int64>(dialogueSettings->GetPrefetchMemoryBudget()) * 1024 * 1024;
+	PrefetchPriority = dialogueSettings->GetPrefetchPriority();
+}
+
+void UMounteaDialoguePrefetchSubsystem::Deinitialize()
+{
+	TArray<TWeakObjectPtr<const UObject>> sessionOwners;
+	PrefetchSessions.GetKeys(sessionOwners);
+	for (const auto& sessionOwner : sessionOwners)
+	{
+		ReleaseSession(sessionOwner.Get());
+	}
+	PrefetchSessions.Empty();
+	WaveRetainCounts.Empty();
+
+	for (const auto& widgetHandle : WidgetHandles)
+	{
+		if (widgetHandle.Value.IsValid())
+			widgetHandle.Value->ReleaseHandle();
+	}
+	WidgetHandles.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMounteaDialoguePrefetchSubsystem::PrefetchUpcomingNodes(const UObject* SessionOwner, const UMounteaDialogueGraphNode* FromNode)
+{
+	if (!bPrefetchEnabled || !IsValid(SessionOwner) || !IsValid(FromNode))
+		return;
+
+	TArray<const UMounteaDialogueGraphNode*> upcomingNodes;
+	CollectUpcomingNodes(FromNode, upcomingNodes);
+
+	// Nodes are sorted by distance from Active Node, so closer Rows win once budget is reached
+	TArray<USoundWave*> upcomingWaves;
+	TArray<UTexture2D*> upcomingIcons;
+	for (const auto& upcomingNode : upcomingNodes)
+	{
+		CollectNodeAssets(upcomingNode, upcomingWaves, upcomingIcons);
+	}
+
+	FMounteaDialoguePrefetchSession& prefetchSession = PrefetchSessions.FindOrAdd(SessionOwner);
+
+	// Release Waves which are no longer reachable
+	for (auto itr = prefetchSession.RetainedWaves.CreateIterator(); itr; ++itr)
+	{
+		USoundWave* retainedWave = itr.Key().Get();
+		if (retainedWave && upcomingWaves.Contains(retainedWave))
+			continue;
+
+		ReleaseWave(itr.Key());
+		prefetchSession.RetainedBytes -= itr.Value();
+		itr.RemoveCurrent();
+	}
+
+	for (USoundWave* upcomingWave : upcomingWaves)
+	{
+		if (prefetchSession.RetainedWaves.Contains(upcomingWave))
+			continue;
+
+		const int64 waveSize = upcomingWave->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		if (prefetchSession.RetainedBytes + waveSize > PrefetchMemoryBudget)
+			break;
+
+		RetainWave(upcomingWave);
+		prefetchSession.RetainedWaves.Add(upcomingWave, waveSize);
+		prefetchSession.RetainedBytes += waveSize;
+	}
+
+	for (UTexture2D* upcomingIcon : upcomingIcons)
+	{
+		upcomingIcon->SetForceMipLevelsToBeResident(MounteaDialoguePrefetch::IconResidencySeconds);
+	}
+}
+
+void UMounteaDialoguePrefetchSubsystem::PrefetchWidgetClass(const TSoftClassPtr<UUserWidget>& WidgetClass)
+{
+	if (WidgetClass.IsNull() || WidgetClass.IsValid())
+		return;
+
+	const FSoftObjectPath widgetPath = WidgetClass.ToSoftObjectPath();
+	if (WidgetHandles.Contains(widgetPath))
+		return;
+
+	FStreamableManager& streamableManager = UAssetManager::GetStreamableManager();
+	const TSharedPtr<FStreamableHandle> widgetHandle = streamableManager.RequestAsyncLoad(widgetPath, FStreamableDelegate(), PrefetchPriority);
+	if (!widgetHandle.IsValid())
+	{
+		LOG_WARNING(TEXT("[Prefetch Widget Class] Unable to request async load of %s!"), *widgetPath.ToString())
+		return;
+	}
+
+	WidgetHandles.Add(widgetPath, widgetHandle);
+}
+
+void UMounteaDialoguePrefetchSubsystem::ReleaseSession(const UObject* SessionOwner)
+{
+	FMounteaDialoguePrefetchSession prefetchSession;
+	if (!PrefetchSessions.RemoveAndCopyValue(SessionOwner, prefetchSession))
+		return;
+
+	for (const auto& retainedWave : prefetchSession.RetainedWaves)
+	{
+		ReleaseWave(retainedWave.Key);
+	}
+}
+
+void UMounteaDialoguePrefetchSubsystem::CollectUpcomingNodes(const UMounteaDialogueGraphNode* FromNode, TArray<const UMounteaDialogueGraphNode*>& OutNodes) const
+{
+	// Breadth-first, so Nodes are ordered by distance from 'FromNode'
+	TSet<const UMounteaDialogueGraphNode*> visitedNodes;
+	visitedNodes.Add(FromNode);
+
+	// Graph Analysis baked on save tells which Nodes are dead, those cannot be entered and are not worth prefetching
+	// Nodes missing from analysis, such as ones added since last save, are still scanned
+	const UMounteaDialogueGraph* graph = FromNode->Graph;
+	auto isDeadNode = [graph](const UMounteaDialogueGraphNode* Node)
+	{
+		if (!graph)
+			return false;
+
+		const FMounteaDialogueGraphAnalysis& graphAnalysis = graph->GetGraphAnalysis();
+		const int32 nodeIndex = graphAnalysis.FindNodeIndex(Node->GetNodeGUID());
+		return nodeIndex != INDEX_NONE && !graphAnalysis.IsReachable(nodeIndex);
+	};
+
+	// Not capped by Remaining Depth of Graph Analysis, it counts each cycle as single step and would cut 'Return To Node' loops short
+	TArray<const UMounteaDialogueGraphNode*> currentLayer = { FromNode };
+	for (int32 depth = 0; depth < PrefetchDepth && currentLayer.Num() > 0; depth++)
+	{
+		TArray<const UMounteaDialogueGraphNode*> nextLayer;
+		for (const auto& layerNode : currentLayer)
+		{
+			// Same edges as Graph Analysis, 'Return To Node' continues at its target
+			TArray<const UMounteaDialogueGraphNode*> nextNodes(layerNode->ChildrenNodes);
+			if (const UMounteaDialogueGraphNode_ReturnToNode* returnNode = Cast<UMounteaDialogueGraphNode_ReturnToNode>(layerNode))
+			{
+				nextNodes.Add(returnNode->SelectedNode);
+			}
+
+			for (const auto& nextNode : nextNodes)
+			{
+				if (!IsValid(nextNode) || visitedNodes.Contains(nextNode))
+					continue;
+
+				visitedNodes.Add(nextNode);
+				if (isDeadNode(nextNode))
+					continue;
+
+				nextLayer.Add(nextNode);
+				OutNodes.Add(nextNode);
+			}
+		}
+		currentLayer = MoveTemp(nextLayer);
+	}
+}
+
+void UMounteaDialoguePrefetchSubsystem::CollectNodeAssets(const UMounteaDialogueGraphNode* Node, TArray<USoundWave*>& OutWaves, TArray<UTexture2D*>& OutIcons)
+{
+	const UMounteaDialogueGraphNode_DialogueNodeBase* dialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node);
+	if (!dialogueNode)
+		return;
+
+	const UDataTable* dataTable = dialogueNode->GetDataTable();
+	if (!dataTable || !dataTable->RowStruct || !dataTable->RowStruct->IsChildOf(FDialogueRow::StaticStruct()))
+		return;
+
+	const FDialogueRow* dialogueRow = dataTable->FindRow<FDialogueRow>(dialogueNode->GetRowName(), FString(""), false);
+	if (!dialogueRow)
+		return;
+
+	if (UTexture2D* rowIcon = Cast<UTexture2D>(dialogueRow->RowOptionalIcon))
+		OutIcons.AddUnique(rowIcon);
+
+	for (const auto& rowData : dialogueRow->DialogueRowData)
+	{
+		if (USoundWave* rowWave = Cast<USoundWave>(rowData.RowSound))
+			OutWaves.AddUnique(rowWave);
+	}
+}
+
+void UMounteaDialoguePrefetchSubsystem::RetainWave(USoundWave* Wave)
+{
+	if (!IsValid(Wave))
+		return;
+
+	int32& retainCount = WaveRetainCounts.FindOrAdd(Wave);
+	if (retainCount++ == 0)
+		Wave->RetainCompressedAudio();
+}
+
+void UMounteaDialoguePrefetchSubsystem::ReleaseWave(const TWeakObjectPtr<USoundWave>& Wave)
+{
+	int32* retainCount = WaveRetainCounts.Find(Wave);
+	if (!retainCount)
+		return;
+
+	if (--(*retainCount) > 0)
+		return;
+
+	WaveRetainCounts.Remove(Wave);
+	if (USoundWave* releasedWave = Wave.Get())
+		releasedWave->ReleaseCompressedAudio();
+}
@@ -0,0 +1,600 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Subsystems/MounteaDialogueSessionRecorderSubsystem.h"
+
+#include "TimerManager.h"
+#include "Data/MounteaDialogueContext.h"
+#include "Engine/World.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "HAL/IConsoleManager.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Interfaces/Core/MounteaDialogueParticipantInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static TAutoConsoleVariable<bool> CVarRecordSessions(
+	TEXT("Mountea.Dialogue.RecordSessions"),
+	false,
+	TEXT("Records inputs of all Dialogue sessions into binary logs in 'Saved/MounteaDialogue/Recordings'."));
+
+namespace MounteaDialogueRecorder
+{
+	// How long can Replay wait for Dialogue to accept next input before it is considered diverged
+	constexpr double ReplayStallTimeout = 10.0;
+
+	bool HasBytesLeft(const FArchive& Ar, const int64 Bytes)
+	{
+		return !Ar.IsError() && Ar.TotalSize() - Ar.Tell() >= Bytes;
+	}
+
+	double GetWorldTime(const UObject* WorldContext)
+	{
+		const UWorld* world = WorldContext ? WorldContext->GetWorld() : nullptr;
+		return world ? world->GetTimeSeconds() : 0.0;
+	}
+
+	uint32 ToMilliseconds(const double Seconds)
+	{
+		return static_cast<uint32>(FMath::Clamp(Seconds * 1000.0, 0.0, static_cast<double>(MAX_uint32)));
+	}
+}
+
+void FMounteaDialogueSessionRecording::Write(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	FMemoryWriter Ar(OutBytes);
+
+	uint32 magic = Magic;
+	uint16 version = static_cast<uint16>(EMounteaDialogueRecordingVersion::Latest);
+	Ar << magic;
+	Ar << version;
+
+	FString graphPath = DialogueGraph.ToString();
+	FGuid startingNodeGuid = StartingNodeGuid;
+	int32 randomSeed = RandomSeed;
+	Ar << graphPath;
+	Ar << startingNodeGuid;
+	Ar << randomSeed;
+
+	uint32 tagsNum = ParticipantTags.Num();
+	Ar.SerializeIntPacked(tagsNum);
+	for (const FGameplayTag& participantTag : ParticipantTags)
+	{
+		FString tagName = participantTag.ToString();
+		Ar << tagName;
+	}
+
+	uint32 durationMs = DurationMs;
+	Ar.SerializeIntPacked(durationMs);
+
+	// Times are stored as deltas from previous input, so they pack into 1-2 bytes each
+	uint32 inputsNum = Inputs.Num();
+	Ar.SerializeIntPacked(inputsNum);
+	uint32 previousTimeMs = 0;
+	for (const FMounteaDialogueRecordedInput& input : Inputs)
+	{
+		uint8 inputType = static_cast<uint8>(input.Type);
+		uint32 deltaMs = input.TimeMs - FMath::Min(previousTimeMs, input.TimeMs);
+		Ar << inputType;
+		Ar.SerializeIntPacked(deltaMs);
+		if (input.Type == EMounteaDialogueRecordedInputType::SelectNode)
+		{
+			FGuid nodeGuid = input.NodeGuid;
+			Ar << nodeGuid;
+		}
+		previousTimeMs = input.TimeMs;
+	}
+
+	uint32 outcomesNum = DecoratorOutcomes.Num();
+	Ar.SerializeIntPacked(outcomesNum);
+	for (uint32 byteStart = 0; byteStart < outcomesNum; byteStart += 8)
+	{
+		uint8 outcomesByte = 0;
+		for (uint32 bit = 0; bit < 8 && byteStart + bit < outcomesNum; bit++)
+		{
+			outcomesByte |= DecoratorOutcomes[byteStart + bit] ? (1 << bit) : 0;
+		}
+		Ar << outcomesByte;
+	}
+}
+
+bool FMounteaDialogueSessionRecording::Read(const TArray<uint8>& Bytes)
+{
+	using namespace MounteaDialogueRecorder;
+
+	*this = FMounteaDialogueSessionRecording();
+
+	FMemoryReader Ar(Bytes);
+	uint32 magic = 0;
+	uint16 version = 0;
+	if (!HasBytesLeft(Ar, sizeof(magic) + sizeof(version)))
+		return false;
+
+	Ar << magic;
+	Ar << version;
+	if (magic != Magic)
+	{
+		LOG_WARNING(TEXT("[Read Dialogue Recording] Data is not a Dialogue Recording!"))
+		return false;
+	}
+
+	if (version == static_cast<uint16>(EMounteaDialogueRecordingVersion::Invalid) || version > static_cast<uint16>(EMounteaDialogueRecordingVersion::Latest))
+	{
+		LOG_WARNING(TEXT("[Read Dialogue Recording] Unsupported Recording version %d!"), version)
+		return false;
+	}
+
+	FString graphPath;
+	Ar << graphPath;
+	Ar << StartingNodeGuid;
+	Ar << RandomSeed;
+	DialogueGraph = FSoftObjectPath(graphPath);
+
+	uint32 tagsNum = 0;
+	Ar.SerializeIntPacked(tagsNum);
+	if (!HasBytesLeft(Ar, tagsNum))
+		return false;
+
+	for (uint32 i = 0; i < tagsNum; i++)
+	{
+		FString tagName;
+		Ar << tagName;
+		ParticipantTags.Add(FGameplayTag::RequestGameplayTag(FName(*tagName), false));
+	}
+
+	Ar.SerializeIntPacked(DurationMs);
+
+	// Each input takes at least type and packed delta
+	uint32 inputsNum = 0;
+	Ar.SerializeIntPacked(inputsNum);
+	if (!HasBytesLeft(Ar, static_cast<int64>(inputsNum) * 2))
+		return false;
+
+	Inputs.Reserve(inputsNum);
+	uint32 timeMs = 0;
+	for (uint32 i = 0; i < inputsNum; i++)
+	{
+		uint8 inputType = 0;
+		uint32 deltaMs = 0;
+		Ar << inputType;
+		Ar.SerializeIntPacked(deltaMs);
+		if (inputType > static_cast<uint8>(EMounteaDialogueRecordedInputType::CloseDialogue))
+			return false;
+
+		FMounteaDialogueRecordedInput& input = Inputs.AddDefaulted_GetRef();
+		input.Type = static_cast<EMounteaDialogueRecordedInputType>(inputType);
+		timeMs += deltaMs;
+		input.TimeMs = timeMs;
+		if (input.Type == EMounteaDialogueRecordedInputType::SelectNode)
+			Ar << input.NodeGuid;
+	}
+
+	uint32 outcomesNum = 0;
+	Ar.SerializeIntPacked(outcomesNum);
+	if (!HasBytesLeft(Ar, (static_cast<int64>(outcomesNum) + 7) / 8))
+		return false;
+
+	DecoratorOutcomes.Init(false, outcomesNum);
+	for (uint32 byteStart = 0; byteStart < outcomesNum; byteStart += 8)
+	{
+		uint8 outcomesByte = 0;
+		Ar << outcomesByte;
+		for (uint32 bit = 0; bit < 8 && byteStart + bit < outcomesNum; bit++)
+		{
+			DecoratorOutcomes[byteStart + bit] = (outcomesByte & (1 << bit)) != 0;
+		}
+	}
+
+	return !Ar.IsError();
+}
+
+FString FMounteaDialogueSessionRecording::ToString() const
+{
+	return FString::Printf(TEXT("Graph: %s | Seed: %d | Inputs: %d | Decorator Outcomes: %d | Duration: %.2fs"),
+		*DialogueGraph.ToString(), RandomSeed, Inputs.Num(), DecoratorOutcomes.Num(), DurationMs / 1000.f);
+}
+
+UMounteaDialogueSessionRecorderSubsystem* UMounteaDialogueSessionRecorderSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* world = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return world ? world->GetSubsystem<UMounteaDialogueSessionRecorderSubsystem>() : nullptr;
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::Deinitialize()
+{
+	if (UWorld* world = GetWorld())
+		world->GetTimerManager().ClearTimer(TimerHandle_ReplayTick);
+
+	Recordings.Empty();
+	Replays.Empty();
+	LastRecordings.Empty();
+	ArmedManagers.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::RecordNextSession(UObject* Manager)
+{
+	if (!IsValid(Manager) || !Manager->Implements<UMounteaDialogueManagerInterface>())
+	{
+		LOG_WARNING(TEXT("[Record Next Session] Object is not a Dialogue Manager!"))
+		return;
+	}
+
+	ArmedManagers.Add(Manager);
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::GetLastRecording(const UObject* Manager, TArray<uint8>& OutBytes) const
+{
+	if (const TArray<uint8>* recordingBytes = LastRecordings.Find(Manager))
+	{
+		OutBytes = *recordingBytes;
+		return true;
+	}
+
+	return false;
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::StartReplay(UObject* Manager, AActor* DialogueInitiator, const FDialogueParticipants& Participants, const TArray<uint8>& RecordingBytes, const float PlaybackRate)
+{
+	if (!IsValid(Manager) || !Manager->Implements<UMounteaDialogueManagerInterface>())
+	{
+		LOG_WARNING(TEXT("[Start Replay] Object is not a Dialogue Manager!"))
+		return false;
+	}
+
+	const AActor* owningActor = IMounteaDialogueManagerInterface::Execute_GetOwningActor(Manager);
+	if (!owningActor || !owningActor->HasAuthority())
+	{
+		LOG_WARNING(TEXT("[Start Replay] Dialogue can be replayed only by Authority!"))
+		return false;
+	}
+
+	if (Replays.Contains(Manager) || IMounteaDialogueManagerInterface::Execute_GetManagerState(Manager) == EDialogueManagerState::EDMS_Active)
+	{
+		LOG_WARNING(TEXT("[Start Replay] Manager %s is already in Dialogue!"), *Manager->GetName())
+		return false;
+	}
+
+	FReplaySession newReplay;
+	if (!newReplay.Recording.Read(RecordingBytes))
+	{
+		LOG_WARNING(TEXT("[Start Replay] Recording could not be read!"))
+		return false;
+	}
+
+	bool bParticipantFound = false;
+	const TScriptInterface<IMounteaDialogueParticipantInterface> mainParticipant = UMounteaDialogueSystemBFC::FindDialogueParticipantInterface(Participants.MainParticipant, bParticipantFound);
+	const UMounteaDialogueGraph* dialogueGraph = bParticipantFound && mainParticipant.GetObject() ? mainParticipant->Execute_GetDialogueGraph(mainParticipant.GetObject()) : nullptr;
+	if (!dialogueGraph || FSoftObjectPath(dialogueGraph) != newReplay.Recording.DialogueGraph)
+	{
+		LOG_WARNING(TEXT("[Start Replay] Main Participant %s does not use recorded Graph %s!"), *GetNameSafe(Participants.MainParticipant), *newReplay.Recording.DialogueGraph.ToString())
+		return false;
+	}
+
+	// Recorded choices are only meaningful from the same Node, Graph could have changed since recording
+	const bool bStartingNodeInGraph = dialogueGraph->GetAllNodes().ContainsByPredicate([&newReplay](const UMounteaDialogueGraphNode* Node)
+	{
+		return Node && Node->GetNodeGUID() == newReplay.Recording.StartingNodeGuid;
+	});
+	if (!bStartingNodeInGraph)
+	{
+		LOG_WARNING(TEXT("[Start Replay] Recorded Starting Node %s is not part of Graph %s!"), *newReplay.Recording.StartingNodeGuid.ToString(), *dialogueGraph->GetName())
+		return false;
+	}
+
+	const UMounteaDialogueGraphNode* startingNode = UMounteaDialogueSystemBFC::GetStartingNode(mainParticipant, dialogueGraph);
+	if (!startingNode || startingNode->GetNodeGUID() != newReplay.Recording.StartingNodeGuid)
+	{
+		LOG_WARNING(TEXT("[Start Replay] Main Participant %s would start from %s, recording started from %s!"), *GetNameSafe(Participants.MainParticipant), *GetNameSafe(startingNode), *newReplay.Recording.StartingNodeGuid.ToString())
+		return false;
+	}
+
+	// Participants added by Manager itself, such as Player Pawn, are only known once Dialogue starts, so given Participants must be subset of recorded ones
+	TArray<FGameplayTag> unmatchedTags = newReplay.Recording.ParticipantTags;
+	TArray<UObject*> liveParticipants(Participants.OtherParticipants);
+	liveParticipants.Add(Participants.MainParticipant);
+	for (UObject* liveParticipant : liveParticipants)
+	{
+		bool bLiveParticipantFound = false;
+		const TScriptInterface<IMounteaDialogueParticipantInterface> participantInterface = UMounteaDialogueSystemBFC::FindDialogueParticipantInterface(liveParticipant, bLiveParticipantFound);
+		if (!bLiveParticipantFound || !participantInterface.GetObject())
+			continue;
+
+		const FGameplayTag participantTag = IMounteaDialogueParticipantInterface::Execute_GetParticipantTag(participantInterface.GetObject());
+		if (unmatchedTags.RemoveSingle(participantTag) == 0)
+		{
+			LOG_WARNING(TEXT("[Start Replay] Participant %s with Tag %s was not part of recording!"), *GetNameSafe(liveParticipant), *participantTag.ToString())
+			return false;
+		}
+	}
+
+	newReplay.PlaybackRate = FMath::Max(0.f, PlaybackRate);
+	newReplay.StartTime = MounteaDialogueRecorder::GetWorldTime(this);
+	Replays.Add(Manager, MoveTemp(newReplay));
+
+	LOG_INFO(TEXT("[Start Replay] Replaying %s"), *Replays[Manager].Recording.ToString())
+
+	IMounteaDialogueManagerInterface::Execute_RequestStartDialogue(Manager, DialogueInitiator, Participants);
+
+	// Request could have failed synchronously
+	if (!Replays.Contains(Manager))
+		return false;
+
+	if (IMounteaDialogueManagerInterface::Execute_GetManagerState(Manager) != EDialogueManagerState::EDMS_Active)
+	{
+		Replays.Remove(Manager);
+		LOG_WARNING(TEXT("[Start Replay] Manager %s failed to start replayed Dialogue!"), *Manager->GetName())
+		return false;
+	}
+
+	if (UWorld* world = GetWorld(); world && !TimerHandle_ReplayTick.IsValid())
+		TimerHandle_ReplayTick = world->GetTimerManager().SetTimerForNextTick(this, &UMounteaDialogueSessionRecorderSubsystem::TickReplays);
+
+	return true;
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::IsReplaying(UObject* Manager) const
+{
+	return Replays.Contains(Manager);
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::SaveRecordingToFile(const TArray<uint8>& RecordingBytes, const FString& FilePath)
+{
+	if (!FFileHelper::SaveArrayToFile(RecordingBytes, *FilePath))
+	{
+		LOG_WARNING(TEXT("[Save Recording To File] Failed to write %s!"), *FilePath)
+		return false;
+	}
+
+	return true;
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::LoadRecordingFromFile(const FString& FilePath, TArray<uint8>& OutBytes)
+{
+	if (!FFileHelper::LoadFileToArray(OutBytes, *FilePath))
+	{
+		LOG_WARNING(TEXT("[Load Recording From File] Failed to read %s!"), *FilePath)
+		return false;
+	}
+
+	return true;
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::BeginSession(UObject* Manager)
+{
+	if (!IsValid(Manager) || Replays.Contains(Manager))
+		return;
+
+	const bool bArmed = ArmedManagers.Remove(Manager) > 0;
+	if (!bArmed && !CVarRecordSessions.GetValueOnGameThread())
+		return;
+
+	FRecordingSession& newRecording = Recordings.Add(Manager);
+	newRecording.StartTime = MounteaDialogueRecorder::GetWorldTime(this);
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::SessionContextCreated(UObject* Manager, UMounteaDialogueContext* Context)
+{
+	if (!IsValid(Context))
+		return;
+
+	if (FReplaySession* replay = Replays.Find(Manager))
+	{
+		Context->SetDialogueRandomSeed(replay->Recording.RandomSeed);
+		return;
+	}
+
+	FRecordingSession* recording = Recordings.Find(Manager);
+	if (!recording)
+		return;
+
+	const UMounteaDialogueGraphNode* startingNode = Context->GetActiveNode();
+	recording->Recording.DialogueGraph = startingNode ? FSoftObjectPath(startingNode->GetGraph()) : FSoftObjectPath();
+	recording->Recording.StartingNodeGuid = startingNode ? startingNode->GetNodeGUID() : FGuid();
+	recording->Recording.RandomSeed = Context->GetDialogueRandomSeed();
+
+	for (const auto& dialogueParticipant : Context->DialogueParticipants)
+	{
+		if (const UObject* participantObject = dialogueParticipant.GetObject())
+			recording->Recording.ParticipantTags.Add(IMounteaDialogueParticipantInterface::Execute_GetParticipantTag(participantObject));
+	}
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::RecordInput(const UObject* Manager, const EMounteaDialogueRecordedInputType Type, const FGuid& NodeGuid)
+{
+	FRecordingSession* recording = Recordings.Find(Manager);
+	if (!recording)
+		return;
+
+	FMounteaDialogueRecordedInput& newInput = recording->Recording.Inputs.AddDefaulted_GetRef();
+	newInput.Type = Type;
+	newInput.NodeGuid = NodeGuid;
+	newInput.TimeMs = MounteaDialogueRecorder::ToMilliseconds(MounteaDialogueRecorder::GetWorldTime(this) - recording->StartTime);
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::EndSession(UObject* Manager)
+{
+	if (Replays.Remove(Manager) > 0)
+	{
+		LOG_INFO(TEXT("[End Session] Replay of %s finished"), *GetNameSafe(Manager))
+		return;
+	}
+
+	FRecordingSession recording;
+	if (!Recordings.RemoveAndCopyValue(Manager, recording))
+		return;
+
+	// Start request failed before any Context was created, nothing worth keeping
+	if (recording.Recording.DialogueGraph.IsNull())
+		return;
+
+	recording.Recording.DurationMs = MounteaDialogueRecorder::ToMilliseconds(MounteaDialogueRecorder::GetWorldTime(this) - recording.StartTime);
+
+	TArray<uint8> recordingBytes;
+	recording.Recording.Write(recordingBytes);
+
+	LOG_INFO(TEXT("[End Session] Recorded %s (%d bytes)"), *recording.Recording.ToString(), recordingBytes.Num())
+
+	if (CVarRecordSessions.GetValueOnGameThread())
+		SaveRecordingToDisk(Manager, recordingBytes);
+
+	LastRecordings.Add(Manager, MoveTemp(recordingBytes));
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::ConsumeDecoratorOutcome(UObject* Manager, bool& OutResult)
+{
+	FReplaySession* replay = Replays.Find(Manager);
+	if (!replay)
+		return false;
+
+	if (!replay->Recording.DecoratorOutcomes.IsValidIndex(replay->NextDecoratorOutcome))
+	{
+		LOG_WARNING(TEXT("[Consume Decorator Outcome] Replay of %s evaluated more Decorators than were recorded, Decorator will be evaluated instead!"), *GetNameSafe(Manager))
+		return false;
+	}
+
+	OutResult = replay->Recording.DecoratorOutcomes[replay->NextDecoratorOutcome++];
+	return true;
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::RecordDecoratorOutcome(const UObject* Manager, const bool bResult)
+{
+	if (FRecordingSession* recording = Recordings.Find(Manager))
+		recording->Recording.DecoratorOutcomes.Add(bResult);
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::TickReplays()
+{
+	TimerHandle_ReplayTick.Invalidate();
+
+	// Injected inputs can close Dialogue and end its Replay, so Replays cannot be iterated directly
+	TArray<TWeakObjectPtr<UObject>> replayOwners;
+	Replays.GetKeys(replayOwners);
+	for (const auto& replayOwner : replayOwners)
+	{
+		UObject* manager = replayOwner.Get();
+		if (!IsValid(manager))
+		{
+			Replays.Remove(replayOwner);
+			continue;
+		}
+
+		FReplaySession* replay = Replays.Find(replayOwner);
+		if (replay && !TickReplay(manager, *replay))
+			Replays.Remove(replayOwner);
+	}
+
+	if (Replays.Num() > 0)
+	{
+		if (UWorld* world = GetWorld())
+			TimerHandle_ReplayTick = world->GetTimerManager().SetTimerForNextTick(this, &UMounteaDialogueSessionRecorderSubsystem::TickReplays);
+	}
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::TickReplay(UObject* Manager, FReplaySession& Replay)
+{
+	IMounteaDialogueManagerInterface* managerInterface = Cast<IMounteaDialogueManagerInterface>(Manager);
+	UWorld* world = GetWorld();
+	if (!managerInterface || !world)
+		return false;
+
+	if (IMounteaDialogueManagerInterface::Execute_GetManagerState(Manager) != EDialogueManagerState::EDMS_Active)
+		return false;
+
+	const UMounteaDialogueContext* dialogueContext = IMounteaDialogueManagerInterface::Execute_GetDialogueContext(Manager);
+	if (!UMounteaDialogueSystemBFC::IsContextValid(dialogueContext))
+		return true;
+
+	FTimerManager& timerManager = world->GetTimerManager();
+	FTimerHandle& rowTimer = managerInterface->GetDialogueRowTimerHandle();
+	const bool bRowPlaying = timerManager.IsTimerActive(rowTimer);
+
+	const FMounteaDialogueRecordedInput* nextInput = Replay.Recording.Inputs.IsValidIndex(Replay.NextInput) ? &Replay.Recording.Inputs[Replay.NextInput] : nullptr;
+
+	// Headless Replay does not wait for Rows to finish, unless the Row was skipped in Recording
+	// Skipping it later, once options are shown, would advance the Node again
+	const bool bSkipPlayingRow = nextInput && nextInput->Type == EMounteaDialogueRecordedInputType::SkipRow;
+	if (Replay.PlaybackRate <= 0.f && bRowPlaying && !bSkipPlayingRow)
+	{
+		timerManager.ClearTimer(rowTimer);
+		IMounteaDialogueManagerInterface::Execute_DialogueRowProcessed(Manager, false);
+		return true;
+	}
+
+	const double worldTime = MounteaDialogueRecorder::GetWorldTime(this);
+	const double elapsedMs = Replay.PlaybackRate <= 0.f ? TNumericLimits<double>::Max() : (worldTime - Replay.StartTime) * 1000.0 * Replay.PlaybackRate;
+
+	if (nextInput && nextInput->TimeMs <= elapsedMs && CanApplyInput(dialogueContext, *nextInput))
+	{
+		Replay.StallStartTime = 0.0;
+		Replay.NextInput++;
+
+		switch (nextInput->Type)
+		{
+			case EMounteaDialogueRecordedInputType::SelectNode:
+				IMounteaDialogueManagerInterface::Execute_SelectNode(Manager, nextInput->NodeGuid);
+				break;
+			case EMounteaDialogueRecordedInputType::SkipRow:
+				IMounteaDialogueManagerInterface::Execute_SkipDialogueRow(Manager);
+				break;
+			case EMounteaDialogueRecordedInputType::CloseDialogue:
+				IMounteaDialogueManagerInterface::Execute_RequestCloseDialogue(Manager);
+				break;
+		}
+		return true;
+	}
+
+	// Dialogue waits for input which Replay cannot provide, recorded session diverged
+	const bool bAwaitingInput = !bRowPlaying && (!nextInput || nextInput->TimeMs <= elapsedMs);
+	if (!bAwaitingInput)
+	{
+		Replay.StallStartTime = 0.0;
+		return true;
+	}
+
+	if (Replay.StallStartTime <= 0.0)
+	{
+		Replay.StallStartTime = worldTime;
+		return true;
+	}
+
+	if (worldTime - Replay.StallStartTime < MounteaDialogueRecorder::ReplayStallTimeout)
+		return true;
+
+	LOG_WARNING(TEXT("[Tick Replay] Replay of %s diverged from Recording at input %d, closing Dialogue!"), *Manager->GetName(), Replay.NextInput)
+	IMounteaDialogueManagerInterface::Execute_RequestCloseDialogue(Manager);
+	return false;
+}
+
+bool UMounteaDialogueSessionRecorderSubsystem::CanApplyInput(const UMounteaDialogueContext* Context, const FMounteaDialogueRecordedInput& Input)
+{
+	switch (Input.Type)
+	{
+		case EMounteaDialogueRecordedInputType::SelectNode:
+			return Context->GetChildrenNodes().ContainsByPredicate([&Input](const UMounteaDialogueGraphNode* Node)
+			{
+				return Node && Node->GetNodeGUID() == Input.NodeGuid;
+			});
+		case EMounteaDialogueRecordedInputType::SkipRow:
+			return Context->GetActiveNode() && Context->GetActiveNode()->IsA(UMounteaDialogueGraphNode_DialogueNodeBase::StaticClass());
+		case EMounteaDialogueRecordedInputType::CloseDialogue:
+			return true;
+	}
+
+	return false;
+}
+
+void UMounteaDialogueSessionRecorderSubsystem::SaveRecordingToDisk(const UObject* Manager, const TArray<uint8>& RecordingBytes) const
+{
+	const FString fileName = FString::Printf(TEXT("%s_%s.mdrec"), *GetNameSafe(Manager), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	const FString filePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MounteaDialogue"), TEXT("Recordings"), fileName);
+	if (SaveRecordingToFile(RecordingBytes, filePath))
+		LOG_INFO(TEXT("[Save Recording To Disk] Recording saved to %s"), *filePath)
+}
@@ -0,0 +1,318 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+
+#include "Subsystems/MounteaDialogueTickSubsystem.h"
+
+#include "Algo/BinarySearch.h"
+#include "Engine/World.h"
+#include "Helpers/MounteaDialogueGraphHelpers.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Interfaces/Core/MounteaDialogueTickableObject.h"
+#include "Settings/MounteaDialogueSystemSettings.h"
+
+DECLARE_CYCLE_STAT(TEXT("Dialogue Tick"), STAT_MounteaDialogueTick, STATGROUP_MounteaDialogue);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Tickables"), STAT_MounteaDialogueTickables, STATGROUP_MounteaDialogue);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dispatched Tickables"), STAT_MounteaDialogueDispatched, STATGROUP_MounteaDialogue);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Tickables"), STAT_MounteaDialogueDeferred, STATGROUP_MounteaDialogue);
+
+UMounteaDialogueTickSubsystem* UMounteaDialogueTickSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* world = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return world ? world->GetSubsystem<UMounteaDialogueTickSubsystem>() : nullptr;
+}
+
+void UMounteaDialogueTickSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (const UMounteaDialogueSystemSettings* dialogueSettings = UMounteaDialogueSystemBFC::GetDialogueSystemSettings_Internal())
+		TickBudgetMs = dialogueSettings->GetDialogueTickBudget();
+}
+
+void UMounteaDialogueTickSubsystem::Deinitialize()
+{
+	TickEntries.Empty();
+	PendingEntries.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UMounteaDialogueTickSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMounteaDialogueTickSubsystem, STATGROUP_Tickables);
+}
+
+void UMounteaDialogueTickSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_MounteaDialogueTick);
+
+	TickStats.DispatchedLastFrame = 0;
+	TickStats.DeferredLastFrame = 0;
+	TickStats.GroupCostMs.Reset();
+
+	const int32 entriesNum = TickEntries.Num();
+	if (entriesNum == 0)
+	{
+		TickStats.RegisteredTickables = 0;
+		TickStats.LastFrameCostMs = 0.f;
+		return;
+	}
+
+	const double frameStart = FPlatformTime::Seconds();
+	const double budgetSeconds = TickBudgetMs > 0.f ? TickBudgetMs / 1000.0 : 0.0;
+
+	// Everything is due time, those which are not dispatched will carry it over
+	for (auto& tickEntry : TickEntries)
+	{
+		tickEntry.AccumulatedTime += DeltaTime;
+	}
+
+	bIsDispatching = true;
+
+	// Always walked in Tick Group order, deferral is tracked per entry
+	for (auto& tickEntry : TickEntries)
+	{
+		if (tickEntry.bPendingRemoval || tickEntry.AccumulatedTime < tickEntry.TickInterval)
+			continue;
+
+		// Entries deferred last frame are dispatched regardless of budget, so no Tickable is starved
+		if (!tickEntry.bDeferred && budgetSeconds > 0.0 && FPlatformTime::Seconds() - frameStart > budgetSeconds)
+		{
+			tickEntry.bDeferred = true;
+			TickStats.DeferredLastFrame++;
+			continue;
+		}
+
+		const double entryStart = FPlatformTime::Seconds();
+
+		// Entries registered or removed while dispatching are only flushed afterwards, so reference stays valid
+		DispatchTick(tickEntry, tickEntry.AccumulatedTime);
+		tickEntry.AccumulatedTime = 0.f;
+		tickEntry.bDeferred = false;
+
+		TickStats.GroupCostMs.FindOrAdd(tickEntry.TickGroup) += static_cast<float>((FPlatformTime::Seconds() - entryStart) * 1000.0);
+		TickStats.DispatchedLastFrame++;
+	}
+
+	bIsDispatching = false;
+
+	FlushPendingChanges();
+
+	TickStats.RegisteredTickables = TickEntries.Num();
+	TickStats.LastFrameCostMs = static_cast<float>((FPlatformTime::Seconds() - frameStart) * 1000.0);
+	TickStats.AverageFrameCostMs = FMath::Lerp(TickStats.AverageFrameCostMs, TickStats.LastFrameCostMs, 0.1f);
+	TickStats.PeakFrameCostMs = FMath::Max(TickStats.PeakFrameCostMs, TickStats.LastFrameCostMs);
+
+	SET_DWORD_STAT(STAT_MounteaDialogueTickables, TickStats.RegisteredTickables);
+	SET_DWORD_STAT(STAT_MounteaDialogueDispatched, TickStats.DispatchedLastFrame);
+	SET_DWORD_STAT(STAT_MounteaDialogueDeferred, TickStats.DeferredLastFrame);
+}
+
+void UMounteaDialogueTickSubsystem::RegisterTickable(const UObject* Session, UObject* Tickable, UObject* ParentTickable, const EMounteaDialogueTickGroup TickGroup, const float TickInterval)
+{
+	if (!IsValid(Tickable) || !Tickable->Implements<UMounteaDialogueTickableObject>())
+	{
+		LOG_WARNING(TEXT("[Register Tickable] Object is not valid or doesn't implement `IMounteaDialogueTickableObject`!"))
+		return;
+	}
+
+	const int32 existingIndex = FindEntryIndex(Session, Tickable);
+	if (existingIndex != INDEX_NONE)
+	{
+		FMounteaDialogueTickEntry& existingEntry = TickEntries[existingIndex];
+		existingEntry.ParentTickable = ParentTickable;
+		existingEntry.TickInterval = FMath::Max(0.f, TickInterval);
+		existingEntry.bPendingRemoval = false;
+		return;
+	}
+
+	FMounteaDialogueTickEntry newEntry;
+	newEntry.Tickable = Tickable;
+	newEntry.ParentTickable = ParentTickable;
+	newEntry.Session = Session;
+	newEntry.TickGroup = TickGroup;
+	newEntry.TickInterval = FMath::Max(0.f, TickInterval);
+	newEntry.bNativeDispatch = Tickable->GetClass()->IsNative() && Cast<IMounteaDialogueTickableObject>(Tickable) != nullptr;
+
+	if (bIsDispatching)
+	{
+		for (const auto& pendingEntry : PendingEntries)
+		{
+			if (pendingEntry.Session == Session && pendingEntry.Tickable == Tickable)
+				return;
+		}
+		PendingEntries.Add(MoveTemp(newEntry));
+	}
+	else
+		InsertEntry(MoveTemp(newEntry));
+}
+
+void UMounteaDialogueTickSubsystem::UnregisterTickable(const UObject* Session, const UObject* Tickable)
+{
+	PendingEntries.RemoveAll([Session, Tickable](const FMounteaDialogueTickEntry& Entry)
+	{
+		return Entry.Session == Session && Entry.Tickable == Tickable;
+	});
+
+	const int32 entryIndex = FindEntryIndex(Session, Tickable);
+	if (entryIndex == INDEX_NONE)
+		return;
+
+	if (bIsDispatching)
+	{
+		TickEntries[entryIndex].bPendingRemoval = true;
+		bHasPendingRemovals = true;
+	}
+	else
+		TickEntries.RemoveAt(entryIndex);
+}
+
+void UMounteaDialogueTickSubsystem::UnregisterTickableFromParent(const UObject* Tickable, const UObject* ParentTickable)
+{
+	auto isMatching = [Tickable, ParentTickable](const FMounteaDialogueTickEntry& Entry)
+	{
+		return Entry.Tickable == Tickable && (ParentTickable == nullptr || Entry.ParentTickable == ParentTickable);
+	};
+
+	PendingEntries.RemoveAll(isMatching);
+
+	if (bIsDispatching)
+	{
+		for (auto& tickEntry : TickEntries)
+		{
+			if (isMatching(tickEntry))
+			{
+				tickEntry.bPendingRemoval = true;
+				bHasPendingRemovals = true;
+			}
+		}
+	}
+	else
+		TickEntries.RemoveAll(isMatching);
+}
+
+void UMounteaDialogueTickSubsystem::UnregisterSession(const UObject* Session)
+{
+	auto isMatching = [Session](const FMounteaDialogueTickEntry& Entry)
+	{
+		return Entry.Session == Session;
+	};
+
+	PendingEntries.RemoveAll(isMatching);
+
+	if (bIsDispatching)
+	{
+		for (auto& tickEntry : TickEntries)
+		{
+			if (isMatching(tickEntry))
+			{
+				tickEntry.bPendingRemoval = true;
+				bHasPendingRemovals = true;
+			}
+		}
+	}
+	else
+		TickEntries.RemoveAll(isMatching);
+}
+
+const UObject* UMounteaDialogueTickSubsystem::FindSession(const UObject* Tickable) const
+{
+	for (const auto& tickEntry : TickEntries)
+	{
+		if (tickEntry.Tickable == Tickable && !tickEntry.bPendingRemoval)
+			return tickEntry.Session.Get();
+	}
+
+	for (const auto& pendingEntry : PendingEntries)
+	{
+		if (pendingEntry.Tickable == Tickable)
+			return pendingEntry.Session.Get();
+	}
+
+	return nullptr;
+}
+
+void UMounteaDialogueTickSubsystem::SetTickInterval(UObject* Tickable, const float NewTickInterval)
+{
+	for (auto& tickEntry : TickEntries)
+	{
+		if (tickEntry.Tickable == Tickable)
+			tickEntry.TickInterval = FMath::Max(0.f, NewTickInterval);
+	}
+
+	for (auto& pendingEntry : PendingEntries)
+	{
+		if (pendingEntry.Tickable == Tickable)
+			pendingEntry.TickInterval = FMath::Max(0.f, NewTickInterval);
+	}
+}
+
+void UMounteaDialogueTickSubsystem::SetTickBudget(const float NewTickBudgetMs)
+{
+	TickBudgetMs = FMath::Max(0.f, NewTickBudgetMs);
+}
+
+void UMounteaDialogueTickSubsystem::DispatchTick(const FMounteaDialogueTickEntry& TickEntry, const float DeltaTime) const
+{
+	UObject* tickableObject = TickEntry.Tickable.Get();
+	if (!IsValid(tickableObject))
+		return;
+
+	UObject* parentObject = TickEntry.ParentTickable.Get();
+
+	if (TickEntry.bNativeDispatch)
+	{
+		if (IMounteaDialogueTickableObject* nativeTickable = Cast<IMounteaDialogueTickableObject>(tickableObject))
+		{
+			nativeTickable->TickMounteaEvent_Implementation(tickableObject, parentObject, DeltaTime);
+			return;
+		}
+	}
+
+	IMounteaDialogueTickableObject::Execute_TickMounteaEvent(tickableObject, tickableObject, parentObject, DeltaTime);
+}
+
+void UMounteaDialogueTickSubsystem::FlushPendingChanges()
+{
+	if (bHasPendingRemovals)
+	{
+		TickEntries.RemoveAll([](const FMounteaDialogueTickEntry& Entry)
+		{
+			return Entry.bPendingRemoval;
+		});
+		bHasPendingRemovals = false;
+	}
+
+	// Stale Objects are removed as well, Garbage Collected objects would never unregister
+	TickEntries.RemoveAll([](const FMounteaDialogueTickEntry& Entry)
+	{
+		return !Entry.Tickable.IsValid();
+	});
+
+	for (auto& pendingEntry : PendingEntries)
+	{
+		InsertEntry(MoveTemp(pendingEntry));
+	}
+	PendingEntries.Empty();
+}
+
+int32 UMounteaDialogueTickSubsystem::FindEntryIndex(const UObject* Session, const UObject* Tickable) const
+{
+	return TickEntries.IndexOfByPredicate([Session, Tickable](const FMounteaDialogueTickEntry& Entry)
+	{
+		return Entry.Session == Session && Entry.Tickable == Tickable;
+	});
+}
+
+void UMounteaDialogueTickSubsystem::InsertEntry(FMounteaDialogueTickEntry&& NewEntry)
+{
+	// Keep entries sorted by Tick Group, new entry goes after all entries of the same Group
+	const int32 insertIndex = Algo::UpperBoundBy(TickEntries, NewEntry.TickGroup, [](const FMounteaDialogueTickEntry& Entry)
+	{
+		return Entry.TickGroup;
+	});
+
+	TickEntries.Insert(MoveTemp(NewEntry), insertIndex);
+}
@@ -11,6 +11,7 @@
 #include "Interfaces/UMG/MounteaDialogueOptionInterface.h"
 
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Subsystems/MounteaDialoguePrefetchSubsystem.h"
 
 UMounteaDialogueOptionsContainer::UMounteaDialogueOptionsContainer(const FObjectInitializer& ObjectInitializer) :
 	Super(ObjectInitializer), FocusedOption(INDEX_NONE), LastFocusedOption(INDEX_NONE), bForcedFocusEnabled(true)
@@ -96,8 +97,12 @@ TSoftClassPtr<UUserWidget> UMounteaDialogueOptionsContainer::GetDialogueOptionCl
 
 void UMounteaDialogueOptionsContainer::SetDialogueOptionClass_Implementation(const TSoftClassPtr<UUserWidget>& NewDialogueOptionClass)
 {
-	if (NewDialogueOptionClass.LoadSynchronous() != DialogueOptionClass.LoadSynchronous())
-		DialogueOptionClass = NewDialogueOptionClass;
+	if (NewDialogueOptionClass == DialogueOptionClass)
+		return;
+
+	DialogueOptionClass = NewDialogueOptionClass;
+	if (auto prefetchSubsystem = UMounteaDialoguePrefetchSubsystem::Get(this))
+		prefetchSubsystem->PrefetchWidgetClass(DialogueOptionClass);
 }
 
 void UMounteaDialogueOptionsContainer::AddNewDialogueOption_Implementation(UMounteaDialogueGraphNode_DialogueNodeBase* NewDialogueOption)
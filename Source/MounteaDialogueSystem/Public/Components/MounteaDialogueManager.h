@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
+#include "Data/MounteaDialogueSessionSnapshot.h"
 #include "MounteaDialogueManager.generated.h"
 
 class UMounteaDialogueDialogueNetSync;
@@ -134,6 +135,29 @@ public:
 	virtual int32 GetDialogueWidgetZOrder_Implementation() const override;
 	virtual void SetDialogueWidgetZOrder_Implementation(const int32 NewZOrder) override;
 
+	/**
+	 * Captures active Dialogue session, so it can be resumed later using 'RestoreDialogueSession'.
+	 * Useful before saving the game or Server travel.
+	 *
+	 * @param OutSnapshot	Captured Dialogue session.
+	 * @return False if there is no active Dialogue to capture.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager", meta=(CustomTag="MounteaK2Getter"))
+	bool CaptureDialogueSession(FMounteaDialogueSessionSnapshot& OutSnapshot) const;
+
+	/**
+	 * Resumes captured Dialogue session directly in Active state.
+	 * Prepare Node and Node Decorators are not executed again, Dialogue UI is created showing the captured stage.
+	 * ❗ Authority only, Manager must be locally controlled in networked games and must not be in active Dialogue
+	 *
+	 * @param DialogueInitiator	Actor which initiates the Dialogue, same as for 'RequestStartDialogue'.
+	 * @param Participants		Participants of restored Dialogue. Main Participant must use Graph of the snapshot.
+	 * @param Snapshot			Session captured by 'CaptureDialogueSession'.
+	 * @return Whether session could be restored.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Manager", meta=(CustomTag="MounteaK2Setter"))
+	bool RestoreDialogueSession(AActor* DialogueInitiator, const FDialogueParticipants& Participants, const FMounteaDialogueSessionSnapshot& Snapshot);
+
 	virtual void SyncContext(const FMounteaDialogueContextReplicatedStruct& Context) override;
 
 private:
@@ -166,11 +190,16 @@ private:
 
 	bool SetupPlayerDialogue(TSet<TScriptInterface<IMounteaDialogueParticipantInterface>>& DialogueParticipants, TArray<FText>& ErrorMessages) const;
 	bool SetupEnvironmentDialogue(AActor* DialogueInitiator, const TSet<TScriptInterface<IMounteaDialogueParticipantInterface>>& DialogueParticipants, TArray<FText>& ErrorMessages);
+	// Adds Participants required by Manager Type and checks all of them can participate
+	bool SetupDialogueParticipants(AActor* DialogueInitiator, TSet<TScriptInterface<IMounteaDialogueParticipantInterface>>& DialogueParticipants, TArray<FText>& ErrorMessages);
 	static bool ValidateMainParticipant(AActor* MainParticipant, TScriptInterface<IMounteaDialogueParticipantInterface>& OutParticipant, TArray<FText>& ErrorMessages);
 	static void GatherOtherParticipants(const TArray<TObjectPtr<UObject>>& OtherParticipants, TSet<TScriptInterface<IMounteaDialogueParticipantInterface>>& OutParticipants);
 	
 	void ProcessWorldWidgetUpdate(const FString& Command);
 
+	// Shows captured stage of restored session instead of preparing Active Node
+	void ResumeDialogueSession(const FMounteaDialogueSessionSnapshot& Snapshot);
+
 public:
 	
 	bool IsAuthority() const;
@@ -350,6 +379,9 @@ private:
 	UPROPERTY(Transient, ReplicatedUsing=OnRep_DialogueContext)
 	FMounteaDialogueContextReplicatedStruct TransientDialogueContext;
 
+	// Session being restored, consumed once Dialogue starts
+	TOptional<FMounteaDialogueSessionSnapshot> PendingSessionRestore;
+
 protected:
 	
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
@@ -279,6 +279,31 @@ public:
 
 #pragma endregion
 
+#pragma region SaveData
+
+public:
+
+	/**
+	 * Writes Traversed Path and Starting Node to compact binary save format.
+	 * Much smaller and faster to load than 'SaveGame' properties for Participants with long Dialogue history.
+	 *
+	 * @param OutSaveData	Serialized Dialogue state.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Participant", meta=(CustomTag="MounteaK2Getter"))
+	void WriteDialogueSaveData(TArray<uint8>& OutSaveData) const;
+
+	/**
+	 * Replaces Traversed Path and Starting Node with data written by 'WriteDialogueSaveData'.
+	 * Nodes which were removed from current Dialogue Graph since saving are dropped.
+	 *
+	 * @param SaveData	Serialized Dialogue state.
+	 * @return Whether data could be read. Current state is kept otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Participant", meta=(CustomTag="MounteaK2Setter"))
+	bool ReadDialogueSaveData(const TArray<uint8>& SaveData);
+
+#pragma endregion
+
 #pragma region TickableInterface
 	
 public:
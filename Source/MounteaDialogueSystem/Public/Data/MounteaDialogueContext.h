@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "MounteaDialogueGraphDataTypes.h"
+#include "MounteaDialogueDecoratorCache.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
 #include "UObject/Object.h"
 #include "MounteaDialogueContext.generated.h"
@@ -191,6 +192,55 @@ public:
 	virtual bool RemoveDialogueParticipants(const TArray<TScriptInterface<IMounteaDialogueParticipantInterface>>& NewParticipants);
 	virtual bool RemoveDialogueParticipant(const TScriptInterface<IMounteaDialogueParticipantInterface>& NewParticipant);
 	virtual void ClearDialogueParticipants();
+
+	FMounteaDialogueDecoratorCache& GetDecoratorCache()
+	{ return DecoratorCache; };
+
+	/**
+	 * Invalidates cached Evaluation results of Decorators depending on given Key.
+	 * Decorators depending on any parent Tag of the Key are invalidated as well.
+	 * Should be called whenever World fact represented by the Key changes during Dialogue.
+	 *
+	 * @param Key	Gameplay Tag representing changed World fact.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Context", meta=(CustomTag="MounteaK2Setter"))
+	void InvalidateDecoratorCacheKey(const FGameplayTag& Key);
+
+	/**
+	 * Drops all cached Decorator Evaluation results of this Dialogue session.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Context", meta=(CustomTag="MounteaK2Setter"))
+	void ClearDecoratorCache();
+
+	/**
+	 * Returns hit and miss counters of Decorator Evaluation cache of this Dialogue session.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Context", meta=(CustomTag="MounteaK2Getter"))
+	FMounteaDialogueDecoratorCacheStats GetDecoratorCacheStats() const
+	{ return DecoratorCache.GetStats(); };
+
+	/**
+	 * Returns Random Stream of this Dialogue session.
+	 * Randomized Decorators should draw from this Stream so sessions can be recorded and replayed deterministically.
+	 */
+	FRandomStream& GetDialogueRandomStream()
+	{ return DialogueRandomStream; };
+
+	/**
+	 * Returns Seed of Random Stream of this Dialogue session.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Context", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetDialogueRandomSeed() const
+	{ return DialogueRandomStream.GetInitialSeed(); };
+
+	/**
+	 * Re-seeds Random Stream of this Dialogue session.
+	 *
+	 * @param NewSeed	Seed to initialize the Stream with.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Context", meta=(CustomTag="MounteaK2Setter"))
+	void SetDialogueRandomSeed(const int32 NewSeed)
+	{ DialogueRandomStream.Initialize(NewSeed); };
 		
 	/**
 	 * Sets the dialogue context.
@@ -276,6 +326,12 @@ private:
 	virtual void GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual bool IsSupportedForNetworking() const override {return true;};
 
+	// Cached Decorator Evaluation results, never replicated
+	FMounteaDialogueDecoratorCache DecoratorCache;
+
+	// Random Stream of this session, never replicated
+	FRandomStream DialogueRandomStream = FRandomStream(FMath::Rand());
+
 public:
 
 	UMounteaDialogueContext* operator += (const UMounteaDialogueContext* Other);
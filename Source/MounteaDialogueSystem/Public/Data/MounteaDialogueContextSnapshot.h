@@ -0,0 +1,49 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UMounteaDialogueContext;
+
+/**
+ * Read-only copy of Dialogue Context state.
+ * Created on Game Thread and passed to pure Decorators, which might be evaluated on worker threads.
+ * Contains no UObject references, so it is safe to read from any thread.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueContextSnapshot
+{
+	FMounteaDialogueContextSnapshot() = default;
+	explicit FMounteaDialogueContextSnapshot(const UMounteaDialogueContext* Context);
+
+	// Whether snapshot was created from valid Dialogue Context
+	bool bIsValid = false;
+
+	// GUID of Active Node, invalid if there is none
+	FGuid ActiveNodeGuid;
+
+	// GUID of Graph the Active Node belongs to, invalid if there is none
+	FGuid ActiveGraphGuid;
+
+	FGuid PreviousActiveNodeGuid;
+
+	int32 ActiveDialogueRowDataIndex = INDEX_NONE;
+
+	// Tags of all Dialogue Participants
+	FGameplayTagContainer ParticipantTags;
+
+	/**
+	 * Returns how many times the Node has been traversed within the Dialogue session.
+	 * 0 if Node has not been traversed at all.
+	 */
+	int32 GetTraverseCount(const FGuid& NodeGuid, const FGuid& GraphGuid) const;
+
+	bool HasNodeBeenTraversed(const FGuid& NodeGuid, const FGuid& GraphGuid) const
+	{ return GetTraverseCount(NodeGuid, GraphGuid) > 0; };
+
+private:
+
+	// (Node GUID, Graph GUID) x Traverse Count
+	TMap<TPair<FGuid, FGuid>, int32> TraverseCounts;
+};
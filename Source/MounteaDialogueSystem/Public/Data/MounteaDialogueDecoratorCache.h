@@ -0,0 +1,88 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "MounteaDialogueDecoratorCache.generated.h"
+
+/**
+ * Statistics of Decorator Evaluation cache of single Dialogue session.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaDialogueDecoratorCacheStats
+{
+	GENERATED_BODY()
+
+	// Evaluations answered from cache
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue")
+	int32 Hits = 0;
+
+	// Evaluations of cacheable Decorators which had to run 'EvaluateDecorator'
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue")
+	int32 Misses = 0;
+
+	// Number of cacheable Decorators evaluated within the session
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue")
+	int32 CachedDecorators = 0;
+
+	FString ToString() const
+	{
+		const int32 Total = Hits + Misses;
+		return FString::Printf(TEXT("Hits: %d | Misses: %d | Hit Rate: %.1f%% | Cached Decorators: %d"),
+			Hits, Misses, Total > 0 ? 100.f * Hits / Total : 0.f, CachedDecorators);
+	}
+};
+
+/**
+ * Evaluation results of cacheable Decorators within single Dialogue session.
+ * 
+ * Each dependency (Gameplay Tag, traversal state, participants) has its own epoch, which is increased on invalidation.
+ * Result is reused while sum of epochs of Decorator dependencies stays the same as at the time of Evaluation.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueDecoratorCache
+{
+public:
+
+	/**
+	 * Evaluates the Decorator, reusing cached result if none of its dependencies was invalidated since.
+	 * Decorators which are not cacheable are always evaluated.
+	 */
+	bool EvaluateDecorator(UMounteaDialogueDecoratorBase* Decorator);
+
+	// Invalidates Decorators depending on the Tag or any of its parent Tags.
+	void InvalidateTag(const FGameplayTag& Tag);
+
+	void InvalidateTraversal()
+	{ ++TraversalEpoch; };
+
+	void InvalidateParticipants()
+	{ ++ParticipantsEpoch; };
+
+	// Drops all cached results and declared dependencies, counters are kept
+	void Reset();
+
+	FMounteaDialogueDecoratorCacheStats GetStats() const
+	{ return Stats; };
+
+private:
+
+	uint64 GetDependenciesEpoch(const FMounteaDialogueDecoratorDependencies& Dependencies) const;
+
+	struct FCachedEvaluation
+	{
+		FMounteaDialogueDecoratorDependencies Dependencies;
+		uint64 Epoch = 0;
+		bool bHasResult = false;
+		bool bResult = false;
+	};
+
+	TMap<TObjectKey<UMounteaDialogueDecoratorBase>, FCachedEvaluation> Evaluations;
+	TMap<FGameplayTag, uint32> TagEpochs;
+	uint32 TraversalEpoch = 0;
+	uint32 ParticipantsEpoch = 0;
+
+	FMounteaDialogueDecoratorCacheStats Stats;
+};
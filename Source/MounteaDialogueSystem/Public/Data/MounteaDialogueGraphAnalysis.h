@@ -0,0 +1,90 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MounteaDialogueGraphAnalysis.generated.h"
+
+class UMounteaDialogueGraph;
+
+/**
+ * Precomputed structure of Dialogue Graph.
+ * Created on save or cook, so runtime doesn't need to walk Children Nodes to answer reachability or depth queries.
+ * Edges include both Children Nodes and 'Return To Node' jumps.
+ *
+ * All per-Node arrays are indexed the same way as 'NodeGuids'.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueGraphAnalysis
+{
+	GENERATED_BODY()
+
+	// GUIDs of analysed Nodes, in order of Graph 'AllNodes'
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	TArray<FGuid> NodeGuids;
+
+	// Shortest distance from Start Node. INDEX_NONE for unreachable Nodes.
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	TArray<int32> Depths;
+
+	// Longest path to any leaf Node, each cycle counts as single step
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	TArray<int32> RemainingDepths;
+
+	// Index of strongly connected component of each Node
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	TArray<int32> Components;
+
+	// Sorted components which form a cycle
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	TArray<int32> CyclicComponents;
+
+	// Node index of immediate dominator. INDEX_NONE for Start Node and unreachable Nodes.
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	TArray<int32> ImmediateDominators;
+
+	// Longest path from Start Node, each cycle counts as single step
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	int32 MaxDepth = 0;
+
+	// Hash of analysed edges and Start Node, so rewired Graph is not mistaken for analysed one
+	UPROPERTY(VisibleAnywhere, Category="Mountea|Dialogue|Analysis")
+	uint32 EdgesHash = 0;
+
+public:
+
+	/**
+	 * Analyses given Graph.
+	 * Runs in linear time for reachability, components and depths, dominators converge in few passes for dialogue-like graphs.
+	 */
+	static FMounteaDialogueGraphAnalysis Analyze(const UMounteaDialogueGraph* Graph);
+
+	// Whether analysis matches Nodes and edges of given Graph
+	bool IsUpToDate(const UMounteaDialogueGraph* Graph) const;
+
+	bool IsEmpty() const
+	{ return NodeGuids.Num() == 0; };
+
+	// Rebuilds transient GUID lookup, must be called after analysis is loaded
+	void BuildLookup();
+
+	// Returns Node index, INDEX_NONE if Node was not analysed
+	int32 FindNodeIndex(const FGuid& NodeGuid) const;
+
+	bool IsReachable(const int32 NodeIndex) const
+	{ return Depths.IsValidIndex(NodeIndex) && Depths[NodeIndex] != INDEX_NONE; };
+
+	bool IsInCycle(const int32 NodeIndex) const;
+
+	// Whether every path from Start Node to 'NodeIndex' passes through 'DominatorIndex'
+	bool Dominates(const int32 DominatorIndex, const int32 NodeIndex) const;
+
+	// Returns GUIDs of Nodes which cannot be reached from Start Node
+	TArray<FGuid> GetDeadNodes() const;
+
+	FString ToString() const;
+
+private:
+
+	TMap<FGuid, int32> NodeIndices;
+};
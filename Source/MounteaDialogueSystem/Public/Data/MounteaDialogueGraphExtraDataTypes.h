@@ -58,4 +58,38 @@ struct FDialogueImportSourceData
 	// Asset Path x Source Data
 	UPROPERTY(VisibleAnywhere, meta=(NoResetToDefault), Category="Import")
 	TMap<FString,FDialogueImportData> ImportData;
-};
\ No newline at end of file
+};
+
+/**
+ * Hashes of imported Dialogue content.
+ * Reimport compares them with new source to update only changed assets.
+ */
+USTRUCT()
+struct FDialogueImportHashes
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, meta=(NoResetToDefault), Category="Import")
+	uint32 CategoriesHash = 0;
+
+	UPROPERTY(VisibleAnywhere, meta=(NoResetToDefault), Category="Import")
+	uint32 ParticipantsHash = 0;
+
+	UPROPERTY(VisibleAnywhere, meta=(NoResetToDefault), Category="Import")
+	uint32 EdgesHash = 0;
+
+	// Node GUID x Node source hash
+	UPROPERTY(VisibleAnywhere, meta=(NoResetToDefault), Category="Import")
+	TMap<FGuid, uint32> NodeHashes;
+
+	// Node GUID x Dialogue Rows source hash
+	UPROPERTY(VisibleAnywhere, meta=(NoResetToDefault), Category="Import")
+	TMap<FGuid, uint32> RowHashes;
+
+	// Row Data GUID x audio file hash
+	UPROPERTY(VisibleAnywhere, meta=(NoResetToDefault), Category="Import")
+	TMap<FGuid, uint32> AudioHashes;
+
+	bool IsEmpty() const
+	{ return NodeHashes.Num() == 0; };
+};
@@ -0,0 +1,78 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+
+class UMounteaDialogueGraph;
+
+/**
+ * Versions of Dialogue save format.
+ * Add new versions before 'LatestPlusOne' and handle older ones in 'FMounteaDialogueSaveSerializer::Read'.
+ */
+enum class EMounteaDialogueSaveVersion : uint16
+{
+	Invalid = 0,
+	// Per-Graph records with GUID remap table and packed Node indices
+	Initial = 1,
+
+	LatestPlusOne,
+	Latest = LatestPlusOne - 1
+};
+
+/**
+ * Persistent Dialogue state of single Participant.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSaveState
+{
+	TArray<FDialogueTraversePath> TraversedPath;
+
+	// Graph and Node to start Dialogue from, invalid if none is saved
+	FGuid StartingGraphGuid;
+	FGuid StartingNodeGuid;
+};
+
+/**
+ * Serializes Dialogue save state to compact binary format.
+ *
+ * Data are grouped by Graph. Each Graph record stores GUIDs of referenced Nodes only once in remap table,
+ * traverse counts and Starting Node then use packed indices to that table instead of full GUIDs.
+ * 
+ * Layout:
+ * * Magic, Version
+ * * Packed Graph count, then for each Graph:
+ *   * Graph GUID, Flags
+ *   * Packed Node count, Node GUIDs
+ *   * Packed Traversed Node count, pairs of packed Node index and packed Traverse Count
+ *   * Packed Starting Node index, only if flagged
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSaveSerializer
+{
+public:
+
+	static constexpr uint32 Magic = 0x4D445356; // "MDSV"
+
+	enum EGraphFlags : uint8
+	{
+		GF_None				= 0,
+		GF_HasStartingNode	= 1 << 0
+	};
+
+	static void Write(const FMounteaDialogueSaveState& State, TArray<uint8>& OutBytes);
+
+	/**
+	 * Reads save state written by any supported version.
+	 * 
+	 * @return False if data are corrupted or written by newer version, OutState is left empty in such case.
+	 */
+	static bool Read(const TArray<uint8>& Bytes, FMounteaDialogueSaveState& OutState);
+
+	/**
+	 * Migrates save state to current version of Graph.
+	 * Drops Traversed Nodes and Starting Node which no longer exist in the Graph, state of other Graphs is kept.
+	 * 
+	 * @return Number of dropped entries.
+	 */
+	static int32 MigrateToGraph(FMounteaDialogueSaveState& State, UMounteaDialogueGraph* Graph);
+};
@@ -0,0 +1,74 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "MounteaDialogueSessionSnapshot.generated.h"
+
+class UMounteaDialogueGraph;
+
+/**
+ * What the Dialogue was doing once snapshot was taken.
+ */
+UENUM(BlueprintType)
+enum class EMounteaDialogueSessionStage : uint8
+{
+	// Dialogue Row was shown and its timer was running
+	EMDSS_PlayingRow		UMETA(DisplayName="Playing Row"),
+	// Dialogue Row was shown and waited for input to continue
+	EMDSS_AwaitingInput		UMETA(DisplayName="Awaiting Input"),
+	// Dialogue Options were shown and waited for selection
+	EMDSS_AwaitingSelection	UMETA(DisplayName="Awaiting Selection"),
+
+	Default					UMETA(hidden)
+};
+
+/**
+ * Snapshot of active Dialogue session.
+ * Allows to resume Dialogue directly in Active state, without running Start Dialogue, Prepare Node and Node Decorators again.
+ *
+ * ❔ Participants are stored by their Tags, so Participants do not need to survive Server travel, only their Tags must match
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSessionSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	TSoftObjectPtr<UMounteaDialogueGraph> DialogueGraph;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	FGuid ActiveNodeGuid;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	FGuid PreviousActiveNodeGuid;
+
+	// Options available from Active Node, stored so Decorators don't need to be evaluated again
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	TArray<FGuid> AllowedChildNodeGuids;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	int32 ActiveDialogueRowDataIndex = 0;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	EMounteaDialogueSessionStage SessionStage = EMounteaDialogueSessionStage::Default;
+
+	// Remaining time of Dialogue Row timer, only used while playing Row
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot", meta=(Units="Seconds"))
+	float RowTimeRemaining = 0.f;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	FGameplayTag MainParticipantTag;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	FGameplayTag ActiveParticipantTag;
+
+	// Nodes traversed within this session, not yet saved to Participants
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Snapshot")
+	TArray<FDialogueTraversePath> TraversedPath;
+
+	bool IsValid() const
+	{ return !DialogueGraph.IsNull() && ActiveNodeGuid.IsValid() && SessionStage != EMounteaDialogueSessionStage::Default; };
+};
@@ -0,0 +1,65 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+#include "Cooker/CookPackageSplitter.h"
+
+class UDataTable;
+class UMounteaDialogueGraph;
+
+/**
+ * Splits shared Dialogue Data Tables per Graph when cooking.
+ *
+ * Every Data Table property of Graph objects which is paired with 'RowName' property (Dialogue Nodes, Override Decorators) is collected.
+ * Each referenced Table gets its own generated package next to the Graph, containing only referenced Rows, and cooked Graph references it instead,
+ * so unreferenced Rows and Sounds they hard-reference are not loaded with the Graph.
+ * Generated packages keep Text namespace of source Table package, so localization keys of Rows are not changed by split.
+ * References are redirected only for the time Cooker saves the Graph and restored on teardown, so source assets are never modified.
+ *
+ * Tables referenced without 'RowName', or by objects with more than one Table property, cannot be split, as there is no way to tell which Rows are used.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueTableSplitter : public ICookPackageSplitter
+{
+public:
+
+	// ICookPackageSplitter
+	static bool ShouldSplit(UObject* SplitData);
+	static FString GetSplitterDebugName() { return TEXT("FMounteaDialogueTableSplitter"); }
+
+	virtual TArray<ICookPackageSplitter::FGeneratedPackage> GetGenerateList(const UPackage* OwnerPackage, const UObject* OwnerObject) override;
+	virtual bool PopulateGeneratorPackage(ICookPackageSplitter::FPopulateContext& PopulateContext) override;
+	virtual bool PopulateGeneratedPackage(ICookPackageSplitter::FPopulateContext& PopulateContext) override;
+	virtual void Teardown(ETeardown Status) override;
+	// End of ICookPackageSplitter
+
+private:
+
+	struct FSplitTable
+	{
+		TWeakObjectPtr<UDataTable> SourceTable;
+		TArray<FName> Rows;
+		TArray<TPair<TWeakObjectPtr<UObject>, const FObjectProperty*>> References;
+	};
+
+	struct FReplacedReference
+	{
+		TWeakObjectPtr<UObject> Owner;
+		const FObjectProperty* Property = nullptr;
+		TWeakObjectPtr<UDataTable> OriginalTable;
+	};
+
+	// Returns split Table within generated package, creates it if it does not exist yet
+	static UDataTable* FindOrCreateSplitTable(UPackage* TargetPackage, const FSplitTable& SplitTable);
+
+	// Split Tables by relative path of their generated package
+	TMap<FString, FSplitTable> SplitTables;
+
+	// Graph references redirected to split Tables, restored on teardown
+	TArray<FReplacedReference> ReplacedReferences;
+};
+
+#endif
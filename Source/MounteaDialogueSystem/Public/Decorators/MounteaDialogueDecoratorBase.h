@@ -5,7 +5,9 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "Engine/Level.h"
+#include "GameplayTagContainer.h"
 #include "Interfaces/Core/MounteaDialogueTickableObject.h"
+#include "Data/MounteaDialogueContextSnapshot.h"
 #include "MounteaDialogueDecoratorBase.generated.h"
 
 class IMounteaDialogueManagerInterface;
@@ -18,6 +20,32 @@ enum class EDecoratorState : uint8
 	Initialized
 };
 
+/**
+ * Describes what the Decorator Evaluation result depends on.
+ * Results of cacheable Decorators are reused within Dialogue session until any of the dependencies is invalidated.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaDialogueDecoratorDependencies
+{
+	GENERATED_BODY()
+
+	// Whether Evaluation result can be reused. Otherwise Decorator is evaluated every time.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Decorator")
+	bool bCacheable = false;
+
+	// World facts the result depends on. Invalidated by Dialogue Context 'InvalidateDecoratorCacheKey'.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Decorator", meta=(EditCondition="bCacheable"))
+	FGameplayTagContainer DependencyTags;
+
+	// Result depends on Active Node or Traversed Path, invalidated each time Dialogue moves.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Decorator", meta=(EditCondition="bCacheable"))
+	bool bDependsOnTraversal = false;
+
+	// Result depends on Dialogue Participants, invalidated once Participants are added or removed.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Mountea|Dialogue|Decorator", meta=(EditCondition="bCacheable"))
+	bool bDependsOnParticipants = false;
+};
+
 #define LOCTEXT_NAMESPACE "NodeDecoratorBase"
 
 /**
@@ -131,6 +159,43 @@ public:
 	bool EvaluateDecorator();
 	virtual bool EvaluateDecorator_Implementation();
 
+	/**
+	 * Declares what the result of 'EvaluateDecorator' depends on.
+	 * Cacheable Decorators are evaluated again only once any of declared dependencies is invalidated.
+	 * Called once per Dialogue session. Not cacheable by default.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Mountea|Dialogue|Decorator")
+	FMounteaDialogueDecoratorDependencies GetEvaluationDependencies() const;
+	virtual FMounteaDialogueDecoratorDependencies GetEvaluationDependencies_Implementation() const
+	{ return FMounteaDialogueDecoratorDependencies(); };
+
+	/**
+	 * Evaluates the Decorator through Evaluation cache of active Dialogue Context.
+	 * Falls back to 'EvaluateDecorator' if there is no Dialogue Context.
+	 */
+	bool EvaluateDecoratorCached();
+
+	/**
+	 * Declares that 'EvaluatePure' reads nothing but given Context snapshot and immutable Decorator data.
+	 * Pure Decorators of sibling Nodes are evaluated in parallel on worker threads.
+	 * Override only in native Decorators, Blueprint Decorators are never evaluated as pure.
+	 */
+	virtual bool IsPureDecorator() const
+	{ return false; };
+
+	/**
+	 * Thread-safe Evaluation of pure Decorator.
+	 * Might be called from worker threads, so it must not modify any UObject, call Blueprint events or access Dialogue Context.
+	 */
+	virtual bool EvaluatePure(const FMounteaDialogueContextSnapshot& Snapshot) const
+	{ return true; };
+
+	/**
+	 * Returns whether this Decorator can be evaluated through 'EvaluatePure'.
+	 * Requires pure native class, Blueprint children of pure Decorators are not considered pure.
+	 */
+	bool CanEvaluatePure() const;
+
 	/**
 	 * Executes the Decorator.
 	 * Useful for triggering special events per Node, for instance, switching dialogue cameras.
@@ -212,6 +277,21 @@ public:
 
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Mountea|Dialogue|Decorator")
 	TSet<TSubclassOf<UMounteaDialogueGraphNode>> GetBlacklistedNodeTypes() const;
+
+	/**
+	 * Returns declared relative cost of 'EvaluateDecorator'.
+	 * Cheaper Decorators are evaluated first.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Decorator", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetEvaluationCost() const
+	{ return EvaluationCost; };
+
+	/**
+	 * Returns Execution priority. Decorators with higher priority are executed first.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Decorator", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetExecutionPriority() const
+	{ return ExecutionPriority; };
 	
 protected:
 
@@ -238,6 +318,22 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category="Private")
 	TSet<TSoftClassPtr<UMounteaDialogueGraphNode>> BlacklistedNodes;
 
+	/**
+	 * Relative cost of 'EvaluateDecorator'.
+	 * Decorators are evaluated from the cheapest and Evaluation stops at first failing Decorator,
+	 * so expensive queries (inventory, quests) should declare higher cost than simple checks.
+	 * ❔ Use 'Mountea.Dialogue.ProfileDecorators' to measure real costs
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, AdvancedDisplay, Category="Mountea|Dialogue|Decorator", meta=(UIMin=0, ClampMin=0))
+	int32 EvaluationCost = 1;
+
+	/**
+	 * Decorators with higher priority are executed first.
+	 * Decorators with the same priority keep their order, Node Decorators before Graph ones.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, AdvancedDisplay, Category="Mountea|Dialogue|Decorator")
+	int32 ExecutionPriority = 0;
+
 	UPROPERTY()
 	EDecoratorState	DecoratorState	=	EDecoratorState::Uninitialized;
 
@@ -34,6 +34,15 @@ public:
 	virtual bool EvaluateDecorator_Implementation() override;
 	virtual void ExecuteDecorator_Implementation() override;
 	virtual bool IsDecoratorAllowedForGraph_Implementation() const override {  return false;  };
+	virtual FMounteaDialogueDecoratorDependencies GetEvaluationDependencies_Implementation() const override
+	{
+		// Result changes only once Dialogue moves or Participants change
+		FMounteaDialogueDecoratorDependencies Dependencies;
+		Dependencies.bCacheable = true;
+		Dependencies.bDependsOnTraversal = true;
+		Dependencies.bDependsOnParticipants = true;
+		return Dependencies;
+	};
 
 	virtual  FString GetDecoratorDocumentationLink_Implementation() const override
 	{ return TEXT("https://github.com/Mountea-Framework/MounteaDialogueSystem/wiki/Decorator:-Only-First-Time-Base"); }
@@ -9,6 +9,7 @@
 #include "Decorators/MounteaDialogueDecoratorBase.h"
 #include "Interfaces/Core/MounteaDialogueTickableObject.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
+#include "Data/MounteaDialogueGraphAnalysis.h"
 
 #if WITH_EDITORONLY_DATA
 #include "Data/MounteaDialogueGraphExtraDataTypes.h"
@@ -29,6 +30,22 @@ class UMounteaDialogueGraphEdge;
 
 struct FMounteaDialogueDecorator;
 
+#if WITH_EDITOR
+/**
+ * Cached result of single Node validation.
+ * Stays valid as long as Node Validation Hash does not change.
+ */
+struct FMounteaDialogueNodeValidationResult
+{
+	uint32 ValidationHash = 0;
+	bool bRichTextFormat = false;
+	bool bIsValid = true;
+
+	TArray<FText> Errors;
+	TArray<FText> Warnings;
+};
+#endif
+
 
 /**
  * Mountea Dialogue Graph.
@@ -82,6 +99,13 @@ protected:
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Mountea|Dialogue", meta=(NoResetToDefault))
 	FGuid GraphGUID;
 
+	/**
+	 * Reachability, cycles, dominators and depths of Graph Nodes.
+	 * Updated every time Graph is saved or cooked.
+	 */
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category = "Mountea|Dialogue", meta=(NoResetToDefault))
+	FMounteaDialogueGraphAnalysis GraphAnalysis;
+
 public:
 	
 	// Pointer to the starting node of the dialogue graph.
@@ -196,6 +220,43 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Getter"))
 	TArray<FMounteaDialogueDecorator> GetAllDecorators() const;
 
+	/**
+	 * Returns precomputed structure of this Graph.
+	 * ❗ Might be out of date for Graphs which have not been saved since their last change
+	 */
+	const FMounteaDialogueGraphAnalysis& GetGraphAnalysis() const
+	{ return GraphAnalysis; };
+
+	/**
+	 * Returns whether Node can be reached from Start Node.
+	 * Uses precomputed Graph Analysis.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Validate"))
+	bool IsNodeReachable(const UMounteaDialogueGraphNode* Node) const;
+
+	/**
+	 * Returns whether Node is part of cycle, for instance created by 'Return To Node'.
+	 * Uses precomputed Graph Analysis.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Validate"))
+	bool IsNodeInCycle(const UMounteaDialogueGraphNode* Node) const;
+
+	/**
+	 * Returns longest path from Node to any leaf Node, each cycle counts as single step.
+	 * Returns INDEX_NONE for Nodes which have not been analysed.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetNodeRemainingDepth(const UMounteaDialogueGraphNode* Node) const;
+
+	/**
+	 * Returns GUIDs of Nodes which cannot be reached from Start Node.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Graph", meta=(CustomTag="MounteaK2Getter"))
+	TArray<FGuid> GetDeadNodes() const;
+
+	// Analyses Graph again and stores results
+	void UpdateGraphAnalysis();
+
 	/**
 	 * Determines whether the dialogue graph can be started.
 	 * 
@@ -227,6 +288,7 @@ public:
 	}
 	
 	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
 
 #pragma endregion
 
@@ -262,6 +324,12 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "Mountea|Import", meta=(TitleProperty="Json file: {JsonFile}", NoResetToDefault, ShowOnlyInnerProperties))
 	TArray<FDialogueImportData> SourceData;
 
+	/**
+	 * Hashes of imported source, used to reimport only changed Nodes, Rows and audio.
+	 */
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category = "Mountea|Import", meta=(NoResetToDefault))
+	FDialogueImportHashes ImportHashes;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Mountea|Dialogue|Editor")
 	bool bCanRenameNode;
 
@@ -275,6 +343,8 @@ public:
 #if WITH_EDITOR
 
 	virtual bool ValidateGraph(FDataValidationContext& Context, bool RichTextFormat) const;
+	// Validates Graph Decorators and Start Node, without validating all Nodes
+	virtual bool ValidateGraphScope(FDataValidationContext& Context, bool RichTextFormat) const;
 	virtual bool ValidateDecorators(FDataValidationContext& Context, bool RichTextFormat, const TArray<FMounteaDialogueDecorator>& Decorators, const FString& DecoratorTypeName) const;
 	virtual bool ValidateGraphDecorators(FDataValidationContext& Context, bool RichTextFormat, const TArray<FMounteaDialogueDecorator>& Decorators, const FString& DecoratorTypeName) const;
 	virtual bool ValidateStartNode(FDataValidationContext& Context, bool RichTextFormat) const;
@@ -284,6 +354,39 @@ public:
 	virtual void AddDuplicateDecoratorErrors(FDataValidationContext& Context, bool RichTextFormat, const TMap<UMounteaDialogueDecoratorBase*, int32>& DuplicatedDecoratorsMap, const FString& DecoratorTypeName) const;
 	virtual void AddDecoratorErrors(FDataValidationContext& Context, bool RichTextFormat, const TArray<FText>& DecoratorErrors, const FString& DecoratorTypeName) const;
 	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) override;
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+	// Warns about Nodes which cannot be reached from Start Node
+	virtual bool ValidateReachability(FDataValidationContext& Context, bool RichTextFormat) const;
+
+	/**
+	 * Writes hidden Search Index Tag, so Dialogue Search can query Dialogues without loading them.
+	 * Each line represents one Node: GUID, Title, Type, Row Name, Decorators and Row texts, separated by tabulator.
+	 */
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+
+	static FName GetSearchIndexTagName()
+	{ return FName(TEXT("MounteaDialogueSearchIndex")); };
+
+	/**
+	 * Validates single Node, unless it has not changed since its last validation.
+	 * Cached issues are added to Context in such case.
+	 *
+	 * @param Node				Node to validate.
+	 * @param Context			Context to add issues to.
+	 * @param RichTextFormat	Whether issues should be Rich Text formatted.
+	 * @param bOutCacheHit		Whether cached result has been used.
+	 * @return Whether Node is valid.
+	 */
+	bool ValidateNodeCached(const UMounteaDialogueGraphNode* Node, FDataValidationContext& Context, bool RichTextFormat, bool& bOutCacheHit) const;
+
+	// Forces next validation to validate all Nodes
+	void ResetValidationCache() const
+	{ NodeValidationCache.Empty(); };
+
+private:
+
+	// Validation results keyed by Node GUID, only accessed from Game Thread
+	mutable TMap<FGuid, FMounteaDialogueNodeValidationResult> NodeValidationCache;
 
 public:
 	// Construct and initialize a node within this Dialogue.
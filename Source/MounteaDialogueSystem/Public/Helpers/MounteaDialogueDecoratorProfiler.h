@@ -0,0 +1,60 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMounteaDialogueDecoratorBase;
+
+/**
+ * Timing of single Decorator class collected by Decorator Profiler.
+ */
+struct FMounteaDialogueDecoratorTiming
+{
+	FString DecoratorClass;
+
+	int32 Evaluations = 0;
+	int32 Failures = 0;
+	// Evaluations skipped, because cheaper Decorator of the same Node failed first
+	int32 Skipped = 0;
+
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+
+	// Sum of declared Evaluation Costs, used to report average declared cost
+	int64 DeclaredCostSum = 0;
+
+	double GetAverageMs() const
+	{ return Evaluations > 0 ? TotalMs / Evaluations : 0.0; };
+};
+
+/**
+ * Collects per-Decorator Evaluation timings to help tuning Decorator Evaluation Costs.
+ * 
+ * Disabled by default, enabled by 'Mountea.Dialogue.ProfileDecorators 1'.
+ * Report is printed by 'Mountea.Dialogue.DumpDecoratorTimings' and cleared by 'Mountea.Dialogue.ResetDecoratorTimings'.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueDecoratorProfiler
+{
+public:
+
+	static FMounteaDialogueDecoratorProfiler& Get();
+
+	static bool IsEnabled();
+
+	void RecordEvaluation(const UMounteaDialogueDecoratorBase* Decorator, double DurationMs, bool bResult);
+	void RecordSkipped(const UMounteaDialogueDecoratorBase* Decorator);
+
+	// Returns timings sorted by total time, most expensive first
+	TArray<FMounteaDialogueDecoratorTiming> GetTimings() const;
+
+	void Reset();
+	void DumpReport() const;
+
+private:
+
+	FMounteaDialogueDecoratorTiming& FindOrAddTiming(const UMounteaDialogueDecoratorBase* Decorator);
+
+	mutable FCriticalSection TimingsLock;
+	TMap<FName, FMounteaDialogueDecoratorTiming> Timings;
+};
@@ -46,6 +46,31 @@ struct FWidgetAdditionParams
 	}
 };
 
+/**
+ * Precompiled form of Dialogue Row text.
+ * Text is split into literal segments and variable slots, so substitution is a simple concatenation.
+ * Slots are written as '{VariableName}' in source text.
+ * ❔ Literals always contain one more entry than Slots
+ */
+USTRUCT(BlueprintType)
+struct FMounteaDialogueTextTemplate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Helpers|UI")
+	TArray<FString> Literals;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Helpers|UI")
+	TArray<FString> Slots;
+
+	// Summed length of all Literals, used to reserve resolved string
+	UPROPERTY()
+	int32 LiteralsLength = 0;
+
+	bool IsValid() const
+	{ return Literals.Num() == Slots.Num() + 1; };
+};
+
 /**
  * 
  */
@@ -114,6 +139,39 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Helpers|UI", meta=(CustomTag="MounteaK2Setter"))
 	static FText ReplaceRegexInText(const FString& Regex, const FText& Replacement, const FText& SourceText);
 
+	/**
+	 * Compiles text into Text Template.
+	 * Every '{VariableName}' token becomes a variable slot, everything else is kept as literal segment.
+	 * ❔ Compiled Templates are cached, compiling the same text again is just a lookup
+	 * 
+	 * @param SourceText The text to be compiled.
+	 * @return Compiled Text Template.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers|UI", meta=(CustomTag="MounteaK2Getter"))
+	static FMounteaDialogueTextTemplate CompileTextTemplate(const FText& SourceText);
+
+	/**
+	 * Resolves Text Template using provided variables.
+	 * Slots without matching variable are kept as '{VariableName}'.
+	 * 
+	 * @param Template The compiled Text Template.
+	 * @param Variables Map of variable names and their values.
+	 * @return Resolved text.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Helpers|UI", meta=(CustomTag="MounteaK2Getter"))
+	static FText ResolveTextTemplate(const FMounteaDialogueTextTemplate& Template, const TMap<FString, FText>& Variables);
+
+	/**
+	 * Replaces all '{VariableName}' tokens in text with provided variables.
+	 * Uses cached Text Template of source text, so no regex is evaluated.
+	 * 
+	 * @param SourceText The original text where the replacement will occur.
+	 * @param Variables Map of variable names and their values.
+	 * @return The modified text with the replacements applied.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Helpers|UI", meta=(CustomTag="MounteaK2Setter"))
+	static FText ReplaceTokensInText(const FText& SourceText, const TMap<FString, FText>& Variables);
+
 	/**
 	 * Gets the Z-order of the specified widget within the viewport or its parent container.
 	 *
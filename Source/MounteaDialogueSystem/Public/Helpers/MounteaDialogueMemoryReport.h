@@ -0,0 +1,112 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+class UMounteaDialogueGraph;
+
+/**
+ * Memory of single asset in transitive load set of reported Graphs.
+ */
+struct FMounteaDialogueAssetMemory
+{
+	FString AssetPath;
+	FString AssetClass;
+
+	// Asset object and all objects inside it
+	int64 Bytes = 0;
+
+	// How many reported Graphs load this asset, assets loaded by single Graph are exclusive to it
+	int32 ReferencingGraphs = 0;
+};
+
+/**
+ * Memory of single Data Table referenced by reported Graphs.
+ */
+struct FMounteaDialogueDataTableMemory
+{
+	FString DataTablePath;
+	int64 Bytes = 0;
+	int32 Rows = 0;
+
+	// Dialogue Row Data stored in 'FDialogueRow' sets and memory allocated by those sets
+	int32 RowData = 0;
+	int64 RowDataBytes = 0;
+
+	int32 ReferencingGraphs = 0;
+};
+
+/**
+ * Memory of single Dialogue Graph.
+ * Resident memory is everything loaded with the Graph, Exclusive part is loaded only by this Graph, Shared part by other reported Graphs too.
+ */
+struct FMounteaDialogueGraphMemory
+{
+	FString GraphPath;
+
+	int32 Nodes = 0;
+	int32 Edges = 0;
+	int32 Decorators = 0;
+
+	int64 GraphBytes = 0;
+	int64 NodeBytes = 0;
+	int64 EdgeBytes = 0;
+	int64 DecoratorBytes = 0;
+
+	// Objects which are stripped on cook, any such object found in cooked build is a leak
+	int32 EditorOnlyObjects = 0;
+	int64 EditorOnlyBytes = 0;
+
+	// Assets loaded together with the Graph, Graph itself excluded
+	TArray<FString> LoadSet;
+
+	int64 ResidentBytes = 0;
+	int64 ExclusiveBytes = 0;
+	int64 SharedBytes = 0;
+
+	// Sum of objects which are inside Graph asset
+	int64 GetOwnBytes() const
+	{ return GraphBytes + NodeBytes + EdgeBytes + DecoratorBytes; };
+};
+
+/**
+ * Computes memory footprint of Dialogue Graphs and their transitive asset load set.
+ * Graphs are added one by one, Exclusive and Shared memory is resolved across all added Graphs once report is finalized.
+ *
+ * Report of loaded Graphs is printed by 'Mountea.Dialogue.MemoryReport [PathFilter] [TopCount]',
+ * report of all Graphs in project by 'MounteaDialogueMemoryReport' commandlet.
+ */
+class MOUNTEADIALOGUESYSTEM_API FMounteaDialogueMemoryReport
+{
+public:
+
+	void AddGraph(const UMounteaDialogueGraph* Graph);
+
+	// Resolves Exclusive and Shared memory, has to be called once all Graphs are added
+	void Finalize();
+
+	void Print(FOutputDevice& Ar, int32 TopCount = 10) const;
+	TArray<FString> ToCSV() const;
+
+	const TArray<FMounteaDialogueGraphMemory>& GetGraphs() const
+	{ return Graphs; };
+
+	// Returns assets sorted by size, biggest first
+	TArray<FMounteaDialogueAssetMemory> GetBiggestAssets() const;
+
+	// Serialized memory of single object together with its resources, inner objects are not included
+	static int64 MeasureObject(const UObject* Object);
+
+private:
+
+	void MeasureAsset(UObject* Asset, TArray<UObject*>& OutReferencedAssets);
+	void MeasureDataTable(const UDataTable* DataTable);
+
+	TArray<FMounteaDialogueGraphMemory> Graphs;
+	TMap<FString, FMounteaDialogueAssetMemory> Assets;
+	TMap<FString, FMounteaDialogueDataTableMemory> DataTables;
+
+	bool bFinalized = false;
+};
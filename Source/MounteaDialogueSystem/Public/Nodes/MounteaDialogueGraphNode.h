@@ -96,6 +96,17 @@ private:
 	UPROPERTY(VisibleAnywhere, Category = "Mountea|Dialogue", AdvancedDisplay)
 	TObjectPtr<UWorld> OwningWorld;
 
+	// Node and inherited Graph Decorators sorted by Evaluation Cost, cheapest first
+	UPROPERTY(Transient)
+	TArray<FMounteaDialogueDecorator> EvaluationDecorators;
+
+	// Node and inherited Graph Decorators sorted by Execution Priority, highest first
+	UPROPERTY(Transient)
+	TArray<FMounteaDialogueDecorator> ExecutionDecorators;
+
+	// Whether sorted Decorators are up to date
+	bool bDecoratorsOrderValid = false;
+
 #pragma endregion
 
 #pragma region Editable
@@ -186,6 +197,12 @@ public:
 	void PreProcessNode(const TScriptInterface<IMounteaDialogueManagerInterface>& Manager);
 	virtual void PreProcessNode_Implementation(const TScriptInterface<IMounteaDialogueManagerInterface>& Manager);
 
+	/**
+	 * Registers this Node and its Decorators to tick within Manager's session.
+	 * Called once Node is pre-processed, or once restored Dialogue session resumes on this Node.
+	 */
+	void RegisterNodeTickables(const TScriptInterface<IMounteaDialogueManagerInterface>& Manager);
+
 	/**
 	 * Processes the dialogue node by evaluating the dialogue context and executing node logic.
 	 * This function broadcasts relevant events and checks for valid dialogue context, world, and graph ownership.
@@ -226,6 +243,31 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Mountea|Dialogue|Node", meta=(CustomTag="MounteaK2Validate"))
 	bool EvaluateDecorators() const;
 	virtual bool EvaluateDecorators_Implementation() const;
+
+	/**
+	 * Whether Allowed Child Nodes evaluation can bypass 'CanStartNode' and evaluate this Node's pure Decorators in parallel.
+	 * Native overrides of 'CanStartNode' or 'EvaluateDecorators' are invisible to reflection, so only Nodes native to Mountea Dialogue System are split by default.
+	 *❔ Native Nodes from other modules, which keep the default 'CanStartNode' logic, can override this to opt in.
+	 */
+	virtual bool CanSplitDecoratorEvaluation() const;
+
+	/**
+	 * Sorts Node and inherited Graph Decorators, so Evaluation and Execution don't need to sort them each time.
+	 * Called once Node is initialized. Should be called again if Decorators are changed at runtime.
+	 */
+	void UpdateDecoratorsOrder();
+
+	/**
+	 * Returns Node and inherited Graph Decorators in Evaluation order.
+	 * Cheapest Decorators come first, so Evaluation can stop before expensive ones are evaluated.
+	 */
+	TArray<FMounteaDialogueDecorator> GetEvaluationDecorators() const;
+
+	/**
+	 * Returns Node and inherited Graph Decorators in Execution order.
+	 * Decorators with higher Execution Priority come first, otherwise Node Decorators come before Graph ones.
+	 */
+	TArray<FMounteaDialogueDecorator> GetExecutionDecorators() const;
 	
 	/**
 	 * Returns whether this node inherits decorators from the dialogue graph.
@@ -498,6 +540,13 @@ public:
 	// Validation function responsible for generating user friendly validation messages
 	virtual bool ValidateNode(FDataValidationContext& Context, const bool RichFormat) const;
 
+	/**
+	 * Returns hash of all data Node validation depends on.
+	 * Graph uses it to skip validation of Nodes which have not changed since last validation.
+	 * ❔ Override if validation depends on data outside of Node and its Decorators
+	 */
+	virtual uint32 GetValidationHash() const;
+
 	// Once Node is pasted, this function is called
 	virtual void OnPasted();
 
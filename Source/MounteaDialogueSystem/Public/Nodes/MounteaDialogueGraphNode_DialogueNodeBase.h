@@ -123,6 +123,7 @@ protected:
 #if WITH_EDITOR
 	
 	virtual bool ValidateNode(FDataValidationContext& Context, const bool RichFormat) const override;
+	virtual uint32 GetValidationHash() const override;
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual FText GetDescription_Implementation() const override;
 	
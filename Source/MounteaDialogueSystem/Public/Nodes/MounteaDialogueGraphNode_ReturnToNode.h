@@ -60,6 +60,7 @@ protected:
 	
 	virtual FText GetNodeCategory_Implementation() const override;
 	virtual bool ValidateNode(FDataValidationContext& Context, const bool RichFormat) const override;
+	virtual uint32 GetValidationHash() const override;
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual FText GetDescription_Implementation() const override;
 	virtual FString GetNodeDocumentationLink_Implementation() const override
@@ -95,6 +95,78 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Subtitles")
 	TMap<FUIRowID, FSubtitlesSettings> SubtitlesSettingsOverrides;
 
+	/**
+	 * Whether assets of upcoming Dialogue Rows (voice lines, icons) should be streamed in ahead of time.
+	 * Once Node is prepared, all reachable Child Nodes are scanned and their assets are requested asynchronously.
+	 * ❔ Prevents hitches when Row with large voice file starts
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Streaming")
+	uint8 bPrefetchUpcomingRows : 1;
+
+	/**
+	 * How many Nodes ahead of the Active Node should be prefetched.
+	 * ❗ Higher the value higher the memory impact❗
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Streaming", meta=(EditCondition="bPrefetchUpcomingRows", UIMin=1, ClampMin=1, UIMax=4, ClampMax=8))
+	int32 PrefetchDepth = 1;
+
+	/**
+	 * Maximum memory prefetched audio data can keep resident per Dialogue.
+	 * Nodes closer to the Active Node are preferred once budget is reached.
+	 * ❔ Units: megabytes
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Streaming", meta=(EditCondition="bPrefetchUpcomingRows", UIMin=1, ClampMin=1, Units="Megabytes"))
+	int32 PrefetchMemoryBudget = 64;
+
+	/**
+	 * Async loading priority of prefetch requests.
+	 * ❔ Default is 'AsyncLoadHighPriority'
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Streaming", meta=(EditCondition="bPrefetchUpcomingRows"))
+	int32 PrefetchPriority = 100;
+
+	/**
+	 * Maximum time all Dialogue Tickable Objects can consume per frame.
+	 * Once exceeded, remaining Tickable Objects are deferred to next frame.
+	 * ❔ Units: milliseconds, 0 means unlimited
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Tick", meta=(UIMin=0.f, ClampMin=0.f, Units="Milliseconds"))
+	float TickBudget = 0.f;
+
+	/**
+	 * Distance at which Ambient Dialogue is promoted to full Environment Dialogue Manager.
+	 * ❔ Units: centimeters
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ambient", meta=(UIMin=0.f, ClampMin=0.f, Units="Centimeters"))
+	float AmbientPromotionDistance = 1500.f;
+
+	/**
+	 * Distance at which Promoted Ambient Dialogue is returned to simulation.
+	 * ❗ Should be higher than 'AmbientPromotionDistance' to avoid flickering❗
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ambient", meta=(UIMin=0.f, ClampMin=0.f, Units="Centimeters"))
+	float AmbientDemotionDistance = 2000.f;
+
+	/**
+	 * Maximum number of Ambient Dialogues played by full Dialogue Managers at once.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ambient", meta=(UIMin=0, ClampMin=0))
+	int32 MaxPromotedAmbientSessions = 4;
+
+	/**
+	 * How many Ambient Dialogues have their distance re-evaluated each frame.
+	 * ❗ Higher the value higher the performance impact❗
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ambient", meta=(UIMin=1, ClampMin=1))
+	int32 AmbientSignificanceUpdatesPerFrame = 32;
+
+	/**
+	 * How often Simulated Ambient Dialogues advance.
+	 * ❔ Units: seconds
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Ambient", meta=(UIMin=0.01f, ClampMin=0.01f, Units="seconds"))
+	float AmbientSimulationStep = 0.5f;
+
 protected:
 	
 #if WITH_EDITOR
@@ -72,6 +72,20 @@ protected:
 	UPROPERTY(config, EditDefaultsOnly, Category = "Subtitles")
 	TMap<FUIRowID, FSubtitlesSettings> SubtitlesSettingsOverrides;
 
+	/**
+	 * Whether Dialogue Data Tables should be split per Graph when cooking.
+	 * Each Graph gets its own Table containing only Rows it references, so unreferenced Rows and their Sounds are not loaded with it.
+	 * ❔ Source Tables are not modified, split happens only in cooked data
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Cooking")
+	uint8 bSplitDialogueTablesOnCook : 1;
+
+	/**
+	 * Tables with fewer Rows are not split, sharing small Tables is cheaper than duplicating their Rows per Graph.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Cooking", meta=(EditCondition="bSplitDialogueTablesOnCook", UIMin=0, ClampMin=0))
+	int32 SplitDialogueTablesMinRows = 64;
+
 #if WITH_EDITOR
 	virtual FText GetSectionText() const override
 	{
@@ -178,9 +192,73 @@ public:
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
 	float GetSkipDuration() const;
+
+	/**
+	 * Returns whether assets of upcoming Dialogue Rows are streamed in ahead of time.
+	 * 
+	 * @return True if prefetching is enabled, false otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Validate"))
+	bool IsRowPrefetchEnabled() const;
+
+	/**
+	 * Returns how many Nodes ahead of the Active Node are prefetched.
+	 * 
+	 * @return Depth of prefetching, at least 1.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetPrefetchDepth() const;
+
+	/**
+	 * Returns memory budget of prefetched audio data per Dialogue.
+	 * 
+	 * @return Budget in megabytes.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetPrefetchMemoryBudget() const;
+
+	/**
+	 * Returns async loading priority used by prefetch requests.
+	 * 
+	 * @return Streamable Manager priority.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetPrefetchPriority() const;
+
+	/**
+	 * Returns per-frame budget of Dialogue Tick.
+	 * 
+	 * @return Budget in milliseconds, 0 means unlimited.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	float GetDialogueTickBudget() const;
+
+	/**
+	 * Returns whether Dialogue Data Tables are split per Graph when cooking.
+	 * 
+	 * @return True if splitting is enabled, false otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Validate"))
+	bool IsDialogueTableSplitEnabled() const
+	{ return bSplitDialogueTablesOnCook; };
+
+	/**
+	 * Returns minimal number of Rows Dialogue Data Table needs to be split when cooking.
+	 * 
+	 * @return Minimal number of Rows.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Settings", meta=(CustomTag="MounteaK2Getter"))
+	int32 GetSplitDialogueTablesMinRows() const
+	{ return SplitDialogueTablesMinRows; };
 	
 protected:
 
+	/**
+	 * Returns Dialogue Configuration cached by Configuration Subsystem.
+	 * ❗ Might return null❗
+	 */
+	const UMounteaDialogueConfiguration* GetResolvedConfiguration() const;
+
 #if WITH_EDITOR
 	static FSlateFontInfo SetupDefaultFontSettings();
 	
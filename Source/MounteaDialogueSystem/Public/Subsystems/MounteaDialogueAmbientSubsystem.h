@@ -0,0 +1,169 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaDialogueAmbientSubsystem.generated.h"
+
+class IMounteaDialogueManagerInterface;
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+
+/**
+ * Level of detail of Ambient Dialogue Session.
+ */
+UENUM(BlueprintType)
+enum class EMounteaAmbientDialogueLOD : uint8
+{
+	EMADL_Simulated		UMETA(DisplayName="Simulated", Tooltip="Far away. Advanced in coarse simulated time without UI, audio or replication."),
+	EMADL_Promoted		UMETA(DisplayName="Promoted", Tooltip="Close. Played by full Dialogue Manager."),
+
+	Default				UMETA(hidden)
+};
+
+/**
+ * Single Ambient Dialogue owned by Ambient Dialogue Subsystem.
+ */
+struct FMounteaAmbientDialogueSession
+{
+	FGuid SessionGuid;
+
+	TWeakObjectPtr<AActor> Speaker;
+	TWeakObjectPtr<UMounteaDialogueGraph> Graph;
+	TWeakObjectPtr<UObject> Manager;
+
+	EMounteaAmbientDialogueLOD LOD = EMounteaAmbientDialogueLOD::EMADL_Simulated;
+
+	// Simulated state
+	TWeakObjectPtr<UMounteaDialogueGraphNode> SimulatedNode;
+	TArray<float> SimulatedRowDurations;
+	int32 SimulatedRowIndex = 0;
+	float RemainingRowTime = 0.f;
+
+	float SquaredDistance = TNumericLimits<float>::Max();
+
+	// World time of promotion, Manager might need a while to become active
+	double PromotionTime = 0.0;
+	bool bPromotedDialogueStarted = false;
+
+	// Set once Promoted Dialogue finished or failed to start, cleared once simulation loops or player walks away
+	bool bPromotionBlocked = false;
+
+	bool bLoop = true;
+	bool bFinished = false;
+};
+
+/**
+ * Counts of Ambient Dialogue Sessions.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaAmbientDialogueStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Ambient")
+	int32 RegisteredSessions = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Ambient")
+	int32 SimulatedSessions = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Ambient")
+	int32 PromotedSessions = 0;
+
+	// Number of Sessions waiting for promotion because of Promoted Sessions cap
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Ambient")
+	int32 ThrottledSessions = 0;
+};
+
+/**
+ * UMounteaDialogueAmbientSubsystem
+ *
+ * World Subsystem which owns Ambient (barking) Dialogues centrally.
+ * Instead of every NPC running its own Environment Dialogue Manager, Sessions are distance-based LODed:
+ * - Far Sessions are Simulated: Rows advance in coarse steps, no UI, no audio, no replication, Manager is untouched
+ * - Near Sessions are Promoted to the Speaker's Environment Dialogue Manager, which plays them fully
+ *
+ * Cost is bounded by maximum of Promoted Sessions and number of significance updates per frame.
+ * All limits are configured in 'Mountea Dialogue Config' under 'Ambient' category.
+ *
+ * ❔ Simulated Sessions do not evaluate Decorators, the first Dialogue Node child is followed
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueAmbientSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaDialogueAmbientSubsystem* Get(const UObject* WorldContext);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+
+	/**
+	 * Registers Ambient Dialogue of given Speaker.
+	 * Speaker must have Dialogue Participant with valid Dialogue Graph.
+	 * Speaker's Environment Dialogue Manager is used for promotion, if any exists.
+	 *
+	 * @param Speaker	Actor owning the Ambient Dialogue.
+	 * @param bLoop		Whether Dialogue should start over once finished.
+	 * @return Guid of the Session, invalid if registration failed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Ambient", meta=(CustomTag="MounteaK2Setter"))
+	FGuid RegisterAmbientDialogue(AActor* Speaker, const bool bLoop = true);
+
+	/**
+	 * Unregisters Ambient Dialogue. Promoted Dialogue is closed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Ambient", meta=(CustomTag="MounteaK2Setter"))
+	void UnregisterAmbientDialogue(const FGuid& SessionGuid);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Ambient", meta=(CustomTag="MounteaK2Getter"))
+	EMounteaAmbientDialogueLOD GetAmbientDialogueLOD(const FGuid& SessionGuid) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Ambient", meta=(CustomTag="MounteaK2Getter"))
+	FMounteaAmbientDialogueStats GetAmbientStats() const
+	{ return AmbientStats; };
+
+protected:
+
+	void UpdateSignificance();
+	void UpdateLOD();
+	void AdvanceSimulation(const float SimulatedTime);
+
+	void StartSimulatedNode(FMounteaAmbientDialogueSession& Session, UMounteaDialogueGraphNode* Node) const;
+	void AdvanceSimulatedNode(FMounteaAmbientDialogueSession& Session) const;
+	void RestartSimulation(FMounteaAmbientDialogueSession& Session) const;
+
+	bool PromoteSession(FMounteaAmbientDialogueSession& Session);
+	void DemoteSession(FMounteaAmbientDialogueSession& Session, const bool bCloseDialogue);
+
+	static bool IsPromotedDialogueActive(const FMounteaAmbientDialogueSession& Session);
+	static UMounteaDialogueGraphNode* FindNextSimulatedNode(const UMounteaDialogueGraphNode* FromNode);
+
+protected:
+
+	TArray<FMounteaAmbientDialogueSession> AmbientSessions;
+
+	// Cached view locations of all players, refreshed every frame
+	TArray<FVector> ViewLocations;
+
+	FMounteaAmbientDialogueStats AmbientStats;
+
+	// Round-robin cursor of significance updates
+	int32 NextSignificanceIndex = 0;
+
+	float SimulationAccumulator = 0.f;
+
+	float PromotionDistance = 1500.f;
+	float DemotionDistance = 2000.f;
+	int32 MaxPromotedSessions = 4;
+	int32 SignificanceUpdatesPerFrame = 32;
+	float SimulationStep = 0.5f;
+};
@@ -0,0 +1,59 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/MounteaDialogueGraphDataTypes.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "MounteaDialogueConfigurationSubsystem.generated.h"
+
+class UMounteaDialogueConfiguration;
+
+/**
+ * UMounteaDialogueConfigurationSubsystem
+ *
+ * Engine Subsystem which resolves 'Mountea Dialogue Config' from Project Settings once on startup
+ * and keeps it alive, so Settings getters never touch the loader during gameplay.
+ * Subtitles Settings overrides are flattened into lookup map, invalid overrides are resolved to General Settings.
+ *
+ * ❔ In Editor the cache is refreshed whenever Settings or Config asset change
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueConfigurationSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaDialogueConfigurationSubsystem* Get();
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Resolves Dialogue Configuration from Settings and rebuilds all cached data.
+	 */
+	void RefreshConfiguration();
+
+	/**
+	 * Returns cached Dialogue Configuration.
+	 * ❗ Might return null❗
+	 */
+	const UMounteaDialogueConfiguration* GetConfiguration() const
+	{ return CachedConfiguration; };
+
+	/**
+	 * Returns Subtitles Settings for given Row ID.
+	 * Returns General Subtitles Settings if no valid override exists.
+	 */
+	const FSubtitlesSettings& GetSubtitlesSettings(const FUIRowID& RowID) const;
+
+protected:
+
+	UPROPERTY(Transient)
+	TObjectPtr<UMounteaDialogueConfiguration> CachedConfiguration;
+
+	TMap<FUIRowID, FSubtitlesSettings> CachedSubtitlesSettings;
+
+	FSubtitlesSettings CachedDefaultSubtitlesSettings;
+};
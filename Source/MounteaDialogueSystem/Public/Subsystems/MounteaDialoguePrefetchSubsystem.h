@@ -0,0 +1,98 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaDialoguePrefetchSubsystem.generated.h"
+
+struct FStreamableHandle;
+class UMounteaDialogueGraphNode;
+class USoundWave;
+class UTexture2D;
+class UUserWidget;
+
+/**
+ * Runtime bookkeeping of a single prefetching Dialogue.
+ * Each Dialogue Manager owns one Session, Session is released once Dialogue closes.
+ */
+struct FMounteaDialoguePrefetchSession
+{
+	// Sound Waves which have their compressed audio retained by this Session
+	TMap<TWeakObjectPtr<USoundWave>, int64> RetainedWaves;
+
+	// Sum of sizes of all retained Sound Waves
+	int64 RetainedBytes = 0;
+};
+
+/**
+ * UMounteaDialoguePrefetchSubsystem
+ *
+ * World Subsystem which streams in assets of upcoming Dialogue Rows ahead of time.
+ * Once a Node is prepared, Child Nodes up to 'PrefetchDepth' are scanned and:
+ * - Voice lines have their compressed audio retained, so the first audio chunk is resident before the Row starts
+ * - Row icons have their mip levels forced resident
+ * Assets which are no longer reachable from the Active Node are released.
+ *
+ * Prefetching is configured in 'Mountea Dialogue Config' under 'Streaming' category.
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialoguePrefetchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaDialoguePrefetchSubsystem* Get(const UObject* WorldContext);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Prefetches assets of all Nodes reachable from 'FromNode' within 'PrefetchDepth'.
+	 * Assets retained previously by the same Session which are no longer reachable are released.
+	 *
+	 * @param SessionOwner	Object which owns the Session, usually Dialogue Manager.
+	 * @param FromNode		Active Node to start scanning from.
+	 */
+	void PrefetchUpcomingNodes(const UObject* SessionOwner, const UMounteaDialogueGraphNode* FromNode);
+
+	/**
+	 * Requests asynchronous load of Widget Class.
+	 * Loaded Class is kept alive until Subsystem is deinitialized.
+	 *
+	 * @param WidgetClass	Soft Class to be loaded.
+	 */
+	void PrefetchWidgetClass(const TSoftClassPtr<UUserWidget>& WidgetClass);
+
+	/**
+	 * Releases all assets retained by given Session.
+	 *
+	 * @param SessionOwner	Object which owns the Session, usually Dialogue Manager.
+	 */
+	void ReleaseSession(const UObject* SessionOwner);
+
+	bool IsPrefetchEnabled() const
+	{ return bPrefetchEnabled; };
+
+protected:
+
+	void CollectUpcomingNodes(const UMounteaDialogueGraphNode* FromNode, TArray<const UMounteaDialogueGraphNode*>& OutNodes) const;
+	static void CollectNodeAssets(const UMounteaDialogueGraphNode* Node, TArray<USoundWave*>& OutWaves, TArray<UTexture2D*>& OutIcons);
+	void RetainWave(USoundWave* Wave);
+	void ReleaseWave(const TWeakObjectPtr<USoundWave>& Wave);
+
+protected:
+
+	TMap<TWeakObjectPtr<const UObject>, FMounteaDialoguePrefetchSession> PrefetchSessions;
+
+	// How many Sessions retain each Sound Wave, compressed audio is released once no Session needs it
+	TMap<TWeakObjectPtr<USoundWave>, int32> WaveRetainCounts;
+
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> WidgetHandles;
+
+	bool bPrefetchEnabled = false;
+	int32 PrefetchDepth = 1;
+	int64 PrefetchMemoryBudget = 0;
+	int32 PrefetchPriority = 100;
+};
@@ -0,0 +1,200 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Engine/EngineTypes.h"
+#include "Interfaces/Core/MounteaDialogueManagerInterface.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaDialogueSessionRecorderSubsystem.generated.h"
+
+class UMounteaDialogueContext;
+
+enum class EMounteaDialogueRecordingVersion : uint16
+{
+	Invalid			= 0,
+	Initial			= 1,
+
+	// -----<new versions can be added above this line>-----
+	LatestPlusOne,
+	Latest			= LatestPlusOne - 1
+};
+
+enum class EMounteaDialogueRecordedInputType : uint8
+{
+	SelectNode		= 0,
+	SkipRow			= 1,
+	CloseDialogue	= 2
+};
+
+/**
+ * Single input provided to Dialogue Manager during recorded session.
+ */
+struct FMounteaDialogueRecordedInput
+{
+	EMounteaDialogueRecordedInputType Type = EMounteaDialogueRecordedInputType::SkipRow;
+
+	// Milliseconds since session started
+	uint32 TimeMs = 0;
+
+	// Selected Node, only valid for 'SelectNode' inputs
+	FGuid NodeGuid;
+};
+
+/**
+ * All inputs of single recorded Dialogue session.
+ * Together with Graph asset they are enough to re-drive Dialogue Manager deterministically.
+ */
+struct MOUNTEADIALOGUESYSTEM_API FMounteaDialogueSessionRecording
+{
+	static constexpr uint32 Magic = 0x4D445243; // 'MDRC'
+
+	FSoftObjectPath DialogueGraph;
+	FGuid StartingNodeGuid;
+	int32 RandomSeed = 0;
+	TArray<FGameplayTag> ParticipantTags;
+
+	// Milliseconds from session start to Dialogue close
+	uint32 DurationMs = 0;
+
+	TArray<FMounteaDialogueRecordedInput> Inputs;
+
+	// Outcomes of non-pure Decorator Evaluations in the order they were evaluated
+	TBitArray<> DecoratorOutcomes;
+
+	/**
+	 * Serializes Recording into compact binary log.
+	 * Times are stored as packed deltas, Decorator outcomes as single bits.
+	 */
+	void Write(TArray<uint8>& OutBytes) const;
+
+	/**
+	 * Reads Recording from binary log.
+	 * Returns false if bytes are not a Recording or were written by newer version.
+	 */
+	bool Read(const TArray<uint8>& Bytes);
+
+	FString ToString() const;
+};
+
+/**
+ * UMounteaDialogueSessionRecorderSubsystem
+ *
+ * World Subsystem which records all inputs of Dialogue sessions and replays them.
+ * Recorded are:
+ * - Starting Graph, Node and Participant Tags
+ * - Random Seed of Dialogue Context
+ * - Node selections, skipped Rows and close requests, with their timings
+ * - Outcomes of non-pure Decorator Evaluations
+ *
+ * Replay re-drives Dialogue Manager with the same inputs. Decorators are not evaluated during Replay,
+ * recorded outcomes are used instead, so World state does not need to match.
+ *
+ * Recording of all sessions can be enabled by 'Mountea.Dialogue.RecordSessions', logs are saved to 'Saved/MounteaDialogue/Recordings'.
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueSessionRecorderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaDialogueSessionRecorderSubsystem* Get(const UObject* WorldContext);
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Requests next Dialogue session of given Manager to be recorded.
+	 * Once session closes, its Recording is available using 'GetLastRecording'.
+	 *
+	 * @param Manager	Dialogue Manager to be recorded.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Recorder", meta=(CustomTag="MounteaK2Setter"))
+	void RecordNextSession(UObject* Manager);
+
+	/**
+	 * Returns binary log of the last session recorded for given Manager.
+	 *
+	 * @param Manager		Dialogue Manager which was recorded.
+	 * @param OutBytes		Binary log of the Recording.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Recorder", meta=(CustomTag="MounteaK2Getter"))
+	bool GetLastRecording(const UObject* Manager, TArray<uint8>& OutBytes) const;
+
+	/**
+	 * Replays recorded session using given Manager.
+	 * Recorded inputs are injected at their recorded times, scaled by Playback Rate.
+	 * Playback Rate of 0 replays headless: Rows finish immediately and inputs are injected as soon as possible.
+	 *
+	 * @param Manager			Dialogue Manager to re-drive. Must have authority.
+	 * @param DialogueInitiator	Initiator of the Dialogue.
+	 * @param Participants		Participants of the Dialogue. Main Participant must own recorded Graph and start from recorded Node, all Participants must have been recorded.
+	 * @param RecordingBytes	Binary log of the Recording.
+	 * @param PlaybackRate		Speed of the Replay, 0 for headless Replay.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Recorder", meta=(CustomTag="MounteaK2Setter"))
+	bool StartReplay(UObject* Manager, AActor* DialogueInitiator, const FDialogueParticipants& Participants, const TArray<uint8>& RecordingBytes, const float PlaybackRate = 1.f);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Recorder", meta=(CustomTag="MounteaK2Validate"))
+	bool IsReplaying(UObject* Manager) const;
+
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Recorder", meta=(CustomTag="MounteaK2Setter"))
+	static bool SaveRecordingToFile(const TArray<uint8>& RecordingBytes, const FString& FilePath);
+
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Recorder", meta=(CustomTag="MounteaK2Getter"))
+	static bool LoadRecordingFromFile(const FString& FilePath, TArray<uint8>& OutBytes);
+
+	// Cheap check for hot paths, true if any session is being recorded or replayed
+	bool IsActive() const
+	{ return Recordings.Num() > 0 || Replays.Num() > 0; };
+
+	/** Manager hooks */
+
+	void BeginSession(UObject* Manager);
+	void SessionContextCreated(UObject* Manager, UMounteaDialogueContext* Context);
+	void RecordInput(const UObject* Manager, const EMounteaDialogueRecordedInputType Type, const FGuid& NodeGuid = FGuid());
+	void EndSession(UObject* Manager);
+
+	/**
+	 * Records outcome of Decorator Evaluation, or provides recorded one during Replay.
+	 * Returns true if 'OutResult' was filled with recorded outcome and Decorator should not be evaluated.
+	 */
+	bool ConsumeDecoratorOutcome(UObject* Manager, bool& OutResult);
+	void RecordDecoratorOutcome(const UObject* Manager, const bool bResult);
+
+protected:
+
+	struct FRecordingSession
+	{
+		FMounteaDialogueSessionRecording Recording;
+		double StartTime = 0.0;
+	};
+
+	struct FReplaySession
+	{
+		FMounteaDialogueSessionRecording Recording;
+		double StartTime = 0.0;
+		double StallStartTime = 0.0;
+		float PlaybackRate = 1.f;
+		int32 NextInput = 0;
+		int32 NextDecoratorOutcome = 0;
+	};
+
+	void TickReplays();
+	bool TickReplay(UObject* Manager, FReplaySession& Replay);
+	static bool CanApplyInput(const UMounteaDialogueContext* Context, const FMounteaDialogueRecordedInput& Input);
+	void SaveRecordingToDisk(const UObject* Manager, const TArray<uint8>& RecordingBytes) const;
+
+protected:
+
+	TMap<TWeakObjectPtr<const UObject>, FRecordingSession> Recordings;
+	// Replayed Managers are re-driven by injected inputs, so they are stored as mutable objects
+	TMap<TWeakObjectPtr<UObject>, FReplaySession> Replays;
+	TMap<TWeakObjectPtr<const UObject>, TArray<uint8>> LastRecordings;
+
+	// Managers whose next session should be recorded
+	TSet<TWeakObjectPtr<const UObject>> ArmedManagers;
+
+	FTimerHandle TimerHandle_ReplayTick;
+};
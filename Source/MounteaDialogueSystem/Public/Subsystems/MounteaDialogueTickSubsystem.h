@@ -0,0 +1,189 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaDialogueTickSubsystem.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("MounteaDialogue"), STATGROUP_MounteaDialogue, STATCAT_Advanced);
+
+/**
+ * Defines order in which Tickable Objects are dispatched within one pass.
+ * Mirrors the original Participant → Graph → Node → Decorator chain.
+ */
+UENUM(BlueprintType)
+enum class EMounteaDialogueTickGroup : uint8
+{
+	EMDTG_Participant		UMETA(DisplayName="Participant"),
+	EMDTG_Graph				UMETA(DisplayName="Graph"),
+	EMDTG_Node				UMETA(DisplayName="Node"),
+	EMDTG_Decorator			UMETA(DisplayName="Decorator"),
+
+	Default					UMETA(hidden)
+};
+
+/**
+ * Snapshot of Dialogue Tick cost.
+ * Updated every frame by Dialogue Tick Subsystem.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaDialogueTickStats
+{
+	GENERATED_BODY()
+
+	// Number of currently registered Tickable Objects
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Tick")
+	int32 RegisteredTickables = 0;
+
+	// Number of Tickable Objects dispatched last frame
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Tick")
+	int32 DispatchedLastFrame = 0;
+
+	// Number of Tickable Objects which were due but got deferred due to budget last frame
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Tick")
+	int32 DeferredLastFrame = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Tick", meta=(Units="Milliseconds"))
+	float LastFrameCostMs = 0.f;
+
+	// Exponential moving average of frame cost
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Tick", meta=(Units="Milliseconds"))
+	float AverageFrameCostMs = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Tick", meta=(Units="Milliseconds"))
+	float PeakFrameCostMs = 0.f;
+
+	// Cost of each Tick Group last frame
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mountea|Dialogue|Tick")
+	TMap<EMounteaDialogueTickGroup, float> GroupCostMs;
+};
+
+/**
+ * Single registered Tickable Object.
+ * The same Object might be registered multiple times, once per Session.
+ */
+struct FMounteaDialogueTickEntry
+{
+	TWeakObjectPtr<UObject> Tickable;
+	TWeakObjectPtr<UObject> ParentTickable;
+	TWeakObjectPtr<const UObject> Session;
+
+	EMounteaDialogueTickGroup TickGroup = EMounteaDialogueTickGroup::Default;
+
+	// 0 means every frame
+	float TickInterval = 0.f;
+	// Time since last dispatch
+	float AccumulatedTime = 0.f;
+
+	// Native classes are dispatched directly, Blueprint classes through reflection
+	bool bNativeDispatch = false;
+	bool bPendingRemoval = false;
+
+	// Was due but exceeded budget last frame, dispatched next frame regardless of budget
+	bool bDeferred = false;
+};
+
+/**
+ * UMounteaDialogueTickSubsystem
+ *
+ * World Subsystem which owns ticking of all Dialogue objects.
+ * Replaces chain of dynamic multicast delegates (Participant → Graph → Node → Decorator) with flat list
+ * of Tickable Objects per Session (usually Dialogue Manager), dispatched in Tick Group order.
+ *
+ * Supports:
+ * - Tick intervals per Tickable Object
+ * - Per-frame budget, once exceeded remaining Tickable Objects are deferred to next frame and receive accumulated Delta Time
+ *   Deferred Tickable Objects are dispatched next frame regardless of budget, still in Tick Group order
+ * - Tick cost stats, available via 'stat MounteaDialogue' and 'GetTickStats'
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEM_API UMounteaDialogueTickSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaDialogueTickSubsystem* Get(const UObject* WorldContext);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+
+	/**
+	 * Registers Tickable Object within given Session.
+	 * Registering the same Object within the same Session again only updates its Parent and Interval.
+	 *
+	 * @param Session			Object which owns the Session, usually Dialogue Manager.
+	 * @param Tickable			Object implementing 'IMounteaDialogueTickableObject'.
+	 * @param ParentTickable	Object passed as 'ParentTick' when dispatching.
+	 * @param TickGroup			Defines dispatch order.
+	 * @param TickInterval		Minimal time between two dispatches, 0 means every frame.
+	 */
+	void RegisterTickable(const UObject* Session, UObject* Tickable, UObject* ParentTickable, const EMounteaDialogueTickGroup TickGroup, const float TickInterval = 0.f);
+
+	/**
+	 * Unregisters Tickable Object from given Session.
+	 */
+	void UnregisterTickable(const UObject* Session, const UObject* Tickable);
+
+	/**
+	 * Unregisters Tickable Object from all Sessions where it is registered under given Parent.
+	 * Used by 'UnregisterTick' which is not aware of Session.
+	 */
+	void UnregisterTickableFromParent(const UObject* Tickable, const UObject* ParentTickable);
+
+	/**
+	 * Unregisters all Tickable Objects of given Session.
+	 */
+	void UnregisterSession(const UObject* Session);
+
+	/**
+	 * Returns Session of the first registration of given Tickable Object.
+	 * ❗ Might return null❗
+	 */
+	const UObject* FindSession(const UObject* Tickable) const;
+
+	/**
+	 * Sets Tick Interval of Tickable Object in all Sessions.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Tick", meta=(CustomTag="MounteaK2Setter"))
+	void SetTickInterval(UObject* Tickable, const float NewTickInterval);
+
+	/**
+	 * Sets per-frame budget of Dialogue Tick.
+	 * ❔ Units: milliseconds, 0 means unlimited
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Dialogue|Tick", meta=(CustomTag="MounteaK2Setter"))
+	void SetTickBudget(const float NewTickBudgetMs);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Dialogue|Tick", meta=(CustomTag="MounteaK2Getter"))
+	FMounteaDialogueTickStats GetTickStats() const
+	{ return TickStats; };
+
+protected:
+
+	void DispatchTick(const FMounteaDialogueTickEntry& TickEntry, const float DeltaTime) const;
+	void FlushPendingChanges();
+	int32 FindEntryIndex(const UObject* Session, const UObject* Tickable) const;
+	void InsertEntry(FMounteaDialogueTickEntry&& NewEntry);
+
+protected:
+
+	// Sorted by Tick Group
+	TArray<FMounteaDialogueTickEntry> TickEntries;
+
+	// Registered while dispatching, merged after dispatch is finished
+	TArray<FMounteaDialogueTickEntry> PendingEntries;
+
+	FMounteaDialogueTickStats TickStats;
+
+	float TickBudgetMs = 0.f;
+
+	bool bIsDispatching = false;
+	bool bHasPendingRemovals = false;
+};
@@ -72,6 +72,7 @@ public class MounteaDialogueSystemEditor : ModuleRules
 				"InputCore", 
 				
 				"MainFrame",
+				"MessageLog",
 				
 				"GameplayTags",
 				"DesktopPlatform", 
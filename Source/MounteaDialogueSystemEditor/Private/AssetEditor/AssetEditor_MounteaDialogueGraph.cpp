@@ -16,6 +16,7 @@
 #include "Ed/EdGraph_MounteaDialogueGraph.h"
 #include "Ed/EdNode_MounteaDialogueGraphEdge.h"
 #include "Ed/EdNode_MounteaDialogueGraphNode.h"
+#include "Ed/SEdNode_MounteaDialogueGraphNode.h"
 #include "EditorStyle/FMounteaDialogueGraphEditorStyle.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "GraphScheme/AssetGraphScheme_MounteaDialogueGraph.h"
@@ -35,6 +36,7 @@
 #include "Serialization/JsonSerializer.h"
 #include "Settings/MounteaDialogueGraphEditorSettings.h"
 #include "UObject/ObjectSaveContext.h"
+#include "Validation/MounteaDialogueValidationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
 #define LOCTEXT_NAMESPACE "AssetEditorMounteaDialogueGraph"
@@ -59,12 +61,18 @@ FAssetEditor_MounteaDialogueGraph::FAssetEditor_MounteaDialogueGraph()
 	MounteaDialogueGraphEditorSettings = GetMutableDefault<UMounteaDialogueGraphEditorSettings>();
 	OnPackageSavedDelegateHandle = UPackage::PackageSavedWithContextEvent.AddRaw(
 		this, &FAssetEditor_MounteaDialogueGraph::OnPackageSaved);
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(
+		this, &FAssetEditor_MounteaDialogueGraph::OnObjectPropertyChanged);
+	OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(
+		this, &FAssetEditor_MounteaDialogueGraph::OnObjectTransacted);
 }
 
 FAssetEditor_MounteaDialogueGraph::~FAssetEditor_MounteaDialogueGraph()
 {
 	EditingGraph = nullptr;
 	UPackage::PackageSavedWithContextEvent.Remove(OnPackageSavedDelegateHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(OnObjectTransactedHandle);
 	FMounteaDialogueGraphEditorCommands::Unregister();
 	ToolbarBuilder.Reset();
 }
@@ -252,9 +260,10 @@ FString FAssetEditor_MounteaDialogueGraph::GetDocumentationLink() const
 
 void FAssetEditor_MounteaDialogueGraph::SaveAsset_Execute()
 {
+	// Saved data must never depend on incremental rebuild cache
 	if (EditingGraph != nullptr)
 	{
-		RebuildMounteaDialogueGraph();
+		RebuildMounteaDialogueGraph(true);
 	}
 
 	FAssetEditorToolkit::SaveAsset_Execute();
@@ -671,7 +680,7 @@ FGraphPanelSelectionSet FAssetEditor_MounteaDialogueGraph::GetSelectedNodes() co
 	return CurrentSelection;
 }
 
-void FAssetEditor_MounteaDialogueGraph::RebuildMounteaDialogueGraph()
+void FAssetEditor_MounteaDialogueGraph::RebuildMounteaDialogueGraph(const bool bForceFullRebuild)
 {
 	if (EditingGraph == nullptr)
 	{
@@ -681,7 +690,9 @@ void FAssetEditor_MounteaDialogueGraph::RebuildMounteaDialogueGraph()
 	UEdGraph_MounteaDialogueGraph* EdGraph = Cast<UEdGraph_MounteaDialogueGraph>(EditingGraph->EdGraph);
 	check(EdGraph != nullptr);
 
-	EdGraph->RebuildMounteaDialogueGraph();
+	EdGraph->RebuildMounteaDialogueGraph(bForceFullRebuild);
+
+	FMounteaDialogueValidationManager::Get()->RequestValidation(EditingGraph);
 }
 
 void FAssetEditor_MounteaDialogueGraph::SummonSearchUI(FString NewSearch, bool bSelectFirstResult)
@@ -1249,6 +1260,56 @@ void FAssetEditor_MounteaDialogueGraph::OnFinishedChangingProperties(const FProp
 	RebuildMounteaDialogueGraph();
 }
 
+void FAssetEditor_MounteaDialogueGraph::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	InvalidateNodeDisplayStates(Object);
+}
+
+void FAssetEditor_MounteaDialogueGraph::OnObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent)
+{
+	InvalidateNodeDisplayStates(Object);
+}
+
+void FAssetEditor_MounteaDialogueGraph::InvalidateNodeDisplayStates(const UObject* ChangedObject) const
+{
+	if (!ChangedObject || !EditingGraph || ChangedObject->GetOutermost() != EditingGraph->GetOutermost())
+		return;
+
+	const UEdGraph_MounteaDialogueGraph* EdGraph = Cast<UEdGraph_MounteaDialogueGraph>(EditingGraph->EdGraph);
+	if (!EdGraph)
+		return;
+
+	// Graph data, such as Participants, is displayed by every Node
+	if (ChangedObject == EditingGraph)
+	{
+		for (const auto& NodePair : EdGraph->NodeMap)
+		{
+			if (NodePair.Value && NodePair.Value->SEdNode)
+			{
+				NodePair.Value->SEdNode->InvalidateDisplayState();
+			}
+		}
+		return;
+	}
+
+	// Editor Nodes invalidate their widget themselves
+	if (ChangedObject->IsA<UEdNode_MounteaDialogueGraphNode>())
+		return;
+
+	// Decorators are instanced within Node
+	const UMounteaDialogueGraphNode* ChangedNode = Cast<UMounteaDialogueGraphNode>(ChangedObject);
+	if (!ChangedNode)
+	{
+		ChangedNode = ChangedObject->GetTypedOuter<UMounteaDialogueGraphNode>();
+	}
+
+	UEdNode_MounteaDialogueGraphNode* const* EdNode = ChangedNode ? EdGraph->NodeMap.Find(const_cast<UMounteaDialogueGraphNode*>(ChangedNode)) : nullptr;
+	if (EdNode && *EdNode && (*EdNode)->SEdNode)
+	{
+		(*EdNode)->SEdNode->InvalidateDisplayState();
+	}
+}
+
 TSharedRef<SDockTab> FAssetEditor_MounteaDialogueGraph::SpawnTab_Viewport(const FSpawnTabArgs& Args)
 {
 	check(Args.GetTabId() == FAssetEditorTabs_MounteaDialogueGraph::ViewportID);
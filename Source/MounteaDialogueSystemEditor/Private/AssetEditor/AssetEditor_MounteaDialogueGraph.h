@@ -94,7 +94,7 @@ private:
 
 	FGraphPanelSelectionSet GetSelectedNodes() const;
 
-	void RebuildMounteaDialogueGraph();
+	void RebuildMounteaDialogueGraph(const bool bForceFullRebuild = false);
 
 	void SummonSearchUI(FString NewSearch = FString(), bool bSelectFirstResult = false);
 	void ExportGraph();
@@ -135,6 +135,11 @@ private:
 
 	void OnFinishedChangingProperties(const FPropertyChangedEvent& PropertyChangedEvent);
 
+	// Single subscription for this Graph, forwards changes only to Node widgets displaying the changed object
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void OnObjectTransacted(UObject* Object, const class FTransactionObjectEvent& TransactionEvent);
+	void InvalidateNodeDisplayStates(const UObject* ChangedObject) const;
+
 	//void OnPackageSaved(const FString& PackageFileName, UObject* Outer);
 
 #pragma endregion 
@@ -157,6 +162,9 @@ private:
 	/** Handle to the registered OnPackageSave delegate */
 	FDelegateHandle OnPackageSavedDelegateHandle;
 
+	FDelegateHandle OnObjectPropertyChangedHandle;
+	FDelegateHandle OnObjectTransactedHandle;
+
 	TSharedPtr<SGraphEditor> ViewportWidget;
 	TSharedPtr<class IDetailsView> PropertyWidget;
 	TSharedPtr<SMounteaDialogueSearch> FindResultsView;
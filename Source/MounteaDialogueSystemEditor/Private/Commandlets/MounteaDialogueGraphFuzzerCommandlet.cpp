@@ -0,0 +1,370 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Commandlets/MounteaDialogueGraphFuzzerCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Decorators/MounteaDialogueDecoratorBase.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphEditorHelpers.h"
+#include "Helpers/MounteaDialogueSystemBFC.h"
+#include "Misc/FileHelper.h"
+#include "Nodes/MounteaDialogueGraphNode.h"
+#include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
+#include "Nodes/MounteaDialogueGraphNode_ReturnToNode.h"
+
+namespace MounteaDialogueFuzzer
+{
+	// How many of the most expensive cliff paths are printed per Graph
+	constexpr int32 MaxReportedCliffs = 5;
+
+	FMounteaDialogueFuzzerDecoratorStub MakeStub(const FString& StubName, const float PassChance)
+	{
+		if (StubName.Equals(TEXT("Fail"), ESearchCase::IgnoreCase))
+		{
+			return [](const UMounteaDialogueDecoratorBase*, FRandomStream&) { return false; };
+		}
+
+		if (StubName.Equals(TEXT("Random"), ESearchCase::IgnoreCase))
+		{
+			return [PassChance](const UMounteaDialogueDecoratorBase*, FRandomStream& RandomStream) { return RandomStream.FRand() < PassChance; };
+		}
+
+		return [](const UMounteaDialogueDecoratorBase*, FRandomStream&) { return true; };
+	}
+
+	FString DescribePath(const FMounteaDialogueFuzzerPath& Path)
+	{
+		TArray<FString> nodeIndexes;
+		for (const int32 nodeIndex : Path.Nodes)
+		{
+			nodeIndexes.Add(FString::FromInt(nodeIndex));
+		}
+		return FString::Join(nodeIndexes, TEXT(">")) + (Path.bTruncated ? TEXT(">...") : TEXT(""));
+	}
+}
+
+UMounteaDialogueGraphFuzzerCommandlet::UMounteaDialogueGraphFuzzerCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+TMap<const UClass*, FMounteaDialogueFuzzerDecoratorStub>& UMounteaDialogueGraphFuzzerCommandlet::GetRegisteredStubs()
+{
+	static TMap<const UClass*, FMounteaDialogueFuzzerDecoratorStub> RegisteredStubs;
+	return RegisteredStubs;
+}
+
+void UMounteaDialogueGraphFuzzerCommandlet::RegisterDecoratorStub(const UClass* DecoratorClass, FMounteaDialogueFuzzerDecoratorStub Stub)
+{
+	if (DecoratorClass && Stub)
+		GetRegisteredStubs().Add(DecoratorClass, MoveTemp(Stub));
+}
+
+void UMounteaDialogueGraphFuzzerCommandlet::UnregisterDecoratorStub(const UClass* DecoratorClass)
+{
+	GetRegisteredStubs().Remove(DecoratorClass);
+}
+
+int32 UMounteaDialogueGraphFuzzerCommandlet::Main(const FString& Params)
+{
+	ParseOptions(Params);
+
+	IAssetRegistry& assetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	assetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetData> graphAssets;
+	assetRegistry.GetAssetsByClass(UMounteaDialogueGraph::StaticClass()->GetClassPathName(), graphAssets, true);
+
+	ReportLines.Add(TEXT("Graph,Path,Steps,Evaluations,EvaluationCost,LoopCount,MaxAllowedChildren,RowsVisited,Truncated,Nodes"));
+
+	int32 fuzzedGraphs = 0;
+	for (const FAssetData& graphAsset : graphAssets)
+	{
+		if (!PathFilter.IsEmpty() && !graphAsset.PackageName.ToString().StartsWith(PathFilter))
+			continue;
+
+		const UMounteaDialogueGraph* dialogueGraph = Cast<UMounteaDialogueGraph>(graphAsset.GetAsset());
+		if (!dialogueGraph)
+		{
+			EditorLOG_WARNING(TEXT("[Graph Fuzzer] Failed to load %s"), *graphAsset.GetObjectPathString())
+			continue;
+		}
+
+		if (FuzzGraph(dialogueGraph))
+			fuzzedGraphs++;
+	}
+
+	UE_LOG(LogMounteaDialogueSystemEditor, Display, TEXT("[Graph Fuzzer] Fuzzed %d Graphs, found %d cost cliffs"), fuzzedGraphs, CliffsFound);
+
+	FString reportPath;
+	if (FParse::Value(*Params, TEXT("Report="), reportPath))
+	{
+		if (FFileHelper::SaveStringArrayToFile(ReportLines, *reportPath))
+		{
+			UE_LOG(LogMounteaDialogueSystemEditor, Display, TEXT("[Graph Fuzzer] Report written to %s"), *reportPath);
+		}
+		else
+		{
+			EditorLOG_ERROR(TEXT("[Graph Fuzzer] Failed to write Report to %s"), *reportPath)
+		}
+	}
+
+	return bFailOnCliff && CliffsFound > 0 ? 1 : 0;
+}
+
+void UMounteaDialogueGraphFuzzerCommandlet::ParseOptions(const FString& Params)
+{
+	FParse::Value(*Params, TEXT("Path="), PathFilter);
+
+	FString mode;
+	if (FParse::Value(*Params, TEXT("Mode="), mode))
+		bExhaustive = !mode.Equals(TEXT("Random"), ESearchCase::IgnoreCase);
+
+	FParse::Value(*Params, TEXT("Walks="), Walks);
+	FParse::Value(*Params, TEXT("MaxSteps="), MaxSteps);
+	FParse::Value(*Params, TEXT("MaxLoops="), MaxLoops);
+	FParse::Value(*Params, TEXT("MaxPaths="), MaxPaths);
+	FParse::Value(*Params, TEXT("CliffFactor="), CliffFactor);
+	bFailOnCliff = FParse::Param(*Params, TEXT("FailOnCliff"));
+
+	Walks = FMath::Max(1, Walks);
+	MaxSteps = FMath::Max(1, MaxSteps);
+	MaxLoops = FMath::Max(0, MaxLoops);
+	MaxPaths = FMath::Max(1, MaxPaths);
+	CliffFactor = FMath::Max(1.f, CliffFactor);
+
+	int32 seed = 0;
+	FParse::Value(*Params, TEXT("Seed="), seed);
+	RandomStream.Initialize(seed);
+
+	float passChance = 0.5f;
+	FParse::Value(*Params, TEXT("PassChance="), passChance);
+
+	FString defaultStub = TEXT("Pass");
+	FParse::Value(*Params, TEXT("Decorators="), defaultStub);
+	DefaultStub = MounteaDialogueFuzzer::MakeStub(defaultStub, passChance);
+
+	// ClassA:Fail,ClassB:Random
+	FString decoratorStubs;
+	if (FParse::Value(*Params, TEXT("DecoratorStubs="), decoratorStubs, false))
+	{
+		TArray<FString> stubEntries;
+		decoratorStubs.ParseIntoArray(stubEntries, TEXT(","));
+		for (const FString& stubEntry : stubEntries)
+		{
+			FString className;
+			FString stubName;
+			if (!stubEntry.Split(TEXT(":"), &className, &stubName))
+				continue;
+
+			const UClass* decoratorClass = UClass::TryFindTypeSlow<UClass>(className);
+			if (!decoratorClass || !decoratorClass->IsChildOf(UMounteaDialogueDecoratorBase::StaticClass()))
+			{
+				EditorLOG_WARNING(TEXT("[Graph Fuzzer] Unknown Decorator class %s"), *className)
+				continue;
+			}
+
+			CommandLineStubs.Add(decoratorClass, MounteaDialogueFuzzer::MakeStub(stubName, passChance));
+		}
+	}
+}
+
+bool UMounteaDialogueGraphFuzzerCommandlet::FuzzGraph(const UMounteaDialogueGraph* Graph)
+{
+	const UMounteaDialogueGraphNode* startNode = Graph->GetStartNode();
+	if (!startNode)
+	{
+		EditorLOG_WARNING(TEXT("[Graph Fuzzer] Graph %s has no Start Node"), *Graph->GetPathName())
+		return false;
+	}
+
+	TArray<FMounteaDialogueFuzzerPath> walkedPaths;
+	if (bExhaustive)
+	{
+		FMounteaDialogueFuzzerPath path;
+		TMap<const UMounteaDialogueGraphNode*, int32> visitCounts;
+		WalkExhaustive(startNode, path, visitCounts, walkedPaths);
+	}
+	else
+	{
+		WalkRandom(startNode, walkedPaths);
+	}
+
+	ReportGraph(Graph, walkedPaths);
+	return true;
+}
+
+void UMounteaDialogueGraphFuzzerCommandlet::WalkExhaustive(const UMounteaDialogueGraphNode* Node, FMounteaDialogueFuzzerPath& Path, TMap<const UMounteaDialogueGraphNode*, int32>& VisitCounts, TArray<FMounteaDialogueFuzzerPath>& OutPaths)
+{
+	if (OutPaths.Num() >= MaxPaths)
+		return;
+
+	// Path and Visit Counts are restored once this branch is explored, so siblings start from the same state
+	const FMounteaDialogueFuzzerPath pathBefore = Path;
+
+	TArray<const UMounteaDialogueGraphNode*> nextNodes;
+	if (!VisitNode(Node, Path, VisitCounts, nextNodes))
+	{
+		OutPaths.Add(Path);
+	}
+	else
+	{
+		for (const UMounteaDialogueGraphNode* nextNode : nextNodes)
+		{
+			WalkExhaustive(nextNode, Path, VisitCounts, OutPaths);
+		}
+	}
+
+	if (int32* visitCount = VisitCounts.Find(Node))
+	{
+		if (--(*visitCount) <= 0)
+			VisitCounts.Remove(Node);
+	}
+	Path = pathBefore;
+}
+
+void UMounteaDialogueGraphFuzzerCommandlet::WalkRandom(const UMounteaDialogueGraphNode* StartNode, TArray<FMounteaDialogueFuzzerPath>& OutPaths)
+{
+	const int32 walksNum = FMath::Min(Walks, MaxPaths);
+	OutPaths.Reserve(walksNum);
+
+	for (int32 walkIndex = 0; walkIndex < walksNum; walkIndex++)
+	{
+		FMounteaDialogueFuzzerPath& path = OutPaths.AddDefaulted_GetRef();
+		TMap<const UMounteaDialogueGraphNode*, int32> visitCounts;
+
+		const UMounteaDialogueGraphNode* node = StartNode;
+		TArray<const UMounteaDialogueGraphNode*> nextNodes;
+		while (node && VisitNode(node, path, visitCounts, nextNodes))
+		{
+			node = nextNodes[RandomStream.RandHelper(nextNodes.Num())];
+		}
+	}
+}
+
+bool UMounteaDialogueGraphFuzzerCommandlet::VisitNode(const UMounteaDialogueGraphNode* Node, FMounteaDialogueFuzzerPath& Path, TMap<const UMounteaDialogueGraphNode*, int32>& VisitCounts, TArray<const UMounteaDialogueGraphNode*>& OutNextNodes)
+{
+	OutNextNodes.Reset();
+
+	int32& visitCount = VisitCounts.FindOrAdd(Node);
+	visitCount++;
+	if (visitCount > 1)
+		Path.LoopCount++;
+
+	Path.Nodes.Add(Node->GetNodeIndex());
+
+	if (Node->IsA(UMounteaDialogueGraphNode_DialogueNodeBase::StaticClass()))
+		Path.RowsVisited += UMounteaDialogueSystemBFC::GetDialogueRow(Node).DialogueRowData.Num();
+
+	if (visitCount > MaxLoops + 1 || Path.Nodes.Num() >= MaxSteps)
+	{
+		Path.bTruncated = true;
+		return false;
+	}
+
+	// Return to Node continues from its Selected Node without evaluating Decorators
+	if (const UMounteaDialogueGraphNode_ReturnToNode* returnNode = Cast<UMounteaDialogueGraphNode_ReturnToNode>(Node))
+	{
+		if (returnNode->SelectedNode)
+			OutNextNodes.Add(returnNode->SelectedNode);
+		return OutNextNodes.Num() > 0;
+	}
+
+	for (const UMounteaDialogueGraphNode* childNode : Node->GetChildrenNodes())
+	{
+		if (childNode && EvaluateChildNode(childNode, Path))
+			OutNextNodes.Add(childNode);
+	}
+
+	Path.MaxAllowedChildren = FMath::Max(Path.MaxAllowedChildren, OutNextNodes.Num());
+	return OutNextNodes.Num() > 0;
+}
+
+bool UMounteaDialogueGraphFuzzerCommandlet::EvaluateChildNode(const UMounteaDialogueGraphNode* ChildNode, FMounteaDialogueFuzzerPath& Path)
+{
+	// Same order as runtime, first failing Decorator stops Evaluation
+	for (const FMounteaDialogueDecorator& decorator : ChildNode->GetEvaluationDecorators())
+	{
+		if (!decorator.DecoratorType)
+			continue;
+
+		Path.Evaluations++;
+		Path.EvaluationCost += decorator.DecoratorType->GetEvaluationCost();
+
+		if (!FindDecoratorStub(decorator.DecoratorType)(decorator.DecoratorType, RandomStream))
+			return false;
+	}
+
+	return true;
+}
+
+const FMounteaDialogueFuzzerDecoratorStub& UMounteaDialogueGraphFuzzerCommandlet::FindDecoratorStub(const UMounteaDialogueDecoratorBase* Decorator) const
+{
+	const TMap<const UClass*, FMounteaDialogueFuzzerDecoratorStub>& registeredStubs = GetRegisteredStubs();
+	for (const UClass* decoratorClass = Decorator->GetClass(); decoratorClass; decoratorClass = decoratorClass->GetSuperClass())
+	{
+		if (const FMounteaDialogueFuzzerDecoratorStub* commandLineStub = CommandLineStubs.Find(decoratorClass))
+			return *commandLineStub;
+
+		if (const FMounteaDialogueFuzzerDecoratorStub* registeredStub = registeredStubs.Find(decoratorClass))
+			return *registeredStub;
+	}
+
+	return DefaultStub;
+}
+
+void UMounteaDialogueGraphFuzzerCommandlet::ReportGraph(const UMounteaDialogueGraph* Graph, TArray<FMounteaDialogueFuzzerPath>& Paths)
+{
+	if (Paths.Num() == 0)
+		return;
+
+	const FString graphName = Graph->GetPathName();
+	for (int32 pathIndex = 0; pathIndex < Paths.Num(); pathIndex++)
+	{
+		const FMounteaDialogueFuzzerPath& path = Paths[pathIndex];
+		ReportLines.Add(FString::Printf(TEXT("%s,%d,%d,%d,%lld,%d,%d,%d,%d,%s"),
+			*graphName, pathIndex, path.Nodes.Num(), path.Evaluations, path.EvaluationCost, path.LoopCount,
+			path.MaxAllowedChildren, path.RowsVisited, path.bTruncated ? 1 : 0, *MounteaDialogueFuzzer::DescribePath(path)));
+	}
+
+	Paths.Sort([](const FMounteaDialogueFuzzerPath& A, const FMounteaDialogueFuzzerPath& B)
+	{
+		return A.EvaluationCost > B.EvaluationCost;
+	});
+
+	const int64 medianCost = Paths[Paths.Num() / 2].EvaluationCost;
+	int32 truncatedPaths = 0;
+	int32 maxLoops = 0;
+	int32 maxAllowedChildren = 0;
+	int32 maxRows = 0;
+	for (const FMounteaDialogueFuzzerPath& path : Paths)
+	{
+		truncatedPaths += path.bTruncated ? 1 : 0;
+		maxLoops = FMath::Max(maxLoops, path.LoopCount);
+		maxAllowedChildren = FMath::Max(maxAllowedChildren, path.MaxAllowedChildren);
+		maxRows = FMath::Max(maxRows, path.RowsVisited);
+	}
+
+	UE_LOG(LogMounteaDialogueSystemEditor, Display, TEXT("[Graph Fuzzer] %s: %d paths (%d truncated) | Cost median %lld, max %lld | Max loops %d | Max allowed children %d | Max rows %d"),
+		*graphName, Paths.Num(), truncatedPaths, medianCost, Paths[0].EvaluationCost, maxLoops, maxAllowedChildren, maxRows);
+
+	// Paths are sorted by cost, so cliffs are at the beginning
+	const int64 cliffCost = static_cast<int64>(FMath::Max<int64>(1, medianCost) * static_cast<double>(CliffFactor));
+	int32 graphCliffs = 0;
+	for (const FMounteaDialogueFuzzerPath& path : Paths)
+	{
+		if (path.EvaluationCost <= cliffCost)
+			break;
+
+		if (graphCliffs++ < MounteaDialogueFuzzer::MaxReportedCliffs)
+		{
+			EditorLOG_WARNING(TEXT("[Graph Fuzzer] %s: cost cliff %lld (%.1fx median) | Evaluations %d | Loops %d | Path %s"),
+				*graphName, path.EvaluationCost, path.EvaluationCost / static_cast<double>(FMath::Max<int64>(1, medianCost)), path.Evaluations, path.LoopCount, *MounteaDialogueFuzzer::DescribePath(path))
+		}
+	}
+
+	CliffsFound += graphCliffs;
+}
@@ -0,0 +1,82 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaDialogueMemoryReportCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphEditorHelpers.h"
+#include "Helpers/MounteaDialogueMemoryReport.h"
+#include "Misc/FileHelper.h"
+
+UMounteaDialogueMemoryReportCommandlet::UMounteaDialogueMemoryReportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMounteaDialogueMemoryReportCommandlet::Main(const FString& Params)
+{
+	FString pathFilter;
+	FParse::Value(*Params, TEXT("Path="), pathFilter);
+
+	int32 topCount = 10;
+	FParse::Value(*Params, TEXT("Top="), topCount);
+
+	int32 budgetKB = 0;
+	FParse::Value(*Params, TEXT("BudgetKB="), budgetKB);
+
+	IAssetRegistry& assetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	assetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetData> graphAssets;
+	assetRegistry.GetAssetsByClass(UMounteaDialogueGraph::StaticClass()->GetClassPathName(), graphAssets, true);
+
+	FMounteaDialogueMemoryReport memoryReport;
+	for (const FAssetData& graphAsset : graphAssets)
+	{
+		if (!pathFilter.IsEmpty() && !graphAsset.PackageName.ToString().StartsWith(pathFilter))
+			continue;
+
+		if (const UMounteaDialogueGraph* dialogueGraph = Cast<UMounteaDialogueGraph>(graphAsset.GetAsset()))
+		{
+			memoryReport.AddGraph(dialogueGraph);
+		}
+		else
+		{
+			EditorLOG_WARNING(TEXT("[Memory Report] Failed to load %s"), *graphAsset.GetObjectPathString())
+		}
+	}
+
+	memoryReport.Finalize();
+	memoryReport.Print(*GLog, topCount);
+
+	int32 graphsOverBudget = 0;
+	if (budgetKB > 0)
+	{
+		for (const FMounteaDialogueGraphMemory& graphMemory : memoryReport.GetGraphs())
+		{
+			if (graphMemory.ResidentBytes <= static_cast<int64>(budgetKB) * 1024)
+				continue;
+
+			graphsOverBudget++;
+			EditorLOG_ERROR(TEXT("[Memory Report] %s is over budget: %.1f KB resident, budget is %d KB"), *graphMemory.GraphPath, graphMemory.ResidentBytes / 1024.0, budgetKB)
+		}
+	}
+
+	FString reportPath;
+	if (FParse::Value(*Params, TEXT("Report="), reportPath))
+	{
+		if (FFileHelper::SaveStringArrayToFile(memoryReport.ToCSV(), *reportPath))
+		{
+			UE_LOG(LogMounteaDialogueSystemEditor, Display, TEXT("[Memory Report] Report written to %s"), *reportPath);
+		}
+		else
+		{
+			EditorLOG_ERROR(TEXT("[Memory Report] Failed to write Report to %s"), *reportPath)
+		}
+	}
+
+	return graphsOverBudget > 0 ? 1 : 0;
+}
@@ -0,0 +1,34 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MounteaDialogueMemoryReportCommandlet.generated.h"
+
+/**
+ * UMounteaDialogueMemoryReportCommandlet
+ *
+ * Loads all Dialogue Graphs and reports their memory footprint, together with Data Tables and other assets they load.
+ * Memory shared by multiple Graphs is reported separately from memory exclusive to single Graph.
+ *
+ * Usage:
+ * UnrealEditor-Cmd <Project> -run=MounteaDialogueMemoryReport -nullrhi [Options]
+ *
+ * Options:
+ * -Path=/Game/Dialogues		Only Graphs under this path are reported
+ * -Top=10						Number of biggest contributors printed
+ * -BudgetKB=512				Graphs with more resident memory are reported as errors
+ * -Report=Path.csv				Writes per-Graph memory to CSV file
+ */
+UCLASS()
+class UMounteaDialogueMemoryReportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaDialogueMemoryReportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
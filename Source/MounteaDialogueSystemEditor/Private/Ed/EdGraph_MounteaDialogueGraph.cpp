@@ -13,6 +13,9 @@
 #include "Helpers/MounteaDialogueGraphEditorUtilities.h"
 #include "Helpers/MounteaDialogueSystemEditorBFC.h"
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
+#include "Data/MounteaDialogueContext.h"
+#include "Editor.h"
+#include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 
 UEdGraph_MounteaDialogueGraph::UEdGraph_MounteaDialogueGraph()
 {
@@ -22,98 +25,193 @@ UEdGraph_MounteaDialogueGraph::~UEdGraph_MounteaDialogueGraph()
 {
 }
 
-void UEdGraph_MounteaDialogueGraph::RebuildMounteaDialogueGraph()
+void UEdGraph_MounteaDialogueGraph::RebuildMounteaDialogueGraph(const bool bForceFullRebuild)
 {
 	UMounteaDialogueGraph* Graph = GetMounteaDialogueGraph();
 
-	Clear();
+	if (bForceFullRebuild || !bRebuildCacheValid)
+	{
+		Clear();
+		CachedNodeLinksHashes.Reset();
+	}
 
-	for (int i = 0; i < Nodes.Num(); ++i)
+	TArray<UEdNode_MounteaDialogueGraphNode*> EdNodes;
+	TArray<UEdNode_MounteaDialogueGraphEdge*> EdgeNodes;
+	EdNodes.Reserve(Nodes.Num());
+	for (UEdGraphNode* Node : Nodes)
 	{
-		if (UEdNode_MounteaDialogueGraphNode* EdNode = Cast<UEdNode_MounteaDialogueGraphNode>(Nodes[i]))
+		if (UEdNode_MounteaDialogueGraphNode* EdNode = Cast<UEdNode_MounteaDialogueGraphNode>(Node))
 		{
-			if (EdNode->DialogueGraphNode == nullptr)
-				continue;
+			if (EdNode->DialogueGraphNode != nullptr)
+			{
+				EdNodes.Add(EdNode);
+			}
+		}
+		else if (UEdNode_MounteaDialogueGraphEdge* EdgeNode = Cast<UEdNode_MounteaDialogueGraphEdge>(Node))
+		{
+			EdgeNodes.Add(EdgeNode);
+		}
+	}
 
-			UMounteaDialogueGraphNode* MounteaDialogueGraphNode = EdNode->DialogueGraphNode;
+	// Find Nodes which are new or whose links changed since last rebuild
+	TMap<TObjectKey<UEdNode_MounteaDialogueGraphNode>, uint32> NodeLinksHashes;
+	NodeLinksHashes.Reserve(EdNodes.Num());
+	TArray<UEdNode_MounteaDialogueGraphNode*> DirtyEdNodes;
+	bool bPositionsChanged = false;
+	bool bNodesChanged = EdNodes.Num() != Graph->AllNodes.Num();
 
-			NodeMap.Add(MounteaDialogueGraphNode, EdNode);
+	for (int32 Index = 0; Index < EdNodes.Num(); ++Index)
+	{
+		UEdNode_MounteaDialogueGraphNode* EdNode = EdNodes[Index];
+		UMounteaDialogueGraphNode* DialogueNode = EdNode->DialogueGraphNode;
 
-			Graph->AllNodes.Add(MounteaDialogueGraphNode);
+		const uint32 LinksHash = GetNodeLinksHash(*EdNode);
+		NodeLinksHashes.Add(EdNode, LinksHash);
 
-			EdNode->SetDialogueNodeIndex( Graph->AllNodes.Find(EdNode->DialogueGraphNode) );
+		const uint32* CachedLinksHash = CachedNodeLinksHashes.Find(EdNode);
+		if (!CachedLinksHash || *CachedLinksHash != LinksHash || NodeMap.FindRef(DialogueNode) != EdNode)
+		{
+			DirtyEdNodes.Add(EdNode);
+		}
+
+		bNodesChanged |= !Graph->AllNodes.IsValidIndex(Index) || Graph->AllNodes[Index] != DialogueNode;
+
+		if (DialogueNode->NodePosition != FIntPoint(EdNode->NodePosX, EdNode->NodePosY))
+		{
 			EdNode->UpdatePosition();
-			
-			for (int PinIdx = 0; PinIdx < EdNode->Pins.Num(); ++PinIdx)
-			{
-				UEdGraphPin* Pin = EdNode->Pins[PinIdx];
+			bPositionsChanged = true;
+		}
+	}
 
-				if (Pin->Direction != EEdGraphPinDirection::EGPD_Output)
-					continue;
+	TSet<UMounteaDialogueGraphNode*> AffectedChildren;
+	if (bNodesChanged)
+	{
+		TSet<UMounteaDialogueGraphNode*> CurrentNodes;
+		CurrentNodes.Reserve(EdNodes.Num());
+		for (const UEdNode_MounteaDialogueGraphNode* EdNode : EdNodes)
+		{
+			CurrentNodes.Add(EdNode->DialogueGraphNode);
+		}
 
-				for (int LinkToIdx = 0; LinkToIdx < Pin->LinkedTo.Num(); ++LinkToIdx)
+		// Detach removed Nodes, their parents are dirty as their pins changed
+		for (UMounteaDialogueGraphNode* OldNode : Graph->AllNodes)
+		{
+			if (!OldNode || CurrentNodes.Contains(OldNode))
+			{
+				continue;
+			}
+
+			for (UMounteaDialogueGraphNode* ChildNode : OldNode->ChildrenNodes)
+			{
+				if (ChildNode)
+				{
+					ChildNode->ParentNodes.Remove(OldNode);
+				}
+			}
+			for (UMounteaDialogueGraphNode* ParentNode : OldNode->ParentNodes)
+			{
+				if (ParentNode)
 				{
-					UMounteaDialogueGraphNode* ChildNode = nullptr;
-					if (UEdNode_MounteaDialogueGraphNode* EdNode_Child = Cast<UEdNode_MounteaDialogueGraphNode>(Pin->LinkedTo[LinkToIdx]->GetOwningNode()))
-					{
-						ChildNode = EdNode_Child->DialogueGraphNode;
-					}
-					else if (UEdNode_MounteaDialogueGraphEdge* EdNode_Edge = Cast<UEdNode_MounteaDialogueGraphEdge>(Pin->LinkedTo[LinkToIdx]->GetOwningNode()))
-					{
-						UEdNode_MounteaDialogueGraphNode* Child = EdNode_Edge->GetEndNode();;
-						if (Child != nullptr)
-						{
-							ChildNode = Child->DialogueGraphNode;
-						}
-					}
-
-					if (ChildNode != nullptr)
-					{
-						MounteaDialogueGraphNode->ChildrenNodes.Add(ChildNode);
-
-						ChildNode->ParentNodes.Add(MounteaDialogueGraphNode);
-					}
-					else
-					{
-						EditorLOG_ERROR(TEXT("[RebuildMounteaDialogueGraph] Can't find child node"));
-					}
+					ParentNode->ChildrenNodes.Remove(OldNode);
+					ParentNode->Edges.Remove(OldNode);
 				}
 			}
+
+			OldNode->ParentNodes.Reset();
+			OldNode->ChildrenNodes.Reset();
+			OldNode->Edges.Reset();
+			NodeMap.Remove(OldNode);
 		}
-		else if (UEdNode_MounteaDialogueGraphEdge* EdgeNode = Cast<UEdNode_MounteaDialogueGraphEdge>(Nodes[i]))
+
+		Graph->AllNodes.Reset(EdNodes.Num());
+		NodeIndexMap.Reset();
+		for (UEdNode_MounteaDialogueGraphNode* EdNode : EdNodes)
 		{
-			UEdNode_MounteaDialogueGraphNode* StartNode = EdgeNode->GetStartNode();
-			UEdNode_MounteaDialogueGraphNode* EndNode = EdgeNode->GetEndNode();
-			UMounteaDialogueGraphEdge* Edge = EdgeNode->MounteaDialogueGraphEdge;
+			UMounteaDialogueGraphNode* DialogueNode = EdNode->DialogueGraphNode;
+			const int32 NodeIndex = Graph->AllNodes.Add(DialogueNode);
+			NodeIndexMap.Add(DialogueNode, NodeIndex);
+			NodeMap.Add(DialogueNode, EdNode);
+			EdNode->SetDialogueNodeIndex(NodeIndex);
+		}
+	}
 
-			if (StartNode == nullptr || EndNode == nullptr || Edge == nullptr)
+	// Relink only dirty Nodes
+	for (UEdNode_MounteaDialogueGraphNode* EdNode : DirtyEdNodes)
+	{
+		UMounteaDialogueGraphNode* DialogueNode = EdNode->DialogueGraphNode;
+		for (UMounteaDialogueGraphNode* OldChildNode : DialogueNode->ChildrenNodes)
+		{
+			if (OldChildNode)
 			{
-				EditorLOG_ERROR(TEXT("[RebuildMounteaDialogueGraph] Add edge failed."));
-				continue;
+				OldChildNode->ParentNodes.Remove(DialogueNode);
+				AffectedChildren.Add(OldChildNode);
 			}
+		}
+		DialogueNode->ChildrenNodes.Reset();
+		DialogueNode->Edges.Reset();
+
+		NodeMap.Add(DialogueNode, EdNode);
+		DialogueNode->Graph = Graph;
+		if (DialogueNode->GetOuter() != Graph)
+		{
+			DialogueNode->Rename(nullptr, Graph, REN_DontCreateRedirectors | REN_DoNotDirty);
+		}
+	}
+	for (UEdNode_MounteaDialogueGraphNode* EdNode : DirtyEdNodes)
+	{
+		LinkDialogueNode(*EdNode, AffectedChildren);
+	}
 
-			EdgeMap.Add(Edge, EdgeNode);
+	// Keep Parents in the same order full rebuild would produce
+	for (UMounteaDialogueGraphNode* ChildNode : AffectedChildren)
+	{
+		ChildNode->ParentNodes.Sort([this](const UMounteaDialogueGraphNode& A, const UMounteaDialogueGraphNode& B)
+		{
+			return NodeIndexMap.FindRef(&A) < NodeIndexMap.FindRef(&B);
+		});
+	}
 
-			Edge->Graph = Graph;
+	EdgeMap.Reset();
+	for (UEdNode_MounteaDialogueGraphEdge* EdgeNode : EdgeNodes)
+	{
+		UEdNode_MounteaDialogueGraphNode* StartNode = EdgeNode->GetStartNode();
+		UEdNode_MounteaDialogueGraphNode* EndNode = EdgeNode->GetEndNode();
+		UMounteaDialogueGraphEdge* Edge = EdgeNode->MounteaDialogueGraphEdge;
+
+		if (StartNode == nullptr || EndNode == nullptr || Edge == nullptr)
+		{
+			EditorLOG_ERROR(TEXT("[RebuildMounteaDialogueGraph] Add edge failed."));
+			continue;
+		}
+
+		EdgeMap.Add(Edge, EdgeNode);
+
+		Edge->Graph = Graph;
+		if (Edge->GetOuter() != Graph)
+		{
 			Edge->Rename(nullptr, Graph, REN_DontCreateRedirectors | REN_DoNotDirty);
-			Edge->StartNode = StartNode->DialogueGraphNode;
-			Edge->EndNode = EndNode->DialogueGraphNode;
-			Edge->StartNode->Edges.Add(Edge->EndNode, Edge);
 		}
+		Edge->StartNode = StartNode->DialogueGraphNode;
+		Edge->EndNode = EndNode->DialogueGraphNode;
+		Edge->StartNode->Edges.Add(Edge->EndNode, Edge);
 	}
-	
-	for (int i = 0; i < Graph->AllNodes.Num(); ++i)
+
+	CachedNodeLinksHashes = MoveTemp(NodeLinksHashes);
+	bRebuildCacheValid = true;
+
+	const bool bTopologyChanged = bNodesChanged || DirtyEdNodes.Num() > 0;
+	if (!bTopologyChanged && !bPositionsChanged)
+	{
+		return;
+	}
+
+	Graph->RootNodes.Reset();
+	for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
 	{
-		UMounteaDialogueGraphNode* Node = Graph->AllNodes[i];
 		if (Node->ParentNodes.Num() == 0)
 		{
 			Graph->RootNodes.Add(Node);
-
-			//SortNodes(Node);
 		}
-
-		Node->Graph = Graph;
-		Node->Rename(nullptr, Graph, REN_DontCreateRedirectors | REN_DoNotDirty);
 	}
 
 	Graph->RootNodes.Sort([&](const UMounteaDialogueGraphNode& L, const UMounteaDialogueGraphNode& R)
@@ -126,6 +224,72 @@ void UEdGraph_MounteaDialogueGraph::RebuildMounteaDialogueGraph()
 	AssignExecutionOrder();
 }
 
+UMounteaDialogueGraphNode* UEdGraph_MounteaDialogueGraph::GetLinkedDialogueNode(const UEdGraphPin* LinkedPin)
+{
+	if (LinkedPin == nullptr)
+	{
+		return nullptr;
+	}
+	
+	if (const UEdNode_MounteaDialogueGraphNode* EdNode_Child = Cast<UEdNode_MounteaDialogueGraphNode>(LinkedPin->GetOwningNode()))
+	{
+		return EdNode_Child->DialogueGraphNode;
+	}
+	
+	if (const UEdNode_MounteaDialogueGraphEdge* EdNode_Edge = Cast<UEdNode_MounteaDialogueGraphEdge>(LinkedPin->GetOwningNode()))
+	{
+		const UEdNode_MounteaDialogueGraphNode* Child = EdNode_Edge->GetEndNode();
+		return Child != nullptr ? Child->DialogueGraphNode : nullptr;
+	}
+
+	return nullptr;
+}
+
+uint32 UEdGraph_MounteaDialogueGraph::GetNodeLinksHash(const UEdNode_MounteaDialogueGraphNode& EdNode)
+{
+	uint32 LinksHash = GetTypeHash(EdNode.DialogueGraphNode);
+	for (const UEdGraphPin* Pin : EdNode.Pins)
+	{
+		if (Pin == nullptr || Pin->Direction != EEdGraphPinDirection::EGPD_Output)
+			continue;
+
+		for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+		{
+			LinksHash = HashCombine(LinksHash, GetTypeHash(LinkedPin ? LinkedPin->GetOwningNode() : nullptr));
+			LinksHash = HashCombine(LinksHash, GetTypeHash(GetLinkedDialogueNode(LinkedPin)));
+		}
+	}
+	return LinksHash;
+}
+
+void UEdGraph_MounteaDialogueGraph::LinkDialogueNode(UEdNode_MounteaDialogueGraphNode& EdNode, TSet<UMounteaDialogueGraphNode*>& OutAffectedChildren) const
+{
+	UMounteaDialogueGraphNode* MounteaDialogueGraphNode = EdNode.DialogueGraphNode;
+	
+	for (int PinIdx = 0; PinIdx < EdNode.Pins.Num(); ++PinIdx)
+	{
+		UEdGraphPin* Pin = EdNode.Pins[PinIdx];
+
+		if (Pin->Direction != EEdGraphPinDirection::EGPD_Output)
+			continue;
+
+		for (int LinkToIdx = 0; LinkToIdx < Pin->LinkedTo.Num(); ++LinkToIdx)
+		{
+			if (UMounteaDialogueGraphNode* ChildNode = GetLinkedDialogueNode(Pin->LinkedTo[LinkToIdx]))
+			{
+				MounteaDialogueGraphNode->ChildrenNodes.Add(ChildNode);
+
+				ChildNode->ParentNodes.Add(MounteaDialogueGraphNode);
+				OutAffectedChildren.Add(ChildNode);
+			}
+			else
+			{
+				EditorLOG_ERROR(TEXT("[RebuildMounteaDialogueGraph] Can't find child node"));
+			}
+		}
+	}
+}
+
 UEdNode_MounteaDialogueGraphEdge* UEdGraph_MounteaDialogueGraph::CreateEdgeNode(UEdNode_MounteaDialogueGraphNode* StartNode, UEdNode_MounteaDialogueGraphNode* EndNode)
 {
 	UEdNode_MounteaDialogueGraphEdge* EdgeNode = NewObject<UEdNode_MounteaDialogueGraphEdge>(this);
@@ -146,20 +310,16 @@ UMounteaDialogueGraph* UEdGraph_MounteaDialogueGraph::GetMounteaDialogueGraph()
 
 bool UEdGraph_MounteaDialogueGraph::Modify(bool bAlwaysMarkDirty)
 {
-	bool Rtn = Super::Modify(bAlwaysMarkDirty);
-
-	ResetExecutionOrders();
-	AssignExecutionOrder();
-	
-	for (int32 i = 0; i < Nodes.Num(); ++i)
-	{
-		Nodes[i]->Modify();
-	}
-	return Rtn;
+	// Nodes are modified by actions which change them
+	// Modifying all of them here would record and dirty the whole Graph on every edit
+	return Super::Modify(bAlwaysMarkDirty);
 }
 
 void UEdGraph_MounteaDialogueGraph::PostEditUndo()
 {
+	// Undo restores runtime Nodes directly, cached links no longer match them
+	InvalidateRebuildCache();
+	
 	NotifyGraphChanged();
 
 	Super::PostEditUndo();
@@ -182,6 +342,7 @@ void UEdGraph_MounteaDialogueGraph::Clear()
 	
 	NodeMap.Reset();
 	EdgeMap.Reset();
+	NodeIndexMap.Reset();
 	
 	for (int i = 0; i < Nodes.Num(); ++i)
 	{
@@ -256,6 +417,58 @@ UMounteaDialogueGraphNode* UEdGraph_MounteaDialogueGraph::GetParentNode(const UM
 void UEdGraph_MounteaDialogueGraph::UpdateFocusedInstance(const FPIEInstanceData& InstanceId)
 {
 	FocusedInstance = InstanceId;
+
+	// Force re-evaluation
+	++DebugStateRevision;
+	DebugStateFrame = MAX_uint64;
+}
+
+uint32 UEdGraph_MounteaDialogueGraph::GetDebugStateRevision() const
+{
+	RefreshDebugState();
+	return DebugStateRevision;
+}
+
+bool UEdGraph_MounteaDialogueGraph::IsDebuggingFocusedInstance() const
+{
+	RefreshDebugState();
+	return bCachedDebugging;
+}
+
+const UMounteaDialogueGraphNode* UEdGraph_MounteaDialogueGraph::GetFocusedActiveNode() const
+{
+	RefreshDebugState();
+	return CachedFocusedActiveNode.Get();
+}
+
+void UEdGraph_MounteaDialogueGraph::RefreshDebugState() const
+{
+	if (DebugStateFrame == GFrameCounter)
+		return;
+
+	DebugStateFrame = GFrameCounter;
+
+	const bool bDebugging = GEditor && GEditor->IsPlayingSessionInEditor() && FocusedInstance.InstanceId != INDEX_NONE;
+
+	const UMounteaDialogueGraphNode* ActiveNode = nullptr;
+	if (bDebugging && FocusedInstance.Participant.GetObject() != nullptr)
+	{
+		const auto DialogueManager = FocusedInstance.Participant->GetDialogueManager();
+		if (DialogueManager.GetObject())
+		{
+			if (const auto DialogueContext = DialogueManager->Execute_GetDialogueContext(DialogueManager.GetObject()))
+			{
+				ActiveNode = DialogueContext->GetActiveNode();
+			}
+		}
+	}
+
+	if (bDebugging != bCachedDebugging || ActiveNode != CachedFocusedActiveNode.Get())
+	{
+		bCachedDebugging = bDebugging;
+		CachedFocusedActiveNode = ActiveNode;
+		++DebugStateRevision;
+	}
 }
 
 void UEdGraph_MounteaDialogueGraph::AssignExecutionOrder()
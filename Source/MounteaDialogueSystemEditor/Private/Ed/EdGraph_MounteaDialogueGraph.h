@@ -24,7 +24,15 @@ public:
 	UEdGraph_MounteaDialogueGraph();
 	virtual ~UEdGraph_MounteaDialogueGraph() override;
 
-	virtual void RebuildMounteaDialogueGraph();
+	/**
+	 * Rebuilds runtime Dialogue Graph from this Editor Graph.
+	 * Only Nodes whose links changed since the last rebuild are relinked, unless full rebuild is forced.
+	 * Execution Order is recalculated only if links or Node positions changed.
+	 */
+	virtual void RebuildMounteaDialogueGraph(const bool bForceFullRebuild = false);
+	// Next rebuild will be full, used when runtime Graph might have been changed outside of this Editor Graph
+	void InvalidateRebuildCache()
+	{ bRebuildCacheValid = false; };
 	UEdNode_MounteaDialogueGraphNode* CreateEdNode(UMounteaDialogueGraphNode* DialogueNode);
 	UEdNode_MounteaDialogueGraphEdge* CreateEdgeNode(UEdNode_MounteaDialogueGraphNode* StartNode, UEdNode_MounteaDialogueGraphNode* EndNode);
 
@@ -54,6 +62,16 @@ public:
 	void UpdateFocusedInstance(const FPIEInstanceData& InstanceId);
 	void AssignExecutionOrder();
 
+	/**
+	 * Revision of debugger state, changes when Focused Instance or its active Node changes.
+	 * Evaluated at most once per frame, so Node widgets don't have to walk Focused Instance → Manager → Context themselves.
+	 */
+	uint32 GetDebugStateRevision() const;
+	// Whether PIE is running and some instance is focused
+	bool IsDebuggingFocusedInstance() const;
+	// Active Node of Focused Instance, valid for current Debug State Revision
+	const UMounteaDialogueGraphNode* GetFocusedActiveNode() const;
+
 protected:
 
 	void Clear();
@@ -62,12 +80,29 @@ protected:
 	void ResetExecutionOrders() const;
 	static UMounteaDialogueGraphNode* GetParentNode(const UMounteaDialogueGraphNode& Node);
 	
+	static UMounteaDialogueGraphNode* GetLinkedDialogueNode(const UEdGraphPin* LinkedPin);
+	static uint32 GetNodeLinksHash(const UEdNode_MounteaDialogueGraphNode& EdNode);
+	void LinkDialogueNode(UEdNode_MounteaDialogueGraphNode& EdNode, TSet<UMounteaDialogueGraphNode*>& OutAffectedChildren) const;
+	
 	static void AssignNodeToLayer(UMounteaDialogueGraphNode* Node, int32 LayerIndex, TMap<int32, TArray<UMounteaDialogueGraphNode*>>& LayeredNodes);
 
 private:
 
 	TArray<UMounteaDialogueGraphNode*> CachedGraphData;
 
+	// Links of each Editor Node at the time of last rebuild, used to find changed Nodes
+	TMap<TObjectKey<UEdNode_MounteaDialogueGraphNode>, uint32> CachedNodeLinksHashes;
+	// Index of each Dialogue Node within 'AllNodes'
+	TMap<TObjectKey<UMounteaDialogueGraphNode>, int32> NodeIndexMap;
+	bool bRebuildCacheValid = false;
+
+	void RefreshDebugState() const;
+
+	mutable uint64 DebugStateFrame = MAX_uint64;
+	mutable uint32 DebugStateRevision = 0;
+	mutable bool bCachedDebugging = false;
+	mutable TWeakObjectPtr<const UMounteaDialogueGraphNode> CachedFocusedActiveNode;
+
 	/** Pointer back to the Dialogue editor that owns us */
 	TWeakPtr<FAssetEditor_MounteaDialogueGraph> DialogueEditorPtr;
 
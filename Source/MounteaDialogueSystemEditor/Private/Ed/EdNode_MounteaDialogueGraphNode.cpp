@@ -7,6 +7,7 @@
 #include "EdGraph_MounteaDialogueGraph.h"
 #include "EditorStyle/FMounteaDialogueGraphEditorStyle.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
+#include "SEdNode_MounteaDialogueGraphNode.h"
 #include "Helpers/MounteaDialogueGraphEditorHelpers.h"
 
 #define LOCTEXT_NAMESPACE "UEdNode_MounteaDialogueGraphNode"
@@ -185,21 +186,33 @@ bool UEdNode_MounteaDialogueGraphNode::Modify(bool bAlwaysMarkDirty)
 
 void UEdNode_MounteaDialogueGraphNode::UpdatePosition()
 {
-	if (DialogueGraphNode)
+	// Dirty runtime Node only when it actually moved
+	const FIntPoint NewPosition = FIntPoint(NodePosX, NodePosY);
+	if (DialogueGraphNode && DialogueGraphNode->NodePosition != NewPosition)
 	{
-		DialogueGraphNode->NodePosition = FIntPoint(NodePosX, NodePosY);
 		DialogueGraphNode->Modify(true);
+		DialogueGraphNode->NodePosition = NewPosition;
 	}
 }
 
 void UEdNode_MounteaDialogueGraphNode::PostEditUndo()
 {
 	Super::PostEditUndo();
+
+	if (SEdNode)
+	{
+		SEdNode->InvalidateDisplayState();
+	}
 }
 
 void UEdNode_MounteaDialogueGraphNode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (SEdNode)
+	{
+		SEdNode->InvalidateDisplayState();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -22,6 +22,7 @@
 #include "Graph/MounteaDialogueGraph.h"
 #include "Interfaces/Core/MounteaDialogueManagerInterface.h"
 #include "Settings/MounteaDialogueGraphEditorSettings.h"
+#include "Misc/TransactionObjectEvent.h"
 #include "Widgets/Layout/SGridPanel.h"
 #include "Widgets/Layout/SScaleBox.h"
 
@@ -116,6 +117,16 @@ void SEdNode_MounteaDialogueGraphNode::Construct(const FArguments& InArgs, UEdNo
 	}
 }
 
+SEdNode_MounteaDialogueGraphNode::~SEdNode_MounteaDialogueGraphNode()
+{
+	// Editor Node forwards Display State invalidation to its widget, it must not outlive it
+	UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode);
+	if (EdParentNode && EdParentNode->SEdNode == this)
+	{
+		EdParentNode->SEdNode = nullptr;
+	}
+}
+
 void SEdNode_MounteaDialogueGraphNode::OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
 	//bIsHovered = true;
@@ -144,15 +155,97 @@ const FSlateBrush* SEdNode_MounteaDialogueGraphNode::GetIndexBrush() const
 
 FText SEdNode_MounteaDialogueGraphNode::GetNodeTitle() const
 {
-	FText NodeTitle =  INVTEXT("Dialogue Node");
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
+	return GetDisplayState().NodeTitle;
+}
+
+const FMounteaDialogueNodeDisplayState& SEdNode_MounteaDialogueGraphNode::GetDisplayState() const
+{
+	const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode);
+
+	// Index is assigned by Graph rebuild, which doesn't notify Node widgets
+	if (EdParentNode && EdParentNode->GetDialogueNodeIndex() != CachedDisplayState.NodeIndex)
+	{
+		bDisplayStateDirty = true;
+	}
+
+	if (!bDisplayStateDirty)
+	{
+		return CachedDisplayState;
+	}
+	bDisplayStateDirty = false;
+
+	FMounteaDialogueNodeDisplayState& DisplayState = CachedDisplayState;
+	DisplayState = FMounteaDialogueNodeDisplayState();
+	DisplayState.NodeTitle = INVTEXT("Dialogue Node");
+	DisplayState.IndexText = FText::AsNumber(INDEX_NONE);
+	DisplayState.DecoratorsText = FText::FromString("DECORATORS: none");
+	DisplayState.NumberOfDecorators = FText::FromString("-");
+	DisplayState.DecoratorsInheritanceText = FText::FromString("invalid");
+
+	if (!EdParentNode || !EdParentNode->DialogueGraphNode)
 	{
-		if (EdParentNode->DialogueGraphNode)
+		return DisplayState;
+	}
+
+	const UMounteaDialogueGraphNode* Node = EdParentNode->DialogueGraphNode;
+	DisplayState.NodeIndex = EdParentNode->GetDialogueNodeIndex();
+	DisplayState.NodeTitle = Node->GetNodeTitle();
+
+	if (const auto Graph = Node->Graph)
+	{
+		DisplayState.IndexText = FText::AsNumber(Graph->AllNodes.Find(Node));
+
+		for (const auto& Itr : Graph->GetGraphDecorators())
+		{
+			if (Itr.DecoratorType != nullptr)
+			{
+				DisplayState.bHasGraphDecorators = true;
+				break;
+			}
+		}
+	}
+	else
+	{
+		DisplayState.IndexText = FText::AsNumber(Node->GetNodeIndex());
+	}
+
+	const TArray<FMounteaDialogueDecorator> NodeDecorators = Node->GetNodeDecorators();
+	DisplayState.NumNodeDecorators = NodeDecorators.Num();
+	DisplayState.bHasValidNodeDecorators = NodeDecorators.Num() > 0;
+	for (const auto& Itr : NodeDecorators)
+	{
+		if (Itr.DecoratorType == nullptr)
 		{
-			NodeTitle = EdParentNode->DialogueGraphNode->GetNodeTitle();
+			DisplayState.bHasValidNodeDecorators = false;
+			break;
 		}
 	}
-	return NodeTitle;
+
+	DisplayState.DecoratorsText = FText::FromString(FString(TEXT("DECORATORS: ")).Append(FString::FromInt(DisplayState.NumNodeDecorators)));
+	
+	if (DisplayState.NumNodeDecorators <= 0)
+	{
+		DisplayState.NumberOfDecorators = FText::FromString(TEXT("-"));
+	}
+	else if (DisplayState.NumNodeDecorators > 9)
+	{
+		DisplayState.NumberOfDecorators = FText::FromString(TEXT("9+"));
+	}
+	else
+	{
+		DisplayState.NumberOfDecorators = FText::FromString(FString::FromInt(DisplayState.NumNodeDecorators));
+	}
+
+	DisplayState.bInheritsDecorators = Node->DoesInheritDecorators();
+	DisplayState.DecoratorsInheritanceText = FText::FromString(FString(TEXT("INHERITS: ")).Append(DisplayState.bInheritsDecorators ? TEXT("yes") : TEXT("no")));
+
+	return DisplayState;
+}
+
+void SEdNode_MounteaDialogueGraphNode::InvalidateDisplayState()
+{
+	bDisplayStateDirty = true;
+	Invalidate(EInvalidateWidgetReason::Paint);
 }
 
 TSharedRef<SWidget> SEdNode_MounteaDialogueGraphNode::CreateNameSlotWidget()
@@ -173,6 +266,8 @@ BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SEdNode_MounteaDialogueGraphNode::UpdateGraphNode()
 {
+	InvalidateDisplayState();
+	
 	if (GraphNode)
 	{
 		if (auto dialogueGraphNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
@@ -294,11 +389,38 @@ void SEdNode_MounteaDialogueGraphNode::UpdateGraphNode()
 						.Size(FVector2D(0.f, 10.f))
 					]
 
+#pragma region LowDetail
+					// ZOOMED OUT BODY
+					+ SVerticalBox::Slot()
+					.Padding(FMargin(NodePadding.Left, 0.0f, NodePadding.Right, 0.0f))
+					.VAlign(VAlign_Fill)
+					[
+						SNew(SBox)
+						.MinDesiredWidth(FOptionalSize(145.f))
+						.Visibility(this, &SEdNode_MounteaDialogueGraphNode::GetLowDetailVisibility)
+						[
+							SNew(SBorder)
+							.BorderImage(this, &SEdNode_MounteaDialogueGraphNode::GetTextNodeTypeBrush)
+							.BorderBackgroundColor(this, &SEdNode_MounteaDialogueGraphNode::GetNodeTitleBackgroundColor)
+							.HAlign(HAlign_Center)
+							.VAlign(VAlign_Center)
+							.Padding(FMargin(4.0f))
+							[
+								SNew(STextBlock)
+								.Text(this, &SEdNode_MounteaDialogueGraphNode::GetNodeTitle)
+								.Justification(ETextJustify::Center)
+								.ColorAndOpacity(this, &SEdNode_MounteaDialogueGraphNode::GetFontColor)
+							]
+						]
+					]
+#pragma endregion
+
 					+ SVerticalBox::Slot()
 					.Padding(FMargin(NodePadding.Left, 0.0f, NodePadding.Right, 0.0f))
 					.VAlign(VAlign_Fill)
 					[
 						SNew(SVerticalBox)
+						.Visibility(this, &SEdNode_MounteaDialogueGraphNode::GetHighDetailVisibility)
 
 #pragma region Stack
 
@@ -1075,47 +1197,35 @@ FSlateColor SEdNode_MounteaDialogueGraphNode::GetFontColor() const
 
 bool SEdNode_MounteaDialogueGraphNode::ShouldUpdate() const
 {
-	if (!GEditor)
-		return false;
-		
-	if (!GEditor->IsPlayingSessionInEditor())
-		return false;
-
-	UEdNode_MounteaDialogueGraphNode* MyNode = CastChecked<UEdNode_MounteaDialogueGraphNode>(GraphNode);
-	const auto dialogueGraphEditor = MyNode->GetDialogueGraphEdGraph();
-	if (!dialogueGraphEditor)
-		return false;
-
-	auto focusedInstance = dialogueGraphEditor->FocusedInstance;
-	if (focusedInstance.InstanceId == INDEX_NONE)
-		return false;
-		
-	return true;
+	RefreshDebugState();
+	return bCachedShouldUpdate;
 }
 
 bool SEdNode_MounteaDialogueGraphNode::IsNodeActive() const
 {
-	UEdNode_MounteaDialogueGraphNode* MyNode = CastChecked<UEdNode_MounteaDialogueGraphNode>(GraphNode);
-	const auto dialogueGraphEditor = MyNode->GetDialogueGraphEdGraph();
-	if (!dialogueGraphEditor)
-		return false;
-
-	auto focusedInstance = dialogueGraphEditor->FocusedInstance;
-	if (focusedInstance.InstanceId == INDEX_NONE)
-		return false;
-
-	if (focusedInstance.Participant.GetObject() == nullptr)
-		return false;
+	RefreshDebugState();
+	return bCachedIsNodeActive;
+}
 
-	auto dialogueManager = focusedInstance.Participant->GetDialogueManager();
-	if (!dialogueManager.GetObject())
-		return false;
+void SEdNode_MounteaDialogueGraphNode::RefreshDebugState() const
+{
+	const UEdNode_MounteaDialogueGraphNode* MyNode = CastChecked<UEdNode_MounteaDialogueGraphNode>(GraphNode);
+	const UEdGraph_MounteaDialogueGraph* dialogueGraphEditor = MyNode->GetDialogueGraphEdGraph();
+	if (!dialogueGraphEditor)
+	{
+		bCachedShouldUpdate = false;
+		bCachedIsNodeActive = false;
+		return;
+	}
 
-	auto dialogueContext = dialogueManager->Execute_GetDialogueContext(dialogueManager.GetObject());
-	if (!dialogueContext)
-		return false;
+	// Graph evaluates Focused Instance once per frame, Node only compares revision
+	const uint32 debugStateRevision = dialogueGraphEditor->GetDebugStateRevision();
+	if (debugStateRevision == CachedDebugStateRevision)
+		return;
 
-	return dialogueContext->GetActiveNode() == MyNode->DialogueGraphNode;
+	CachedDebugStateRevision = debugStateRevision;
+	bCachedShouldUpdate = dialogueGraphEditor->IsDebuggingFocusedInstance();
+	bCachedIsNodeActive = MyNode->DialogueGraphNode != nullptr && dialogueGraphEditor->GetFocusedActiveNode() == MyNode->DialogueGraphNode;
 }
 
 FSlateColor SEdNode_MounteaDialogueGraphNode::GetBorderBackgroundColor() const
@@ -1183,24 +1293,12 @@ const FSlateBrush* SEdNode_MounteaDialogueGraphNode::GetNameIcon() const
 
 const FSlateBrush* SEdNode_MounteaDialogueGraphNode::GetInheritsImageBrush() const
 {
-	bool bHasDecorators = false;
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-	{
-		if (EdParentNode->DialogueGraphNode)
-		{
-			bHasDecorators =  EdParentNode->DialogueGraphNode->DoesInheritDecorators() ;
-		}
-	}
-	
-	return FMounteaDialogueGraphEditorStyle::GetBrush( bHasDecorators ? "MDSStyleSet.Icon.OK" : "MDSStyleSet.Icon.Error" );
+	return FMounteaDialogueGraphEditorStyle::GetBrush( GetDisplayState().bInheritsDecorators ? "MDSStyleSet.Icon.OK" : "MDSStyleSet.Icon.Error" );
 }
 
 FSlateColor SEdNode_MounteaDialogueGraphNode::GetInheritsImageTint() const
 {
-	bool bHasDecorators = false;
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-		if (EdParentNode->DialogueGraphNode)
-			bHasDecorators = EdParentNode->DialogueGraphNode->DoesInheritDecorators();
+	const bool bHasDecorators = GetDisplayState().bInheritsDecorators;
 	
 	const FSlateColor BaseColor = bHasDecorators ? 
 		FSlateColor(FLinearColor::Green) : 
@@ -1224,20 +1322,7 @@ FText SEdNode_MounteaDialogueGraphNode::GetIndexOverlayTooltipText() const
 
 FText SEdNode_MounteaDialogueGraphNode::GetIndexText() const
 {
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-	{
-		if (const auto Node = EdParentNode->DialogueGraphNode)
-		{
-			if (const auto Graph = Node->Graph)
-			{
-				const int32 Index = Graph->AllNodes.Find(Node);
-				return FText::AsNumber(Index);
-			}
-			
-			return FText::AsNumber(EdParentNode->DialogueGraphNode->GetNodeIndex());
-		}
-	}
-	return FText::AsNumber(INDEX_NONE);
+	return GetDisplayState().IndexText;
 }
 
 EVisibility SEdNode_MounteaDialogueGraphNode::GetIndexSlotVisibility() const
@@ -1282,46 +1367,12 @@ FSlateColor SEdNode_MounteaDialogueGraphNode::GetOverlayWidgetBackgroundColor(bo
 
 bool SEdNode_MounteaDialogueGraphNode::HasGraphDecorators() const
 {
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-	{
-		if (EdParentNode->DialogueGraphNode && EdParentNode->DialogueGraphNode->Graph)
-		{
-			for (const auto& Itr :  EdParentNode->DialogueGraphNode->Graph->GetGraphDecorators())
-			{
-				if (Itr.DecoratorType != nullptr)
-				{
-					return true;
-				}
-			}
-		}
-	}
-
-	return false;
+	return GetDisplayState().bHasGraphDecorators;
 }
 
 bool SEdNode_MounteaDialogueGraphNode::HasNodeDecorators() const
 {
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-	{
-		if (EdParentNode->DialogueGraphNode)
-		{
-			if (EdParentNode->DialogueGraphNode->GetNodeDecorators().Num() > 0)
-			{
-				bool bAllValid = true;
-
-				for (const auto& Itr : EdParentNode->DialogueGraphNode->GetNodeDecorators())
-				{
-					if (Itr.DecoratorType == nullptr)
-					{
-						bAllValid = false;
-					}
-				}
-				return bAllValid;
-			}
-		}
-	}
-
-	return false;
+	return GetDisplayState().bHasValidNodeDecorators;
 }
 
 EVisibility SEdNode_MounteaDialogueGraphNode::ShowImplementsOnlySlot_Unified() const
@@ -1338,32 +1389,12 @@ EVisibility SEdNode_MounteaDialogueGraphNode::ShowImplementsOnlySlot_Unified() c
 
 FText SEdNode_MounteaDialogueGraphNode::GetDecoratorsText() const
 {
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-	{
-		if (EdParentNode->DialogueGraphNode)
-		{
-			FString Number = FString::FromInt(EdParentNode->DialogueGraphNode->GetNodeDecorators().Num());
-			FString ReturnText = FString(TEXT("DECORATORS: "));
-			return FText::FromString( ReturnText.Append(Number) );
-		}
-	}
-	return FText::FromString("DECORATORS: none");
+	return GetDisplayState().DecoratorsText;
 }
 
 FText SEdNode_MounteaDialogueGraphNode::GetNumberOfDecorators() const
 {
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-	{
-		if (EdParentNode->DialogueGraphNode)
-		{
-			const int32 Number = EdParentNode->DialogueGraphNode->GetNodeDecorators().Num();
-			if (Number <= 0) return FText::FromString(TEXT("-"));
-			if (Number > 9) return FText::FromString(TEXT("9+"));
-			
-			return FText::FromString(FString::FromInt(Number));
-		}
-	}
-	return FText::FromString("-");
+	return GetDisplayState().NumberOfDecorators;
 }
 
 EVisibility SEdNode_MounteaDialogueGraphNode::ShowInheritsDecoratorsSlot_Unified() const
@@ -1444,7 +1475,7 @@ FSlateColor SEdNode_MounteaDialogueGraphNode::GetImplementsRowColor() const
 	if (!EdParentNode || !EdParentNode->DialogueGraphNode)
 		return GetFontColor();
 
-	return EdParentNode->DialogueGraphNode->GetNodeDecorators().Num() == 0 
+	return GetDisplayState().NumNodeDecorators == 0 
 		? MounteaDialogueGraphColors::TextColors::Disabled 
 		: GetFontColor();
 }
@@ -1455,7 +1486,7 @@ FSlateColor SEdNode_MounteaDialogueGraphNode::GetBulletPointsImagePointColor_Imp
 	if (!EdParentNode || !EdParentNode->DialogueGraphNode)
 		return MounteaDialogueGraphColors::BulletPointsColors::Normal;
 
-	const bool bImplements = EdParentNode->DialogueGraphNode->GetNodeDecorators().Num() > 0;
+	const bool bImplements = GetDisplayState().NumNodeDecorators > 0;
 
 	if (!ShouldUpdate())
 		return bImplements
@@ -1472,7 +1503,7 @@ FSlateColor SEdNode_MounteaDialogueGraphNode::GetBulletPointsImagePointColor_Inh
 	if (!EdParentNode || !EdParentNode->DialogueGraphNode)
 		return MounteaDialogueGraphColors::BulletPointsColors::Normal;
 
-	const bool bInherits = EdParentNode->DialogueGraphNode->DoesInheritDecorators();
+	const bool bInherits = GetDisplayState().bInheritsDecorators;
 
 	if (!ShouldUpdate())
 		return bInherits
@@ -1485,15 +1516,7 @@ FSlateColor SEdNode_MounteaDialogueGraphNode::GetBulletPointsImagePointColor_Inh
 
 FText SEdNode_MounteaDialogueGraphNode::GetDecoratorsInheritanceText() const
 {
-	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
-	{
-		if (EdParentNode->DialogueGraphNode)
-		{
-			FString Result =  EdParentNode->DialogueGraphNode->DoesInheritDecorators() ? TEXT("yes") : TEXT("no") ;
-			return FText::FromString( FString(TEXT("INHERITS: ")).Append(Result) );
-		}
-	}
-	return FText::FromString("invalid");
+	return GetDisplayState().DecoratorsInheritanceText;
 }
 
 EDecoratorsInfoStyle SEdNode_MounteaDialogueGraphNode::GetDecoratorsStyle() const
@@ -1543,6 +1566,28 @@ EVisibility SEdNode_MounteaDialogueGraphNode::GetUnifiedVisibility() const
 	return GetDecoratorsStyle() == EDecoratorsInfoStyle::EDIS_Unified ? EVisibility::SelfHitTestInvisible : EVisibility::Collapsed;
 }
 
+bool SEdNode_MounteaDialogueGraphNode::UseLowDetail() const
+{
+	const UMounteaDialogueGraphEditorSettings* Settings = GraphEditorSettings ? GraphEditorSettings.Get() : GetDefault<UMounteaDialogueGraphEditorSettings>();
+	if (!Settings || !Settings->SimplifyZoomedOutNodes())
+	{
+		return false;
+	}
+
+	return GetCurrentLOD() <= EGraphRenderingLOD::LowDetail;
+}
+
+EVisibility SEdNode_MounteaDialogueGraphNode::GetLowDetailVisibility() const
+{
+	return UseLowDetail() ? EVisibility::SelfHitTestInvisible : EVisibility::Collapsed;
+}
+
+EVisibility SEdNode_MounteaDialogueGraphNode::GetHighDetailVisibility() const
+{
+	// Collapsed widgets are skipped by both prepass and paint, so decorators info costs nothing while zoomed out
+	return UseLowDetail() ? EVisibility::Collapsed : EVisibility::SelfHitTestInvisible;
+}
+
 FText SEdNode_MounteaDialogueGraphNode::GetTooltipText() const
 {
 	if (const UEdNode_MounteaDialogueGraphNode* EdParentNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
@@ -8,6 +8,26 @@
 enum class EDecoratorsInfoStyle : uint8;
 class UEdNode_MounteaDialogueGraphNode;
 
+/**
+ * Display state of Node widget computed from Node data.
+ * Cached, so Slate attributes don't copy Decorator arrays and format texts on every paint.
+ */
+struct FMounteaDialogueNodeDisplayState
+{
+	FText NodeTitle;
+	FText IndexText;
+	FText DecoratorsText;
+	FText NumberOfDecorators;
+	FText DecoratorsInheritanceText;
+
+	int32 NodeIndex = INDEX_NONE;
+	int32 NumNodeDecorators = 0;
+	
+	bool bHasGraphDecorators = false;
+	bool bHasValidNodeDecorators = false;
+	bool bInheritsDecorators = false;
+};
+
 class SEdNode_MounteaDialogueGraphNode : public SGraphNode
 {
 	
@@ -16,6 +36,7 @@ public:
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs, UEdNode_MounteaDialogueGraphNode* InNode);
+	virtual ~SEdNode_MounteaDialogueGraphNode() override;
 
 	virtual void OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
@@ -80,6 +101,11 @@ public:
 	EVisibility GetStackVisibility() const;
 	EVisibility GetUnifiedVisibility() const;
 
+	// Whether Node is zoomed out enough to be drawn as simple box
+	bool UseLowDetail() const;
+	EVisibility GetLowDetailVisibility() const;
+	EVisibility GetHighDetailVisibility() const;
+
 	FText GetTooltipText() const;
 
 	TSharedRef<SWidget> CreateNameSlotWidget();
@@ -87,6 +113,14 @@ public:
 	bool ShouldUpdate() const;
 	bool IsNodeActive() const;
 
+	// Marks cached Display State as outdated, it is recomputed on next access
+	void InvalidateDisplayState();
+
+protected:
+
+	const FMounteaDialogueNodeDisplayState& GetDisplayState() const;
+	void RefreshDebugState() const;
+
 protected:
 	TSharedPtr<SBorder> NodeBody;
 	TSharedPtr<SHorizontalBox> OutputPinBox;
@@ -95,4 +129,12 @@ protected:
 
 	FLinearColor NodeInnerColor;
 	FLinearColor PinsDockColor;
+
+	mutable FMounteaDialogueNodeDisplayState CachedDisplayState;
+	mutable bool bDisplayStateDirty = true;
+
+	// Debugger state, refreshed only when Graph Debug State Revision changes
+	mutable uint32 CachedDebugStateRevision = MAX_uint32;
+	mutable bool bCachedShouldUpdate = false;
+	mutable bool bCachedIsNodeActive = false;
 };
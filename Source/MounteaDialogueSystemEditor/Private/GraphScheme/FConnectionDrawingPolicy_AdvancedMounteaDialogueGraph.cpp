@@ -12,9 +12,12 @@ FConnectionDrawingPolicy_AdvancedMounteaDialogueGraph::FConnectionDrawingPolicy_
 	, ZoomFactor(InZoomFactor)
 	, RoundRadius(FMath::Clamp(20.0f / InZoomFactor, 5.0f, 10.0f))
 	, WireThickness(1.5f)
+	, bCullOffscreenWires(false)
 {
 	if (const UMounteaDialogueGraphEditorSettings* GraphEditorSettings = GetMutableDefault<UMounteaDialogueGraphEditorSettings>())
 	{
+		bCullOffscreenWires = GraphEditorSettings->CullOffscreenWires();
+
 		switch (GraphEditorSettings->GetArrowType())
 		{
 		case EArrowType::ERT_SimpleArrow:
@@ -64,6 +67,11 @@ FVector2D FConnectionDrawingPolicy_AdvancedMounteaDialogueGraph::ComputeSplineTa
 
 void FConnectionDrawingPolicy_AdvancedMounteaDialogueGraph::DrawManhattanConnection(const FVector2D& Start, const FVector2D& End, const FConnectionParams& Params)
 {
+	if (IsConnectionCulled(Start, End))
+	{
+		return;
+	}
+
 	const float DistanceY = End.Y - Start.Y;
 	const float DistanceX = End.X - Start.X;
 
@@ -132,6 +140,24 @@ float FConnectionDrawingPolicy_AdvancedMounteaDialogueGraph::GetRadiusOffset(con
 	return RadiusOffset * ZoomFactor * FMath::Clamp(RoundRadius, 10.0f, 20.0f);  // Clamp the radius for stability
 }
 
+bool FConnectionDrawingPolicy_AdvancedMounteaDialogueGraph::IsConnectionCulled(const FVector2D& Start, const FVector2D& End) const
+{
+	if (!bCullOffscreenWires)
+	{
+		return false;
+	}
+
+	// Control points stay within end points bounds, only arrow can reach outside
+	const float CullingSlack = 16.0f * ZoomFactor + WireThickness;
+	const FSlateRect ConnectionBounds(
+		FMath::Min(Start.X, End.X) - CullingSlack,
+		FMath::Min(Start.Y, End.Y) - CullingSlack,
+		FMath::Max(Start.X, End.X) + CullingSlack,
+		FMath::Max(Start.Y, End.Y) + CullingSlack);
+
+	return !FSlateRect::DoRectanglesIntersect(ConnectionBounds, ClippingRect);
+}
+
 void FConnectionDrawingPolicy_AdvancedMounteaDialogueGraph::DrawArrow(const FVector2D& StartPoint, const FVector2D& EndPoint, const FConnectionParams& Params)
 {
 	if (!ArrowImage)
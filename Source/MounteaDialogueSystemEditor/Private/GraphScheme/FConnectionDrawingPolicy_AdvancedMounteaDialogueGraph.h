@@ -21,11 +21,15 @@ protected:
 
 	float GetRadiusOffset(const int32& AngleDeg, bool Perpendicular = false) const;
 
+	// Whether connection including its arrow lies completely outside of visible Graph area
+	bool IsConnectionCulled(const FVector2D& Start, const FVector2D& End) const;
+
 private:
 	int32 StoredBackLayerID;
 	int32 StoredFrontLayerID;
 	float ZoomFactor;
 	float RoundRadius;
 	float WireThickness;
+	bool bCullOffscreenWires;
 };
 
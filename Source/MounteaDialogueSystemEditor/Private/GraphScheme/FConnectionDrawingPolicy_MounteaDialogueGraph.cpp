@@ -45,6 +45,13 @@ FConnectionDrawingPolicy_MounteaDialogueGraph::FConnectionDrawingPolicy_MounteaD
 	HoverDeemphasisDarkFraction = 0.8f;
 
 	BubbleImage = FAppStyle::GetBrush( TEXT("Graph.Arrow") );
+
+	if (const UMounteaDialogueGraphEditorSettings* GraphEditorSettings = GetDefault<UMounteaDialogueGraphEditorSettings>())
+	{
+		bCullOffscreenWires = GraphEditorSettings->CullOffscreenWires();
+		CullingSlack = GraphEditorSettings->GetAdvancedWiringConnectionTangent().GetAbs().GetMax() * ZoomFactor;
+	}
+	CullingSlack += ArrowRadius.GetMax() * 2.f + 5.f;
 }
 
 void FConnectionDrawingPolicy_MounteaDialogueGraph::DetermineWiringStyle(UEdGraphPin* OutputPin, UEdGraphPin* InputPin, FConnectionParams& Params)
@@ -160,8 +167,29 @@ void FConnectionDrawingPolicy_MounteaDialogueGraph::DetermineLinkGeometry(FArran
 	}
 }
 
+bool FConnectionDrawingPolicy_MounteaDialogueGraph::IsConnectionCulled(const FVector2D& Start, const FVector2D& End) const
+{
+	if (!bCullOffscreenWires)
+	{
+		return false;
+	}
+
+	const FSlateRect ConnectionBounds(
+		FMath::Min(Start.X, End.X) - CullingSlack,
+		FMath::Min(Start.Y, End.Y) - CullingSlack,
+		FMath::Max(Start.X, End.X) + CullingSlack,
+		FMath::Max(Start.Y, End.Y) + CullingSlack);
+
+	return !FSlateRect::DoRectanglesIntersect(ConnectionBounds, ClippingRect);
+}
+
 void FConnectionDrawingPolicy_MounteaDialogueGraph::Internal_DrawLineWithArrow(const FVector2D& StartAnchorPoint, const FVector2D& EndAnchorPoint, const FConnectionParams& Params)
 {
+	if (IsConnectionCulled(StartAnchorPoint, EndAnchorPoint))
+	{
+		return;
+	}
+
 	const FVector2D DeltaPos = EndAnchorPoint - StartAnchorPoint;
 	const FVector2D UnitDelta = DeltaPos.GetSafeNormal();
 
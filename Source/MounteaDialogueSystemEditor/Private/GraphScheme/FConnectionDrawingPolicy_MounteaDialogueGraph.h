@@ -30,8 +30,15 @@ protected:
 	
 	virtual void DrawConnection(int32 LayerId, const FVector2D& Start, const FVector2D& End, const FConnectionParams& Params) override;
 
+	// Whether connection including its curve and arrow lies completely outside of visible Graph area
+	bool IsConnectionCulled(const FVector2D& Start, const FVector2D& End) const;
+
 protected:
 	UEdGraph* GraphObj;
 	TMap<UEdGraphNode*, int32> NodeWidgetMap;
+
+	// Distance the curve and arrow can reach outside of bounds given by connection end points
+	float CullingSlack = 0.f;
+	bool bCullOffscreenWires = false;
 	
 };
@@ -2,13 +2,18 @@
 
 #include "MounteaDialogueFixUtilities.h"
 
+#include "BlueprintCompilationManager.h"
 #include "EditorUtilityLibrary.h"
 #include "K2Node_CallFunction.h"
+#include "MessageLogModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
 #include "Dom/JsonObject.h"
+#include "Helpers/MounteaDialogueGraphEditorHelpers.h"
 #include "K2Nodes/K2Node_MounteaDialogueCallFunction.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "Kismet2/KismetEditorUtilities.h"
+#include "Logging/MessageLog.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
@@ -248,14 +253,251 @@ void FMounteaDialogueFixUtilities::ReplaceNodesInSelectedBlueprints()
 		return;
 	}
 
+	TArray<UBlueprint*> ModifiedBlueprints;
 	TArray<FAssetData> SelectedAssets = UEditorUtilityLibrary::GetSelectedAssetData();
 	for (const FAssetData& Asset : SelectedAssets)
 	{
 		if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
 		{
-			ProcessBlueprint(Blueprint, Rules);
+			if (ProcessBlueprint(Blueprint, Rules) > 0)
+			{
+				ModifiedBlueprints.Add(Blueprint);
+			}
 		}
 	}
+
+	TArray<UBlueprint*> FailedBlueprints;
+	CompileBlueprintsInBatches(ModifiedBlueprints, FailedBlueprints);
+}
+
+void FMounteaDialogueFixUtilities::ReplaceNodesInProjectBlueprints()
+{
+	FixProjectBlueprints(false);
+}
+
+void FMounteaDialogueFixUtilities::ReportNodesInProjectBlueprints()
+{
+	FixProjectBlueprints(true);
+}
+
+FName FMounteaDialogueFixUtilities::GetMessageLogName()
+{
+	static const FName MessageLogName(TEXT("MounteaDialogueFixUp"));
+	return MessageLogName;
+}
+
+void FMounteaDialogueFixUtilities::FixProjectBlueprints(const bool bDryRun)
+{
+	const TArray<FNodeReplacementRule> Rules = LoadReplacementRules();
+	if (Rules.Num() == 0)
+	{
+		EditorLOG_WARNING(TEXT("[FixProjectBlueprints] No node replacement rules found"));
+		return;
+	}
+
+	FMessageLogModule& MessageLogModule = FModuleManager::LoadModuleChecked<FMessageLogModule>("MessageLog");
+	if (!MessageLogModule.IsRegisteredLogListing(GetMessageLogName()))
+	{
+		MessageLogModule.RegisterLogListing(GetMessageLogName(), NSLOCTEXT("MounteaDialogueFixUtilities", "FixUpLog", "Mountea Nodes Fix-up"));
+	}
+	FMessageLog FixUpLog(GetMessageLogName());
+	FixUpLog.NewPage(FText::FromString(bDryRun ? TEXT("Fix Mountea Nodes (Dry Run)") : TEXT("Fix Mountea Nodes")));
+
+	const double StartTime = FPlatformTime::Seconds();
+	double StepStartTime = StartTime;
+	TArray<TPair<FString, double>> Timings;
+	auto recordStep = [&Timings, &StepStartTime](const TCHAR* StepName)
+	{
+		Timings.Emplace(StepName, FPlatformTime::Seconds() - StepStartTime);
+		StepStartTime = FPlatformTime::Seconds();
+	};
+
+	// 1. Only Blueprints referencing affected packages are loaded
+	TArray<FAssetData> CandidateBlueprints;
+	GatherCandidateBlueprints(Rules, CandidateBlueprints);
+	recordStep(TEXT("Asset Registry query"));
+
+	// 2. Load and scan candidates
+	TArray<TPair<UBlueprint*, int32>> AffectedBlueprints;
+	bool bCancelled = false;
+	{
+		FScopedSlowTask SlowTask(CandidateBlueprints.Num(), NSLOCTEXT("MounteaDialogueFixUtilities", "ScanBlueprints", "Scanning Blueprints for deprecated Mountea nodes..."));
+		SlowTask.MakeDialog(true);
+
+		for (const FAssetData& Asset : CandidateBlueprints)
+		{
+			if (SlowTask.ShouldCancel())
+			{
+				bCancelled = true;
+				break;
+			}
+			SlowTask.EnterProgressFrame(1, FText::FromName(Asset.AssetName));
+
+			if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+			{
+				const int32 ReplaceableNodes = CountReplaceableNodes(Blueprint, Rules);
+				if (ReplaceableNodes > 0)
+				{
+					AffectedBlueprints.Emplace(Blueprint, ReplaceableNodes);
+				}
+			}
+		}
+	}
+	recordStep(TEXT("Load and scan"));
+
+	int32 ReplacedNodes = 0;
+	TArray<UBlueprint*> FailedBlueprints;
+	if (bDryRun || bCancelled)
+	{
+		for (const auto& AffectedBlueprint : AffectedBlueprints)
+		{
+			FixUpLog.Info(FText::Format(NSLOCTEXT("MounteaDialogueFixUtilities", "DryRunEntry", "{0}: {1} node(s) would be replaced"), FText::FromString(AffectedBlueprint.Key->GetPathName()), AffectedBlueprint.Value));
+		}
+	}
+	else
+	{
+		// 3. Replace Nodes
+		TArray<UBlueprint*> ModifiedBlueprints;
+		for (const auto& AffectedBlueprint : AffectedBlueprints)
+		{
+			const int32 BlueprintReplacedNodes = ProcessBlueprint(AffectedBlueprint.Key, Rules);
+			if (BlueprintReplacedNodes > 0)
+			{
+				ReplacedNodes += BlueprintReplacedNodes;
+				ModifiedBlueprints.Add(AffectedBlueprint.Key);
+				FixUpLog.Info(FText::Format(NSLOCTEXT("MounteaDialogueFixUtilities", "ReplacedEntry", "{0}: {1} node(s) replaced"), FText::FromString(AffectedBlueprint.Key->GetPathName()), BlueprintReplacedNodes));
+			}
+		}
+		recordStep(TEXT("Replace nodes"));
+
+		// 4. Compile
+		CompileBlueprintsInBatches(ModifiedBlueprints, FailedBlueprints);
+		for (const UBlueprint* FailedBlueprint : FailedBlueprints)
+		{
+			FixUpLog.Error(FText::Format(NSLOCTEXT("MounteaDialogueFixUtilities", "CompileFailed", "{0}: compilation failed"), FText::FromString(FailedBlueprint->GetPathName())));
+		}
+		recordStep(TEXT("Compile"));
+	}
+
+	if (bCancelled)
+	{
+		FixUpLog.Warning(NSLOCTEXT("MounteaDialogueFixUtilities", "Cancelled", "Scan was cancelled, no node has been replaced."));
+	}
+
+	FString Summary = FString::Printf(TEXT("%s: %d Blueprint(s) found by Asset Registry, %d affected, %d node(s) replaced, %d failed to compile. Took %.2f s"),
+		bDryRun ? TEXT("Dry run") : TEXT("Fix-up"), CandidateBlueprints.Num(), AffectedBlueprints.Num(), ReplacedNodes, FailedBlueprints.Num(), FPlatformTime::Seconds() - StartTime);
+	for (const auto& Timing : Timings)
+	{
+		Summary.Append(FString::Printf(TEXT("\n- %s: %.2f s"), *Timing.Key, Timing.Value));
+	}
+	
+	FixUpLog.Info(FText::FromString(Summary));
+	EditorLOG_INFO(TEXT("[FixProjectBlueprints] %s"), *Summary);
+	
+	FixUpLog.Open(EMessageSeverity::Info, true);
+}
+
+void FMounteaDialogueFixUtilities::GatherCandidateBlueprints(const TArray<FNodeReplacementRule>& Rules, TArray<FAssetData>& OutBlueprints)
+{
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// Blueprint calling a function depends on package which owns it
+	TSet<FName> AffectedPackages;
+	for (const FNodeReplacementRule& Rule : Rules)
+	{
+		if (Rule.OldNode.Parent.IsEmpty())
+		{
+			// Parent of broken nodes is unknown, so any Blueprint using the plugin is a candidate
+			AffectedPackages.Add(FName(TEXT("/Script/MounteaDialogueSystem")));
+		}
+		else
+		{
+			AffectedPackages.Add(FName(*FPackageName::ObjectPathToPackageName(Rule.OldNode.Parent)));
+		}
+	}
+
+	TSet<FName> ReferencerPackages;
+	for (const FName& AffectedPackage : AffectedPackages)
+	{
+		TArray<FName> Referencers;
+		AssetRegistry.GetReferencers(AffectedPackage, Referencers, UE::AssetRegistry::EDependencyCategory::Package);
+		for (const FName& Referencer : Referencers)
+		{
+			// Engine and native packages are never fixed
+			const FString ReferencerName = Referencer.ToString();
+			if (!ReferencerName.StartsWith(TEXT("/Script/")) && !ReferencerName.StartsWith(TEXT("/Engine/")))
+			{
+				ReferencerPackages.Add(Referencer);
+			}
+		}
+	}
+
+	if (ReferencerPackages.Num() == 0)
+	{
+		return;
+	}
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackageNames = ReferencerPackages.Array();
+
+	AssetRegistry.GetAssets(Filter, OutBlueprints);
+}
+
+void FMounteaDialogueFixUtilities::CompileBlueprintsInBatches(const TArray<UBlueprint*>& Blueprints, TArray<UBlueprint*>& OutFailedBlueprints)
+{
+	if (Blueprints.Num() == 0)
+	{
+		return;
+	}
+	
+	// Depth in Blueprint class hierarchy, parents must be compiled before children
+	TMap<const UBlueprint*, int32> BlueprintDepths;
+	for (const UBlueprint* Blueprint : Blueprints)
+	{
+		int32 Depth = 0;
+		for (const UClass* ParentClass = Blueprint->ParentClass; ParentClass && UBlueprint::GetBlueprintFromClass(ParentClass); ParentClass = ParentClass->GetSuperClass())
+		{
+			Depth++;
+		}
+		BlueprintDepths.Add(Blueprint, Depth);
+	}
+
+	TArray<UBlueprint*> SortedBlueprints = Blueprints;
+	SortedBlueprints.StableSort([&BlueprintDepths](const UBlueprint& A, const UBlueprint& B)
+	{
+		return BlueprintDepths.FindRef(&A) < BlueprintDepths.FindRef(&B);
+	});
+
+	FScopedSlowTask SlowTask(SortedBlueprints.Num(), NSLOCTEXT("MounteaDialogueFixUtilities", "CompileBlueprints", "Compiling fixed Blueprints..."));
+	SlowTask.MakeDialog();
+
+	int32 BatchStart = 0;
+	while (BatchStart < SortedBlueprints.Num())
+	{
+		// Batch never mixes depths, so parents are always reinstanced first
+		const int32 BatchDepth = BlueprintDepths.FindRef(SortedBlueprints[BatchStart]);
+		int32 BatchEnd = BatchStart;
+		while (BatchEnd < SortedBlueprints.Num() && BatchEnd - BatchStart < CompileBatchSize && BlueprintDepths.FindRef(SortedBlueprints[BatchEnd]) == BatchDepth)
+		{
+			FBlueprintCompilationManager::QueueForCompilation(SortedBlueprints[BatchEnd]);
+			BatchEnd++;
+		}
+
+		SlowTask.EnterProgressFrame(BatchEnd - BatchStart);
+		FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+
+		for (int32 Index = BatchStart; Index < BatchEnd; Index++)
+		{
+			if (SortedBlueprints[Index]->Status == BS_Error)
+			{
+				OutFailedBlueprints.Add(SortedBlueprints[Index]);
+			}
+		}
+
+		BatchStart = BatchEnd;
+	}
 }
 
 bool FMounteaDialogueFixUtilities::CanExecute()
@@ -263,9 +505,9 @@ bool FMounteaDialogueFixUtilities::CanExecute()
 	return UEditorUtilityLibrary::GetSelectedAssetData().Num() > 0;
 }
 
-void FMounteaDialogueFixUtilities::ProcessBlueprint(UBlueprint* Blueprint, const TArray<FNodeReplacementRule>& Rules)
+int32 FMounteaDialogueFixUtilities::ProcessBlueprint(UBlueprint* Blueprint, const TArray<FNodeReplacementRule>& Rules)
 {
-	bool bModified = false;
+	int32 ReplacedNodes = 0;
 	
 	TArray<UEdGraph*> AllGraphs;
 	Blueprint->GetAllGraphs(AllGraphs);
@@ -287,18 +529,52 @@ void FMounteaDialogueFixUtilities::ProcessBlueprint(UBlueprint* Blueprint, const
 				if (ShouldReplaceNode(Node, Rule.OldNode))
 				{
 					ReplaceNode(Graph, Node, Rule.NewNode, Rule.OldNode);
-					bModified = true;
+					ReplacedNodes++;
 					break;
 				}
 			}
 		}
 	}
 
-	if (bModified)
+	if (ReplacedNodes > 0)
 	{
 		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	}
+
+	return ReplacedNodes;
+}
+
+int32 FMounteaDialogueFixUtilities::CountReplaceableNodes(UBlueprint* Blueprint, const TArray<FNodeReplacementRule>& Rules)
+{
+	int32 ReplaceableNodes = 0;
+	
+	TArray<UEdGraph*> AllGraphs;
+	Blueprint->GetAllGraphs(AllGraphs);
+
+	for (const UEdGraph* Graph : AllGraphs)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+
+		TArray<UK2Node*> AllNodes;
+		Graph->GetNodesOfClass(AllNodes);
+
+		for (UK2Node* Node : AllNodes)
+		{
+			for (const FNodeReplacementRule& Rule : Rules)
+			{
+				if (ShouldReplaceNode(Node, Rule.OldNode))
+				{
+					ReplaceableNodes++;
+					break;
+				}
+			}
+		}
+	}
+
+	return ReplaceableNodes;
 }
 
 bool FMounteaDialogueFixUtilities::ShouldReplaceNode(UK2Node* Node, const FNodeReplacementRule::FOldNode& OldNodeDef)
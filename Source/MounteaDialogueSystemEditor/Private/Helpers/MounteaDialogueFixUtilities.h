@@ -2,6 +2,8 @@
 
 #pragma once
 
+struct FAssetData;
+
 struct FNodeReplacementRule
 {
     // Old node definition
@@ -36,14 +38,31 @@ class FMounteaDialogueFixUtilities
 
 private:
 	static TArray<FNodeReplacementRule> LoadReplacementRules();
-	static void ProcessBlueprint(UBlueprint* Blueprint, const TArray<FNodeReplacementRule>& Rules);
+	// Returns number of replaced Nodes, Blueprint is not compiled
+	static int32 ProcessBlueprint(UBlueprint* Blueprint, const TArray<FNodeReplacementRule>& Rules);
+	static int32 CountReplaceableNodes(UBlueprint* Blueprint, const TArray<FNodeReplacementRule>& Rules);
 	static bool ShouldReplaceNode(UK2Node* Node, const FNodeReplacementRule::FOldNode& OldNodeDef);
 	static void ReplaceNode(UEdGraph* Graph, UK2Node* OldNode, const FNodeReplacementRule::FNewNode& NewNodeDef, const FNodeReplacementRule::FOldNode& OldNodeDef);
 	static void ReconnectPins(UK2Node* OldNode, UK2Node* NewNode);
 	static UFunction* FindFunction(const FString& ParentPath, const FString& FunctionName);
 
+	// Finds Blueprints depending on packages of replaced functions, without loading any Blueprint
+	static void GatherCandidateBlueprints(const TArray<FNodeReplacementRule>& Rules, TArray<FAssetData>& OutBlueprints);
+	// Compiles parent Blueprints before their children, each batch is flushed at once
+	static void CompileBlueprintsInBatches(const TArray<UBlueprint*>& Blueprints, TArray<UBlueprint*>& OutFailedBlueprints);
+	static void FixProjectBlueprints(const bool bDryRun);
+	static FName GetMessageLogName();
+
+	// Number of Blueprints queued for compilation at once
+	static constexpr int32 CompileBatchSize = 32;
+
 public:
 
 	static void ReplaceNodesInSelectedBlueprints();
 	static bool CanExecute();
+
+	// Replaces Nodes in all Blueprints of the project which reference replaced functions
+	static void ReplaceNodesInProjectBlueprints();
+	// Reports Nodes which would be replaced in project Blueprints, nothing is modified
+	static void ReportNodesInProjectBlueprints();
 };
@@ -229,6 +229,42 @@ bool FMounteaDialogueGraphEditorUtilities::OpenEditorAndJumpToGraphNode(TWeakPtr
 	return false;
 }
 
+bool FMounteaDialogueGraphEditorUtilities::OpenEditorAndJumpToNodeGUID(const FSoftObjectPath& DialoguePath, const FGuid& NodeGUID)
+{
+	UMounteaDialogueGraph* Dialogue = Cast<UMounteaDialogueGraph>(DialoguePath.TryLoad());
+	if (!OpenEditorForAsset(Dialogue))
+	{
+		return false;
+	}
+
+	// Dialogue Node itself might not be searched, just open the Dialogue
+	const UEdGraph_MounteaDialogueGraph* GraphEditor = Cast<UEdGraph_MounteaDialogueGraph>(Dialogue->EdGraph);
+	if (!GraphEditor || !NodeGUID.IsValid())
+	{
+		return true;
+	}
+
+	const UEdGraphNode* FoundGraphNode = nullptr;
+	for (const UEdGraphNode* Node : GraphEditor->Nodes)
+	{
+		const UEdNode_MounteaDialogueGraphNode* GraphNode = Cast<UEdNode_MounteaDialogueGraphNode>(Node);
+		if (GraphNode && GraphNode->DialogueGraphNode && GraphNode->DialogueGraphNode->GetNodeGUID() == NodeGUID)
+		{
+			FoundGraphNode = GraphNode;
+			break;
+		}
+	}
+
+	IAssetEditorInstance* EditorInstance = FindEditorForAsset(Dialogue, true);
+	if (!FoundGraphNode || !EditorInstance || EditorInstance->GetEditorName() != FName("FMounteaDialogueGraphEditor"))
+	{
+		return true;
+	}
+
+	const TSharedRef<FAssetEditor_MounteaDialogueGraph> DialogueEditor = StaticCastSharedRef<FAssetEditor_MounteaDialogueGraph>(static_cast<FAssetEditor_MounteaDialogueGraph*>(EditorInstance)->AsShared());
+	return OpenEditorAndJumpToGraphNode(DialogueEditor, FoundGraphNode);
+}
+
 UMounteaDialogueGraph* FMounteaDialogueGraphEditorUtilities::GetDialogueFromGraphNode(const UEdGraphNode* GraphNode)
 {
 	if (const UEdNode_MounteaDialogueGraphNode* DialogueBaseNode = Cast<UEdNode_MounteaDialogueGraphNode>(GraphNode))
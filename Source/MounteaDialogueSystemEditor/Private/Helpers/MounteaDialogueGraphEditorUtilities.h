@@ -100,6 +100,12 @@ public:
 
 	static bool OpenEditorAndJumpToGraphNode(TWeakPtr<FAssetEditor_MounteaDialogueGraph> DialogueEditorPtr, const UEdGraphNode* GraphNode, bool bFocusIfOpen = false);
 
+	/**
+	 * Loads Dialogue, opens its editor and jumps to Graph Node representing Dialogue Node with given GUID.
+	 * Used by results of indexed search, which are not backed by loaded Graph Nodes.
+	 */
+	static bool OpenEditorAndJumpToNodeGUID(const FSoftObjectPath& DialoguePath, const FGuid& NodeGUID);
+
 	static UMounteaDialogueGraph* GetDialogueFromGraphNode(const UEdGraphNode* GraphNode);
 
 	static IAssetEditorInstance* FindEditorForAsset(UObject* Asset, bool bFocusIfOpen);
@@ -22,11 +22,14 @@
 #include "Misc/DateTime.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 
 #include "zip.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Ed/EdGraph_MounteaDialogueGraph.h"
+#include "Ed/EdNode_MounteaDialogueGraphEdge.h"
+#include "Ed/EdNode_MounteaDialogueGraphNode.h"
 #include "Edges/MounteaDialogueGraphEdge.h"
 #include "Framework/Notifications/NotificationManager.h"
 
@@ -40,7 +43,13 @@
 #include "Nodes/MounteaDialogueGraphNode_StartNode.h"
 
 #include "ImportConfig/MounteaDialogueImportConfig.h"
+#include "Settings/MounteaDialogueGraphEditorSettings.h"
 
+#include "Async/ParallelFor.h"
+#include "Audio.h"
+#include "Factories/SoundFactory.h"
+#include "FileHelpers.h"
+#include "Misc/ScopedSlowTask.h"
 #include "UObject/SavePackage.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
@@ -110,6 +119,9 @@ bool UMounteaDialogueSystemImportExportHelpers::ReimportDialogueGraph(const FStr
 		return false;
 	}
 
+	FDialogueImportTimings importTimings;
+	double stepStartTime = FPlatformTime::Seconds();
+	
 	// TODO: with recursive calls FilePath is wrong so maybe do not call with different path?
 	TArray<uint8> fileData;
 	if (!FFileHelper::LoadFileToArray(fileData, *FilePath))
@@ -127,7 +139,8 @@ bool UMounteaDialogueSystemImportExportHelpers::ReimportDialogueGraph(const FStr
 	}
 
 	TMap<FString, FString> extractedFiles;
-	if (!ExtractFilesFromZip(fileData, extractedFiles))
+	TMap<FString, uint32> audioHashes;
+	if (!ExtractFilesFromZip(fileData, extractedFiles, &audioHashes))
 	{
 		OutMessage = FString::Printf( TEXT("Failed to extract files from archive: %s"), *FilePath);
 		EditorLOG_ERROR(TEXT("[ReimportDialogueGraph] %s"), *OutMessage);
@@ -216,17 +229,57 @@ bool UMounteaDialogueSystemImportExportHelpers::ReimportDialogueGraph(const FStr
 			return false;
 		}
 
+		importTimings.AddStep(TEXT("Extract package"), stepStartTime);
+
+		const UMounteaDialogueGraphEditorSettings* editorSettings = GetDefault<UMounteaDialogueGraphEditorSettings>();
+		if (editorSettings && editorSettings->AllowIncrementalReimport() && !OutGraph->ImportHashes.IsEmpty())
+		{
+			FDialogueReimportSummary reimportSummary;
+			if (ReimportDialogueGraphIncremental(OutGraph, extractedFiles, audioHashes, FilePath, reimportSummary, &importTimings))
+			{
+				stepStartTime = FPlatformTime::Seconds();
+				if (UEdGraph_MounteaDialogueGraph* edGraph = Cast<UEdGraph_MounteaDialogueGraph>(OutGraph->EdGraph))
+				{
+					edGraph->RebuildMounteaDialogueGraph();
+				}
+				importTimings.AddStep(TEXT("Rebuild Graph"), stepStartTime);
+
+				for (const auto& File : extractedFiles)
+				{
+					if (File.Key.StartsWith("audio/"))
+					{
+						IFileManager::Get().Delete(*File.Value);
+					}
+				}
+
+				EditorLOG_INFO(TEXT("[ReimportDialogueGraph] %s\n%s"), *reimportSummary.ToString(), *importTimings.ToString());
+
+				OutMessage = FString::Printf(TEXT("Graph `%s` has been refreshed.\n%s"), *OutGraph->GetName(), *reimportSummary.ToString());
+				return true;
+			}
+
+			EditorLOG_WARNING(TEXT("[ReimportDialogueGraph] Incremental reimport of `%s` failed, falling back to full reimport"), *OutGraph->GetName());
+		}
+		
 		OutGraph->ClearGraph();
 		
-		if (PopulateGraphFromExtractedFiles(OutGraph, extractedFiles, FilePath))
+		if (PopulateGraphFromExtractedFiles(OutGraph, extractedFiles, FilePath, &importTimings))
 		{
+			ComputeImportHashes(extractedFiles, audioHashes, OutGraph->ImportHashes);
+			
+			stepStartTime = FPlatformTime::Seconds();
 			ImportAudioFiles(extractedFiles, OutGraph, OutGraph);
+			importTimings.AddStep(TEXT("Audio"), stepStartTime);
 			
+			stepStartTime = FPlatformTime::Seconds();
 			if (OutGraph->EdGraph)
 			{
 				if (UEdGraph_MounteaDialogueGraph *edGraph = Cast<UEdGraph_MounteaDialogueGraph>(OutGraph->EdGraph))
 					edGraph->RebuildMounteaDialogueGraph();
 			}
+			importTimings.AddStep(TEXT("Rebuild Graph"), stepStartTime);
+
+			EditorLOG_INFO(TEXT("[ReimportDialogueGraph] %s"), *importTimings.ToString());
 		}
 
 		for (const auto &File : extractedFiles)
@@ -286,6 +339,9 @@ void UMounteaDialogueSystemImportExportHelpers::UpdateGraphImportDataConfig(cons
 
 bool UMounteaDialogueSystemImportExportHelpers::ImportDialogueGraph(const FString& FilePath, UObject* InParent, const FName Name, const EObjectFlags Flags, UMounteaDialogueGraph*& OutGraph, FString& OutMessage)
 {
+	FDialogueImportTimings importTimings;
+	double stepStartTime = FPlatformTime::Seconds();
+	
 	// 1. Load the file
 	TArray<uint8> fileData;
 	if (!FFileHelper::LoadFileToArray(fileData, *FilePath))
@@ -304,13 +360,16 @@ bool UMounteaDialogueSystemImportExportHelpers::ImportDialogueGraph(const FStrin
 
 	// 3. Extract and read content
 	TMap<FString, FString> extractedFiles;
-	if (!ExtractFilesFromZip(fileData, extractedFiles))
+	TMap<FString, uint32> audioHashes;
+	if (!ExtractFilesFromZip(fileData, extractedFiles, &audioHashes))
 	{
 		OutMessage = FString::Printf(TEXT("Failed to extract files from archive: %s"), *FilePath);
 		EditorLOG_ERROR(TEXT("[FactoryCreateFile] %s"), *OutMessage);
 		return false;
 	}
 
+	importTimings.AddStep(TEXT("Extract package"), stepStartTime);
+
 	// 3. Read the GUID from dialogueData.json
 	FGuid importedGuid;
 	FString dialogueName;
@@ -424,11 +483,17 @@ bool UMounteaDialogueSystemImportExportHelpers::ImportDialogueGraph(const FStrin
 	{
 		OutGraph->Rename(*assetName.ToString());
 
-		if (PopulateGraphFromExtractedFiles(OutGraph, extractedFiles, FilePath))
+		if (PopulateGraphFromExtractedFiles(OutGraph, extractedFiles, FilePath, &importTimings))
 		{
+			// Stored for incremental reimport
+			ComputeImportHashes(extractedFiles, audioHashes, OutGraph->ImportHashes);
+			
 			// 7. Import audio files if present
+			stepStartTime = FPlatformTime::Seconds();
 			ImportAudioFiles(extractedFiles, InParent, OutGraph);
+			importTimings.AddStep(TEXT("Audio"), stepStartTime);
 
+			stepStartTime = FPlatformTime::Seconds();
 			OutGraph->CreateGraph();
 			if (OutGraph->EdGraph)
 			{
@@ -437,8 +502,11 @@ bool UMounteaDialogueSystemImportExportHelpers::ImportDialogueGraph(const FStrin
 			}
 
 			SaveAsset(OutGraph);
+			importTimings.AddStep(TEXT("Rebuild and save Graph"), stepStartTime);
 
-			OutMessage = FString::Printf(TEXT("New Dialogue Graph created!"));
+			EditorLOG_INFO(TEXT("[ImportDialogueGraph] %s"), *importTimings.ToString());
+			
+			OutMessage = FString::Printf(TEXT("New Dialogue Graph created! (%.2f s)"), importTimings.GetTotalTime());
 			return true;
 		}
 		OutMessage = FString::Printf(TEXT("Failed to populate graph from extracted files: %s"), *FilePath);
@@ -470,10 +538,10 @@ bool UMounteaDialogueSystemImportExportHelpers::ExportDialogueGraph(const UMount
 		return false;
 	}
 
-	TMap<FString, FString> JsonFiles;
+	TArray<FDialogueJsonEntry> JsonEntries;
 	TArray<FString> AudioFiles;
 
-	if (!GatherAssetsFromGraph(Graph, JsonFiles, AudioFiles))
+	if (!GatherAssetsFromGraph(Graph, JsonEntries, AudioFiles))
 	{
 		EditorLOG_ERROR(TEXT("Failed to gather assets from Graph"));
 		return false;
@@ -485,7 +553,7 @@ bool UMounteaDialogueSystemImportExportHelpers::ExportDialogueGraph(const UMount
 
 	if (ExportAudioFiles(AudioFiles, ExportDirectory, ExportedAudioFiles))
 	{
-		bSuccess = PackToMNTEADLG(JsonFiles, ExportedAudioFiles, FilePath);
+		bSuccess = PackToMNTEADLG(JsonEntries, ExportedAudioFiles, FilePath);
 		
 		if (!bSuccess)
 		{
@@ -543,7 +611,7 @@ bool UMounteaDialogueSystemImportExportHelpers::IsZipFile(const TArray<uint8>& F
 	return false;
 }
 
-bool UMounteaDialogueSystemImportExportHelpers::ExtractFilesFromZip(const TArray<uint8>& ZipData, TMap<FString, FString>& OutExtractedFiles)
+bool UMounteaDialogueSystemImportExportHelpers::ExtractFilesFromZip(const TArray<uint8>& ZipData, TMap<FString, FString>& OutExtractedFiles, TMap<FString, uint32>* OutAudioHashes)
 {
 	FString tempFilePath = FPaths::CreateTempFilename(FPlatformProcess::UserTempDir(), TEXT("MounteaDialogue"), TEXT(".zip"));
 	if (!FFileHelper::SaveArrayToFile(ZipData, *tempFilePath))
@@ -579,6 +647,11 @@ bool UMounteaDialogueSystemImportExportHelpers::ExtractFilesFromZip(const TArray
 				
 				if (zip_entry_noallocread(zip, Buffer.GetData(), size) != -1)
 				{
+					if (OutAudioHashes)
+					{
+						OutAudioHashes->Add(FileName, FCrc::MemCrc32(Buffer.GetData(), Buffer.Num()));
+					}
+					
 					if (FFileHelper::SaveArrayToFile(Buffer, *TempAudioPath))
 					{
 						OutExtractedFiles.Add(FileName, TempAudioPath);
@@ -651,34 +724,49 @@ bool UMounteaDialogueSystemImportExportHelpers::ValidateExtractedContent(const T
 	return true;
 }
 
-bool UMounteaDialogueSystemImportExportHelpers::PopulateGraphFromExtractedFiles(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, const FString& SourceFilePath)
+bool UMounteaDialogueSystemImportExportHelpers::PopulateGraphFromExtractedFiles(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, const FString& SourceFilePath, FDialogueImportTimings* OutTimings)
 {
+	double stepStartTime = FPlatformTime::Seconds();
+	auto recordStep = [OutTimings, &stepStartTime](const TCHAR* StepName)
+	{
+		if (OutTimings)
+		{
+			OutTimings->AddStep(StepName, stepStartTime);
+		}
+		stepStartTime = FPlatformTime::Seconds();
+	};
+	
 	if (!PopulateDialogueData(Graph, SourceFilePath, ExtractedFiles))
 	{
 		return false;
 	}
+	recordStep(TEXT("Dialogue Data"));
 
 	if (!PopulateCategories(Graph, ExtractedFiles["categories.json"]))
 	{
 		return false;
 	}
+	recordStep(TEXT("Categories"));
 
 	if (!PopulateParticipants(Graph, ExtractedFiles["participants.json"]))
 	{
 		return false;
 	}
+	recordStep(TEXT("Participants"));
 
 	if (!PopulateNodes(Graph, ExtractedFiles["nodes.json"]))
 	{
 		return false;
 	}
+	recordStep(TEXT("Nodes"));
 
 	if (!PopulateEdges(Graph, ExtractedFiles["edges.json"]))
 	{
 		return false;
 	}
+	recordStep(TEXT("Edges"));
 
-	if (!PopulateDialogueRows(Graph, ExtractedFiles))
+	if (!PopulateDialogueRows(Graph, ExtractedFiles, OutTimings))
 	{
 		return false;
 	}
@@ -688,10 +776,6 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateGraphFromExtractedFiles(
 
 void UMounteaDialogueSystemImportExportHelpers::ImportAudioFiles(const TMap<FString, FString>& ExtractedFiles, UObject* InParent, UMounteaDialogueGraph* Graph)
 {
-	FModuleManager::LoadModuleChecked<IAudioEditorModule>("AudioEditor");
-	IAudioEditorModule& AudioEditorModule = FModuleManager::GetModuleChecked<IAudioEditorModule>("AudioEditor");
-
-	const FString Directory = FPaths::GetPath(InParent->GetPackage()->GetName());
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 
 	FString PackagePath = FPackageName::GetLongPackagePath(InParent->GetPathName());
@@ -725,79 +809,139 @@ void UMounteaDialogueSystemImportExportHelpers::ImportAudioFiles(const TMap<FStr
 		EditorLOG_ERROR(TEXT("[ImportAudioFiles] Failed to load Dialogue Rows DataTable: %s"), *FullAssetPath);
 	}
 
-	TMap<FGuid, USoundWave*> ImportedAudioMap;
-	
+	TArray<FAudioImportEntry> AudioEntries;
 	for (const auto& File : ExtractedFiles)
 	{
 		if (File.Key.StartsWith("audio/") && File.Key.EndsWith(".wav"))
 		{
-			FString TempAudioPath = File.Value;
-			
 			FString RelativePath = File.Key;
 			RelativePath.RemoveFromStart(TEXT("audio/"));
-			FString SubfolderPath = FPaths::GetPath(RelativePath);
-			
-			FGuid RowDataGuid = FGuid(FPaths::GetBaseFilename(SubfolderPath));
-
-			FString DestinationPath = FPaths::Combine(FPaths::GetPath(InParent->GetPathName()), TEXT("audio"), SubfolderPath);
+			const FString SubfolderPath = FPaths::GetPath(RelativePath);
 			
-			FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*DestinationPath);
-			
-			FString FullDestinationPath = FPaths::Combine(DestinationPath, FPaths::GetCleanFilename(File.Key));
-			
-			FString RelativePackagePath = FString::Printf(TEXT("/audio/%s"), *SubfolderPath);
-			FString FullPackagePath = PackagePath / RelativePackagePath / FPaths::GetBaseFilename(File.Key);
+			FAudioImportEntry& AudioEntry = AudioEntries.AddDefaulted_GetRef();
+			AudioEntry.TempAudioPath = File.Value;
+			AudioEntry.RowDataGuid = FGuid(FPaths::GetBaseFilename(SubfolderPath));
+			AudioEntry.AssetName = FPaths::GetBaseFilename(File.Key);
+			AudioEntry.PackageName = PackagePath / TEXT("audio") / SubfolderPath / AudioEntry.AssetName;
+		}
+	}
 
-			FARFilter Filter;
-			const FString FullAssetPathComposite = FString::Printf(TEXT("%s%s"), *PackagePath, *RelativePackagePath);
-			Filter.PackagePaths.Add(FName(*FullAssetPathComposite));
-			Filter.ClassPaths.Add(USoundWave::StaticClass()->GetClassPathName());
+	// Single Asset Registry query for the whole batch instead of one per file
+	TMap<FName, FAssetData> ExistingSoundWaves;
+	{
+		FARFilter Filter;
+		Filter.PackagePaths.Add(FName(*(PackagePath / TEXT("audio"))));
+		Filter.ClassPaths.Add(USoundWave::StaticClass()->GetClassPathName());
+		Filter.bRecursivePaths = true;
 
-			TArray<FAssetData> AssetDataList;
-			AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
+		TArray<FAssetData> AssetDataList;
+		AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
 
-			USoundWave* ExistingSoundWave = nullptr;
-			if (AssetDataList.Num() > 0)
+		ExistingSoundWaves.Reserve(AssetDataList.Num());
+		for (const FAssetData& AssetData : AssetDataList)
+		{
+			// Single Sound Wave per Row folder, first one found is reused
+			const FName RowFolder = FName(*FPaths::GetPath(AssetData.PackageName.ToString()));
+			if (!ExistingSoundWaves.Contains(RowFolder))
 			{
-				ExistingSoundWave = Cast<USoundWave>(AssetDataList[0].GetAsset());
+				ExistingSoundWaves.Add(RowFolder, AssetData);
 			}
+		}
+	}
 
-			UPackage* SoundWavePackage = nullptr;
-			USoundWave* ImportedSoundWave = nullptr;
+	USoundFactory* SoundWaveFactory = NewObject<USoundFactory>();
+	SoundWaveFactory->AddToRoot();
+	SoundWaveFactory->bAutoCreateCue = false;
+	SoundWaveFactory->SuppressImportDialogs();
+	
+	TMap<FGuid, USoundWave*> ImportedAudioMap;
+	TArray<UPackage*> PackagesToSave;
+
+	FScopedSlowTask SlowTask(AudioEntries.Num(), LOCTEXT("ImportAudioFiles", "Importing Dialogue audio files..."));
+	SlowTask.MakeDialog(true);
 
-			if (ExistingSoundWave)
+	for (int32 BatchStart = 0; BatchStart < AudioEntries.Num(); BatchStart += AudioBatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			EditorLOG_WARNING(TEXT("[ImportAudioFiles] Audio import cancelled, %d of %d files imported"), ImportedAudioMap.Num(), AudioEntries.Num());
+			break;
+		}
+		
+		const int32 BatchNum = FMath::Min(AudioBatchSize, AudioEntries.Num() - BatchStart);
+
+		// Reading WAV files and validating their headers does not touch any UObject, Sound Factory parses them again on Game Thread
+		ParallelFor(BatchNum, [&AudioEntries, BatchStart](const int32 Index)
+		{
+			FAudioImportEntry& AudioEntry = AudioEntries[BatchStart + Index];
+			if (FFileHelper::LoadFileToArray(AudioEntry.WAVData, *AudioEntry.TempAudioPath))
 			{
-				// Update existing asset
-				SoundWavePackage = ExistingSoundWave->GetOutermost();
-				SoundWavePackage->FullyLoad();
-				ImportedSoundWave = AudioEditorModule.ImportSoundWave(SoundWavePackage, ExistingSoundWave->GetName(), TempAudioPath);
+				FWaveModInfo WaveInfo;
+				AudioEntry.bIsValid = WaveInfo.ReadWaveInfo(AudioEntry.WAVData.GetData(), AudioEntry.WAVData.Num());
 			}
-			else
+		});
+
+		for (int32 Index = BatchStart; Index < BatchStart + BatchNum; Index++)
+		{
+			FAudioImportEntry& AudioEntry = AudioEntries[Index];
+			SlowTask.EnterProgressFrame(1, FText::FromString(AudioEntry.AssetName));
+
+			USoundWave* ImportedSoundWave = nullptr;
+			if (AudioEntry.bIsValid)
 			{
-				// Create new asset
-				SoundWavePackage = CreatePackage(*FullPackagePath);
-				SoundWavePackage->FullyLoad();
-				ImportedSoundWave = AudioEditorModule.ImportSoundWave(SoundWavePackage, FPaths::GetBaseFilename(File.Key), TempAudioPath);
+				UPackage* SoundWavePackage = nullptr;
+				FString SoundWaveName = AudioEntry.AssetName;
+				
+				const FAssetData* ExistingSoundWave = ExistingSoundWaves.Find(FName(*FPaths::GetPath(AudioEntry.PackageName)));
+				if (ExistingSoundWave && ExistingSoundWave->IsValid())
+				{
+					// Update existing asset
+					SoundWavePackage = ExistingSoundWave->GetPackage();
+					SoundWaveName = ExistingSoundWave->AssetName.ToString();
+				}
+				else
+				{
+					// Create new asset
+					SoundWavePackage = CreatePackage(*AudioEntry.PackageName);
+				}
+
+				if (SoundWavePackage)
+				{
+					SoundWavePackage->FullyLoad();
+					
+					const uint8* BufferStart = AudioEntry.WAVData.GetData();
+					const uint8* BufferEnd = BufferStart + AudioEntry.WAVData.Num();
+					ImportedSoundWave = Cast<USoundWave>(SoundWaveFactory->FactoryCreateBinary(USoundWave::StaticClass(), SoundWavePackage, FName(*SoundWaveName), RF_Public | RF_Standalone, nullptr, TEXT("wav"), BufferStart, BufferEnd, GWarn));
+				}
 			}
-			
-			SoundWavePackage->FullyLoad();
 
 			if (ImportedSoundWave)
 			{
 				FAssetRegistryModule::AssetCreated(ImportedSoundWave);
-				SaveAsset(ImportedSoundWave);
-				ImportedAudioMap.Add(RowDataGuid, ImportedSoundWave);
+				ImportedSoundWave->MarkPackageDirty();
+				PackagesToSave.Add(ImportedSoundWave->GetOutermost());
+				ImportedAudioMap.Add(AudioEntry.RowDataGuid, ImportedSoundWave);
 			}
 			else
 			{
-				EditorLOG_WARNING(TEXT("[ImportAudioFiles] Failed to import audio file: %s"), *TempAudioPath);
+				EditorLOG_WARNING(TEXT("[ImportAudioFiles] Failed to import audio file: %s"), *AudioEntry.TempAudioPath);
 			}
 
-			// Clean up the temporary file
-			IFileManager::Get().Delete(*TempAudioPath);
+			// Release memory of processed files right away, voice packs might be huge
+			AudioEntry.WAVData.Empty();
 		}
 	}
 
+	SoundWaveFactory->RemoveFromRoot();
+
+	// Clean up the temporary files, including those skipped by cancel
+	for (const FAudioImportEntry& AudioEntry : AudioEntries)
+	{
+		IFileManager::Get().Delete(*AudioEntry.TempAudioPath);
+	}
+
+	SaveAssets(PackagesToSave);
+
 	if (!DialogueRowsDataTable)
 	{
 		EditorLOG_WARNING(TEXT("[ImportAudioFiles] Failed to find Dialogue Rows table: %s"), *FullAssetPath);
@@ -1208,8 +1352,18 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateEdges(UMounteaDialogueGr
 	return true;
 }
 
-bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles)
+bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, FDialogueImportTimings* OutTimings)
 {
+	double stepStartTime = FPlatformTime::Seconds();
+	auto recordStep = [OutTimings, &stepStartTime](const TCHAR* StepName)
+	{
+		if (OutTimings)
+		{
+			OutTimings->AddStep(StepName, stepStartTime);
+		}
+		stepStartTime = FPlatformTime::Seconds();
+	};
+
 	if (!IsValid(Graph))
 	{
 		EditorLOG_ERROR(TEXT("[PopulateDialogueRows] Invalid Graph object provided to PopulateDialogueRows"));
@@ -1234,6 +1388,7 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDia
 		EditorLOG_ERROR(TEXT("[PopulateDialogueRows] Failed to parse nodes.json"));
 		return false;
 	}
+	recordStep(TEXT("Dialogue Rows: parse JSON"));
 
 	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
 	IAssetTools& AssetTools = AssetToolsModule.Get();
@@ -1279,6 +1434,7 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDia
 	});
 
 	UDataTable* DialogueRowsDataTable = CreateDataTable<FDialogueRow>(AssetTools, PackagePath, DialogueRowsDataTableName);
+	recordStep(TEXT("Dialogue Rows: String Tables"));
 
 	// Load ParticipantsDataTable
 	FString FullAssetPath = FString::Printf(TEXT("%s/%s"), *PackagePath, *ParticipantsAssetName);
@@ -1331,6 +1487,7 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDia
 	
 	// Group dialogue rows by nodeId
 	TMap<FString, TArray<TSharedPtr<FJsonObject>>> GroupedDialogueRows;
+	GroupedDialogueRows.Reserve(dialogueNodesJsonArray.Num());
 	for (const auto& Row : dialogueRowsJsonArray)
 	{
 		const TSharedPtr<FJsonObject>& RowObject = Row->AsObject();
@@ -1340,6 +1497,23 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDia
 			GroupedDialogueRows.FindOrAdd(NodeId).Add(RowObject);
 		}
 	}
+
+	// Built once, so rows don't scan all Nodes
+	TMap<FGuid, UMounteaDialogueGraphNode_DialogueNodeBase*> DialogueNodesMap;
+	DialogueNodesMap.Reserve(Graph->GetAllNodes().Num());
+	for (const auto& Node : Graph->GetAllNodes())
+	{
+		if (UMounteaDialogueGraphNode_DialogueNodeBase* DialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node))
+		{
+			DialogueNodesMap.Add(DialogueNode->GetNodeGUID(), DialogueNode);
+		}
+	}
+
+	// Many Nodes share the same Participant
+	TMap<FString, const FDialogueParticipant*> ParticipantsMap;
+	
+	int32 DialogueRowsCount = 0;
+	recordStep(TEXT("Dialogue Rows: build lookup maps"));
 	
 	// Populate the DialogueRowsDataTable
 	for (const auto& GroupedRow : GroupedDialogueRows)
@@ -1356,7 +1530,6 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDia
 		
 		FDialogueRow NewRow;
 		const FGuid newRowGuid = FGuid(GroupedRow.Key);
-		NewRow.RowGUID = newRowGuid;
 
 		// Set DialogueParticipant using the NodeParticipantMap
 		const FString* ParticipantName = NodeParticipantMap.Find(NodeId);
@@ -1367,7 +1540,17 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDia
 			continue;
 		}
 		
-		FDialogueParticipant* Participant = ParticipantsDataTable->FindRow<FDialogueParticipant>(FName(**ParticipantName), TEXT(""));
+		const FDialogueParticipant* Participant = nullptr;
+		if (const FDialogueParticipant** CachedParticipant = ParticipantsMap.Find(*ParticipantName))
+		{
+			Participant = *CachedParticipant;
+		}
+		else
+		{
+			Participant = ParticipantsDataTable->FindRow<FDialogueParticipant>(FName(**ParticipantName), TEXT(""));
+			ParticipantsMap.Add(*ParticipantName, Participant);
+		}
+		
 		if (!Participant)
 		{
 			EditorLOG_WARNING(TEXT("[PopulateDialogueRows] Participant not found for NodeId: %s"), *NodeId);
@@ -1375,210 +1558,906 @@ bool UMounteaDialogueSystemImportExportHelpers::PopulateDialogueRows(UMounteaDia
 			continue;
 		}
 		
-		NewRow.DialogueParticipant = FText::FromString(Participant->ParticipantName.ToString());
-		NewRow.CompatibleTags.AddTag(Participant->ParticipantCategoryTag);
-		NewRow.RowTitle = FText::FromStringTable(NodesStringTable->GetStringTableId(), NodeId);
+		BuildDialogueRow(NodeId, Rows, *Participant, NodesStringTable, DialogueRowsStringTable, NewRow);
 
-		// Add FDialogueRowData for each row in the group
-		for (const auto& RowObject : Rows)
-		{
-			FString Id = RowObject->GetStringField(TEXT("id"));
-			FDialogueRowData RowData;
-			RowData.RowText = FText::FromStringTable(DialogueRowsStringTable->GetStringTableId(), Id);
-			RowData.RowGUID = FGuid(Id);
-			RowData.RowDuration = RowObject->GetNumberField(TEXT("duration"));;
-			NewRow.DialogueRowData.Add(RowData);
-		}		
-
-		TArray<FDialogueRow*> dialogueRows;
-		FString outString;
-		DialogueRowsDataTable->GetAllRows(outString, dialogueRows);
-		
-		TArray<FName> rowNames = DialogueRowsDataTable->GetRowNames();
+		// Table has been emptied, so its size is the number of rows added so far
 		FString newRowName = NewRow.DialogueParticipant.ToString();
-		newRowName.Append(TEXT("_")).Append(FString::FromInt(dialogueRows.Num()));
+		newRowName.Append(TEXT("_")).Append(FString::FromInt(DialogueRowsCount++));
 		DialogueRowsDataTable->AddRow(FName(*newRowName), NewRow);
 
 		// Update nodes
-		if (Graph && Graph->GetAllNodes().Num() > 0)
+		if (UMounteaDialogueGraphNode_DialogueNodeBase** DialogueNode = DialogueNodesMap.Find(newRowGuid))
 		{
-			for (const auto& Node : Graph->GetAllNodes())
-			{
-				if (!Node || Node->GetNodeGUID() != newRowGuid) continue;
-        
-				if (UMounteaDialogueGraphNode_DialogueNodeBase* DialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node))
-				{
-					DialogueNode->SetDataTable(DialogueRowsDataTable);
-					DialogueNode->SetRowName(FName(*newRowName));
-				}
-			}
+			(*DialogueNode)->SetDataTable(DialogueRowsDataTable);
+			(*DialogueNode)->SetRowName(FName(*newRowName));
 		}
 	}
+	recordStep(TEXT("Dialogue Rows: populate rows"));
 
 	// Save all created assets
 	SaveAsset(DialogueRowsStringTable);
 	SaveAsset(NodesStringTable);
 	SaveAsset(DialogueRowsDataTable);
+	recordStep(TEXT("Dialogue Rows: save assets"));
+
+	EditorLOG_INFO(TEXT("[PopulateDialogueRows] Populated %d Dialogue Rows from %d Dialogue Row Data entries"), DialogueRowsCount, dialogueRowsJsonArray.Num());
 
 	return true;
 }
 
-UStringTable* UMounteaDialogueSystemImportExportHelpers::CreateStringTable(IAssetTools& AssetTools, const FString& PackagePath, const FString& AssetName, TFunction<void(UStringTable*)> PopulateFunction)
+void UMounteaDialogueSystemImportExportHelpers::BuildDialogueRow(const FString& NodeId, const TArray<TSharedPtr<FJsonObject>>& Rows, const FDialogueParticipant& Participant, const UStringTable* NodesStringTable, const UStringTable* DialogueRowsStringTable, FDialogueRow& OutRow)
 {
-	UStringTable* StringTable = nullptr;
-	
-	FSoftObjectPath StringTableAssetPath = PackagePath + TEXT("/") + AssetName + TEXT(".") + AssetName;
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	FAssetData StringTableAssetData = AssetRegistryModule.Get().GetAssetByObjectPath(StringTableAssetPath);
-	if (StringTableAssetData.IsValid())
-	{
-		StringTable = Cast<UStringTable>(StringTableAssetData.GetAsset());
-	}
-	else
-	{
-		StringTable = Cast<UStringTable>(AssetTools.CreateAsset(AssetName, PackagePath, UStringTable::StaticClass(), nullptr));
-	}
-	
-	if (StringTable)
-	{
-		PopulateFunction(StringTable);
+	OutRow.RowGUID = FGuid(NodeId);
+	OutRow.DialogueParticipant = FText::FromString(Participant.ParticipantName.ToString());
+	OutRow.CompatibleTags.AddTag(Participant.ParticipantCategoryTag);
+	OutRow.RowTitle = FText::FromStringTable(NodesStringTable->GetStringTableId(), NodeId);
+
+	// Add FDialogueRowData for each row in the group
+	OutRow.DialogueRowData.Reserve(Rows.Num());
+	for (const auto& RowObject : Rows)
+	{
+		FString Id = RowObject->GetStringField(TEXT("id"));
+		FDialogueRowData RowData;
+		RowData.RowText = FText::FromStringTable(DialogueRowsStringTable->GetStringTableId(), Id);
+		RowData.RowGUID = FGuid(Id);
+		RowData.RowDuration = RowObject->GetNumberField(TEXT("duration"));
+		OutRow.DialogueRowData.Add(RowData);
 	}
-	return StringTable;
 }
 
-template <typename RowType>
-UDataTable* UMounteaDialogueSystemImportExportHelpers::CreateDataTable(IAssetTools& AssetTools, const FString& PackagePath, const FString& AssetName)
+bool UMounteaDialogueSystemImportExportHelpers::ComputeImportHashes(const TMap<FString, FString>& ExtractedFiles, const TMap<FString, uint32>& AudioHashes, FDialogueImportHashes& OutHashes)
 {
-	UDataTable* DataTable = nullptr;
+	OutHashes = FDialogueImportHashes();
+	OutHashes.CategoriesHash = FCrc::StrCrc32(*ExtractedFiles.FindRef(TEXT("categories.json")));
+	OutHashes.ParticipantsHash = FCrc::StrCrc32(*ExtractedFiles.FindRef(TEXT("participants.json")));
+	OutHashes.EdgesHash = FCrc::StrCrc32(*ExtractedFiles.FindRef(TEXT("edges.json")));
 
-	FSoftObjectPath DataTableAssetPath = PackagePath + TEXT("/") + AssetName + TEXT(".") + AssetName;
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	FAssetData DataTableAssetData = AssetRegistryModule.Get().GetAssetByObjectPath(DataTableAssetPath);
-	if (DataTableAssetData.IsValid())
-	{
-		DataTable = Cast<UDataTable>(DataTableAssetData.GetAsset());
-	}
-	else
+	TArray<TSharedPtr<FJsonValue>> dialogueNodesJsonArray;
+	TSharedRef<TJsonReader<>> dialogueNodesJsonReader = TJsonReaderFactory<>::Create(ExtractedFiles.FindRef(TEXT("nodes.json")));
+	if (!FJsonSerializer::Deserialize(dialogueNodesJsonReader, dialogueNodesJsonArray))
 	{
-		DataTable = Cast<UDataTable>(
-		AssetTools.CreateAsset(AssetName, PackagePath, UDataTable::StaticClass(), nullptr));
+		EditorLOG_ERROR(TEXT("[ComputeImportHashes] Failed to parse nodes.json"));
+		return false;
 	}
-	
-	if (DataTable)
+
+	TArray<TSharedPtr<FJsonValue>> dialogueRowsJsonArray;
+	TSharedRef<TJsonReader<>> dialogueRowsJsonReader = TJsonReaderFactory<>::Create(ExtractedFiles.FindRef(TEXT("dialogueRows.json")));
+	if (!FJsonSerializer::Deserialize(dialogueRowsJsonReader, dialogueRowsJsonArray))
 	{
-		DataTable->RowStruct = RowType::StaticStruct();
+		EditorLOG_ERROR(TEXT("[ComputeImportHashes] Failed to parse dialogueRows.json"));
+		return false;
 	}
-	
-	return DataTable;
-}
-
-void UMounteaDialogueSystemImportExportHelpers::SaveAsset(UObject* Asset)
-{
-	if (!Asset)
-		return;
 
-	Asset->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Asset);
-	const FString PackageName = Asset->GetOutermost()->GetName();
-	const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs saveArgs;
+	TMap<FGuid, FString> nodeParticipants;
+	for (const auto& Node : dialogueNodesJsonArray)
 	{
-		saveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		const TSharedPtr<FJsonObject> NodeObject = Node->AsObject();
+		if (!NodeObject.IsValid()) continue;
+
+		const FGuid nodeGuid = FGuid(NodeObject->GetStringField(TEXT("id")));
+		
+		// Position is Editor layout only, moving Node does not change it
+		const TSharedRef<FJsonObject> hashedNodeObject = MakeShared<FJsonObject>(*NodeObject);
+		hashedNodeObject->RemoveField(TEXT("position"));
+		
+		OutHashes.NodeHashes.Add(nodeGuid, FCrc::StrCrc32(*ToCondensedJson(hashedNodeObject)));
+		nodeParticipants.Add(nodeGuid, GetNodeParticipantName(NodeObject));
 	}
-	UPackage::SavePackage(Asset->GetOutermost(), Asset, *PackageFileName, saveArgs);
-}
 
-bool UMounteaDialogueSystemImportExportHelpers::GatherAssetsFromGraph(const UMounteaDialogueGraph* Graph, TMap<FString, FString>& OutJsonFiles, TArray<FString>& OutAudioFiles)
-{
-	if (!Graph)
+	// Participant is part of Dialogue Row, so its change updates Row as well
+	for (const auto& Row : dialogueRowsJsonArray)
 	{
-		EditorLOG_ERROR(TEXT("[GatherAssetsFromGraph] Invalid Dialogue Graph!"));
-		return false;
-	}
+		const TSharedPtr<FJsonObject> RowObject = Row->AsObject();
+		if (!RowObject.IsValid()) continue;
 
-	TArray<FDialogueNodeData> AllNodeData;
-	GatherNodesFromGraph(Graph, AllNodeData);
+		const FGuid nodeGuid = FGuid(RowObject->GetStringField(TEXT("nodeId")));
+		uint32* rowHash = OutHashes.RowHashes.Find(nodeGuid);
+		if (!rowHash)
+		{
+			rowHash = &OutHashes.RowHashes.Add(nodeGuid, FCrc::StrCrc32(*nodeParticipants.FindRef(nodeGuid)));
+		}
+		*rowHash = HashCombine(*rowHash, FCrc::StrCrc32(*ToCondensedJson(RowObject.ToSharedRef())));
+	}
 
-	// Process nodes and create JSON
-	OutJsonFiles.Add(TEXT("nodes.json"), CreateNodesJson(AllNodeData));
-	OutJsonFiles.Add(TEXT("edges.json"), CreateEdgesJson(Graph));
-	OutJsonFiles.Add(TEXT("categories.json"), CreateCategoriesJson(Graph));
-	OutJsonFiles.Add(TEXT("dialogueData.json"), CreateDialogueDataJson(Graph));
-	OutJsonFiles.Add(TEXT("participants.json"), CreateParticipantsJson(Graph));
-	OutJsonFiles.Add(TEXT("dialogueRows.json"), CreateDialogueRowsJson(AllNodeData, Graph));
+	for (const auto& AudioHash : AudioHashes)
+	{
+		FString RelativePath = AudioHash.Key;
+		RelativePath.RemoveFromStart(TEXT("audio/"));
 
-	// Gather audio files
-	GatherAudioFiles(Graph, OutAudioFiles);
+		const FGuid rowDataGuid = FGuid(FPaths::GetBaseFilename(FPaths::GetPath(RelativePath)));
+		if (rowDataGuid.IsValid())
+		{
+			OutHashes.AudioHashes.Add(rowDataGuid, AudioHash.Value);
+		}
+	}
 
 	return true;
 }
 
-void UMounteaDialogueSystemImportExportHelpers::GatherNodesFromGraph(const UMounteaDialogueGraph* Graph, TArray<FDialogueNodeData>& OutNodeData)
+bool UMounteaDialogueSystemImportExportHelpers::ReimportDialogueGraphIncremental(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, const TMap<FString, uint32>& AudioHashes, const FString& SourceFilePath, FDialogueReimportSummary& OutSummary, FDialogueImportTimings* OutTimings)
 {
-	for (UMounteaDialogueGraphNode* Node : Graph->GetAllNodes())
+	double stepStartTime = FPlatformTime::Seconds();
+	auto recordStep = [OutTimings, &stepStartTime](const TCHAR* StepName)
 	{
-		if (!Node) continue;
+		if (OutTimings)
+		{
+			OutTimings->AddStep(StepName, stepStartTime);
+		}
+		stepStartTime = FPlatformTime::Seconds();
+	};
+	
+	if (!IsValid(Graph) || Graph->ImportHashes.IsEmpty())
+	{
+		return false;
+	}
 
-		if (Cast<UMounteaDialogueGraphNode_StartNode>(Node))
-			OutNodeData.Add(FDialogueNodeData(TEXT("startNode"), Node));
-		else if (Cast<UMounteaDialogueGraphNode_LeadNode>(Node))
-			OutNodeData.Add(FDialogueNodeData(TEXT("leadNode"), Node));
-		else if (Cast<UMounteaDialogueGraphNode_AnswerNode>(Node))
-			OutNodeData.Add(FDialogueNodeData(TEXT("answerNode"), Node));
-		else if (Cast<UMounteaDialogueGraphNode_CompleteNode>(Node))
-			OutNodeData.Add(FDialogueNodeData(TEXT("closeDialogueNode"), Node));
-		else if (Cast<UMounteaDialogueGraphNode_ReturnToNode>(Node))
-			OutNodeData.Add(FDialogueNodeData(TEXT("jumpToNode"), Node));
-		else
-			EditorLOG_WARNING(TEXT("[GatherNodesFromGraph] Unknown node type: %s"), *Node->GetClass()->GetName());
+	// Everything is parsed and loaded before Graph is modified, so failure can still fall back to full reimport
+	FDialogueImportHashes newHashes;
+	if (!ComputeImportHashes(ExtractedFiles, AudioHashes, newHashes))
+	{
+		return false;
 	}
-}
+	const FDialogueImportHashes oldHashes = Graph->ImportHashes;
 
-bool UMounteaDialogueSystemImportExportHelpers::GatherAudioFiles(const UMounteaDialogueGraph* Graph, TArray<FString>& OutAudioFiles)
-{
-	if (!Graph)
+	TArray<TSharedPtr<FJsonValue>> dialogueNodesJsonArray;
+	TSharedRef<TJsonReader<>> dialogueNodesJsonReader = TJsonReaderFactory<>::Create(ExtractedFiles.FindRef(TEXT("nodes.json")));
+	TArray<TSharedPtr<FJsonValue>> dialogueRowsJsonArray;
+	TSharedRef<TJsonReader<>> dialogueRowsJsonReader = TJsonReaderFactory<>::Create(ExtractedFiles.FindRef(TEXT("dialogueRows.json")));
+	if (!FJsonSerializer::Deserialize(dialogueNodesJsonReader, dialogueNodesJsonArray) || !FJsonSerializer::Deserialize(dialogueRowsJsonReader, dialogueRowsJsonArray))
 	{
-		EditorLOG_ERROR(TEXT("[GatherAudioFiles] Invalid Graph provided"));
+		EditorLOG_ERROR(TEXT("[ReimportDialogueGraphIncremental] Failed to parse nodes.json or dialogueRows.json"));
 		return false;
 	}
 
-	for (const UMounteaDialogueGraphNode* Node : Graph->GetAllNodes())
+	TArray<TPair<FGuid, TSharedPtr<FJsonObject>>> dialogueNodesJson;
+	TMap<FGuid, TSharedPtr<FJsonObject>> dialogueNodesJsonMap;
+	for (const auto& Node : dialogueNodesJsonArray)
 	{
-		const UMounteaDialogueGraphNode_DialogueNodeBase* DialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node);
-		if (!DialogueNode)
-		{
-			continue;
-		}
+		const TSharedPtr<FJsonObject> NodeObject = Node->AsObject();
+		if (!NodeObject.IsValid()) continue;
 
-		if (!DialogueNode->GetDataTable())
-		{
-			continue;
-		}
+		const FGuid nodeGuid = FGuid(NodeObject->GetStringField(TEXT("id")));
+		dialogueNodesJson.Emplace(nodeGuid, NodeObject);
+		dialogueNodesJsonMap.Add(nodeGuid, NodeObject);
+	}
 
-		const FDialogueRow* DialogueRow = DialogueNode->GetDataTable()->FindRow<FDialogueRow>(DialogueNode->GetRowName(), TEXT(""));
-		if (!DialogueRow)
+	// Node whose type has changed must be constructed again, which only full reimport does
+	for (const UMounteaDialogueGraphNode* existingNode : Graph->AllNodes)
+	{
+		const TSharedPtr<FJsonObject> nodeObject = existingNode ? dialogueNodesJsonMap.FindRef(existingNode->GetNodeGUID()) : nullptr;
+		const TSubclassOf<UMounteaDialogueGraphNode> nodeClass = nodeObject.IsValid() ? GetImportedNodeClass(nodeObject->GetStringField(TEXT("type"))) : nullptr;
+		if (nodeClass && !existingNode->IsA(nodeClass))
 		{
-			continue;
+			EditorLOG_INFO(TEXT("[ReimportDialogueGraphIncremental] Node `%s` changed its type to `%s`, falling back to full reimport"), *existingNode->GetNodeGUID().ToString(), *nodeClass->GetName());
+			return false;
 		}
+	}
 
-		for (const FDialogueRowData& RowData : DialogueRow->DialogueRowData)
+	TMap<FGuid, TArray<TSharedPtr<FJsonObject>>> groupedDialogueRows;
+	for (const auto& Row : dialogueRowsJsonArray)
+	{
+		const TSharedPtr<FJsonObject> RowObject = Row->AsObject();
+		if (RowObject.IsValid())
 		{
-			if (RowData.RowSound)
-			{
-				FString AudioPath = RowData.RowSound->GetOuter()->GetName();
-				OutAudioFiles.AddUnique(AudioPath);
-			}
+			groupedDialogueRows.FindOrAdd(FGuid(RowObject->GetStringField(TEXT("nodeId")))).Add(RowObject);
 		}
 	}
 
-	return true;
-}
-
-FString UMounteaDialogueSystemImportExportHelpers::CreateNodesJson(const TArray<FDialogueNodeData>& NodeData)
-{
-	TArray<TSharedPtr<FJsonValue>> NodesArray;
-
-	for (const FDialogueNodeData& Data : NodeData)
+	const FString PackagePath = FPackageName::GetLongPackagePath(Graph->GetPathName());
+	auto loadImportedAsset = [&PackagePath](const FString& AssetName)
+	{
+		return FSoftObjectPath(FString::Printf(TEXT("%s/%s"), *PackagePath, *AssetName)).TryLoad();
+	};
+	
+	UDataTable* DialogueRowsDataTable = Cast<UDataTable>(loadImportedAsset(FString::Printf(TEXT("DT_%s_DialogueRows"), *Graph->GetName())));
+	UDataTable* ParticipantsDataTable = Cast<UDataTable>(loadImportedAsset(FString::Printf(TEXT("DT_%s_Participants"), *Graph->GetName())));
+	UStringTable* DialogueRowsStringTable = Cast<UStringTable>(loadImportedAsset(FString::Printf(TEXT("ST_%s_DialogueRows"), *Graph->GetName())));
+	UStringTable* NodesStringTable = Cast<UStringTable>(loadImportedAsset(FString::Printf(TEXT("ST_%s_Nodes"), *Graph->GetName())));
+	
+	if (!DialogueRowsDataTable || !ParticipantsDataTable || !DialogueRowsStringTable || !NodesStringTable)
+	{
+		EditorLOG_WARNING(TEXT("[ReimportDialogueGraphIncremental] Imported tables of Graph `%s` not found"), *Graph->GetName());
+		return false;
+	}
+	recordStep(TEXT("Diff: parse source"));
+
+	if (!PopulateDialogueData(Graph, SourceFilePath, ExtractedFiles))
+	{
+		return false;
+	}
+
+	if (newHashes.CategoriesHash != oldHashes.CategoriesHash && !PopulateCategories(Graph, ExtractedFiles["categories.json"]))
+	{
+		return false;
+	}
+
+	if (newHashes.ParticipantsHash != oldHashes.ParticipantsHash && !PopulateParticipants(Graph, ExtractedFiles["participants.json"]))
+	{
+		return false;
+	}
+	recordStep(TEXT("Dialogue Data"));
+
+	// Nodes
+	Graph->Modify();
+	UEdGraph_MounteaDialogueGraph* EdGraph = Cast<UEdGraph_MounteaDialogueGraph>(Graph->EdGraph);
+	
+	TMap<UMounteaDialogueGraphNode*, UEdNode_MounteaDialogueGraphNode*> EdNodesMap;
+	if (EdGraph)
+	{
+		for (UEdGraphNode* EdGraphNode : EdGraph->Nodes)
+		{
+			UEdNode_MounteaDialogueGraphNode* EdNode = Cast<UEdNode_MounteaDialogueGraphNode>(EdGraphNode);
+			if (EdNode && EdNode->DialogueGraphNode)
+			{
+				EdNodesMap.Add(EdNode->DialogueGraphNode, EdNode);
+			}
+		}
+	}
+
+	TMap<FGuid, UMounteaDialogueGraphNode*> ExistingNodes;
+	for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
+	{
+		if (Node)
+		{
+			ExistingNodes.Add(Node->GetNodeGUID(), Node);
+		}
+	}
+
+	TArray<UMounteaDialogueGraphNode*> RemovedNodes;
+	for (const auto& ExistingNode : ExistingNodes)
+	{
+		if (!dialogueNodesJsonMap.Contains(ExistingNode.Key) && !ExistingNode.Value->IsA<UMounteaDialogueGraphNode_StartNode>())
+		{
+			RemovedNodes.Add(ExistingNode.Value);
+		}
+	}
+
+	TArray<UMounteaDialogueGraphNode*> InsertedNodes;
+	TSet<UMounteaDialogueGraphNode*> ChangedNodes;
+	for (const auto& NodeJson : dialogueNodesJson)
+	{
+		if (UMounteaDialogueGraphNode* ExistingNode = ExistingNodes.FindRef(NodeJson.Key))
+		{
+			const uint32* oldNodeHash = oldHashes.NodeHashes.Find(NodeJson.Key);
+			if (oldNodeHash && *oldNodeHash == newHashes.NodeHashes.FindRef(NodeJson.Key))
+			{
+				OutSummary.NodesUnchanged++;
+				continue;
+			}
+			
+			ChangedNodes.Add(ExistingNode);
+			OutSummary.NodesUpdated++;
+			continue;
+		}
+
+		const TSubclassOf<UMounteaDialogueGraphNode> NodeClass = GetImportedNodeClass(NodeJson.Value->GetStringField(TEXT("type")));
+
+		UMounteaDialogueGraphNode* NewNode = NodeClass ? Graph->ConstructDialogueNode(NodeClass) : nullptr;
+		if (!NewNode) continue;
+
+		// GUID is needed right away, Jump Nodes might target this Node
+		NewNode->SetNodeGUID(NodeJson.Key);
+		Graph->AllNodes.Add(NewNode);
+		InsertedNodes.Add(NewNode);
+		ChangedNodes.Add(NewNode);
+		OutSummary.NodesAdded++;
+	}
+
+	TArray<FName> RemovedRowNames;
+	for (UMounteaDialogueGraphNode* RemovedNode : RemovedNodes)
+	{
+		if (const UMounteaDialogueGraphNode_DialogueNodeBase* DialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(RemovedNode))
+		{
+			RemovedRowNames.Add(DialogueNode->GetRowName());
+		}
+		
+		for (UMounteaDialogueGraphNode* ParentNode : RemovedNode->ParentNodes)
+		{
+			if (ParentNode)
+			{
+				ParentNode->ChildrenNodes.Remove(RemovedNode);
+				ParentNode->Edges.Remove(RemovedNode);
+			}
+		}
+		for (UMounteaDialogueGraphNode* ChildNode : RemovedNode->ChildrenNodes)
+		{
+			if (ChildNode)
+			{
+				ChildNode->ParentNodes.Remove(RemovedNode);
+			}
+		}
+		RemovedNode->ParentNodes.Reset();
+		RemovedNode->ChildrenNodes.Reset();
+		RemovedNode->Edges.Reset();
+
+		Graph->AllNodes.Remove(RemovedNode);
+		Graph->RootNodes.Remove(RemovedNode);
+
+		NodesStringTable->GetMutableStringTable()->RemoveSourceString(RemovedNode->GetNodeGUID().ToString(EGuidFormats::DigitsWithHyphensLower));
+
+		if (UEdNode_MounteaDialogueGraphNode* RemovedEdNode = EdNodesMap.FindRef(RemovedNode))
+		{
+			RemovedEdNode->BreakAllNodeLinks();
+			EdGraph->RemoveNode(RemovedEdNode);
+			EdNodesMap.Remove(RemovedNode);
+		}
+
+		OutSummary.NodesRemoved++;
+	}
+
+	const bool bNodesInsertedOrRemoved = InsertedNodes.Num() > 0 || RemovedNodes.Num() > 0;
+	for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
+	{
+		// Jump Nodes store index of their target, which moves once Nodes are inserted or removed
+		const bool bRefreshJumpNode = bNodesInsertedOrRemoved && Node->IsA<UMounteaDialogueGraphNode_ReturnToNode>();
+		if (!ChangedNodes.Contains(Node) && !bRefreshJumpNode) continue;
+
+		const TSharedPtr<FJsonObject> NodeObject = dialogueNodesJsonMap.FindRef(Node->GetNodeGUID());
+		PopulateNodeData(Node, NodeObject);
+
+		if (const TSharedPtr<FJsonObject> AdditionalInfoObject = GetNodeAdditionalInfo(NodeObject))
+		{
+			NodesStringTable->GetMutableStringTable()->SetSourceString(NodeObject->GetStringField(TEXT("id")), AdditionalInfoObject->GetStringField(TEXT("displayName")));
+		}
+	}
+
+	if (EdGraph)
+	{
+		for (UMounteaDialogueGraphNode* InsertedNode : InsertedNodes)
+		{
+			UEdNode_MounteaDialogueGraphNode* NewEdNode = EdGraph->CreateIntermediateNode<UEdNode_MounteaDialogueGraphNode>();
+			NewEdNode->SetMounteaDialogueGraphNode(InsertedNode);
+			NewEdNode->NodeGuid = InsertedNode->GetNodeGUID();
+			NewEdNode->PostPlacedNewNode();
+			NewEdNode->AllocateDefaultPins();
+
+			const TSharedPtr<FJsonObject> NodeObject = dialogueNodesJsonMap.FindRef(InsertedNode->GetNodeGUID());
+			const TSharedPtr<FJsonObject>* PositionObject = nullptr;
+			if (NodeObject.IsValid() && NodeObject->TryGetObjectField(TEXT("position"), PositionObject))
+			{
+				NewEdNode->NodePosX = (*PositionObject)->GetNumberField(TEXT("x"));
+				NewEdNode->NodePosY = (*PositionObject)->GetNumberField(TEXT("y"));
+			}
+
+			NewEdNode->DialogueGraphNode->SetFlags(RF_Transactional);
+			NewEdNode->SetFlags(RF_Transactional);
+
+			EdNodesMap.Add(InsertedNode, NewEdNode);
+		}
+	}
+	recordStep(TEXT("Diff: Nodes"));
+
+	// Edges
+	OutSummary.bEdgesChanged = newHashes.EdgesHash != oldHashes.EdgesHash;
+	if (OutSummary.bEdgesChanged || bNodesInsertedOrRemoved)
+	{
+		for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
+		{
+			Node->ParentNodes.Reset();
+			Node->ChildrenNodes.Reset();
+			Node->Edges.Reset();
+		}
+
+		if (!PopulateEdges(Graph, ExtractedFiles["edges.json"]))
+		{
+			return false;
+		}
+
+		Graph->RootNodes.Reset();
+		for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
+		{
+			if (Node->ParentNodes.Num() == 0)
+			{
+				Graph->RootNodes.Add(Node);
+			}
+		}
+
+		// Editor Graph is the source of Graph rebuild, so its pins must match new Edges
+		if (EdGraph)
+		{
+			TArray<UEdNode_MounteaDialogueGraphEdge*> EdgeNodes;
+			for (UEdGraphNode* EdGraphNode : EdGraph->Nodes)
+			{
+				if (UEdNode_MounteaDialogueGraphEdge* EdgeNode = Cast<UEdNode_MounteaDialogueGraphEdge>(EdGraphNode))
+				{
+					EdgeNodes.Add(EdgeNode);
+				}
+			}
+			for (UEdNode_MounteaDialogueGraphEdge* EdgeNode : EdgeNodes)
+			{
+				EdgeNode->BreakAllNodeLinks();
+				EdGraph->RemoveNode(EdgeNode);
+			}
+
+			for (const auto& EdNode : EdNodesMap)
+			{
+				EdNode.Value->BreakAllNodeLinks();
+			}
+
+			for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
+			{
+				UEdNode_MounteaDialogueGraphNode* ChildEdNode = EdNodesMap.FindRef(Node);
+				if (!ChildEdNode || !ChildEdNode->GetInputPin()) continue;
+
+				for (UMounteaDialogueGraphNode* ParentNode : Node->ParentNodes)
+				{
+					const UEdNode_MounteaDialogueGraphNode* ParentEdNode = EdNodesMap.FindRef(ParentNode);
+					if (ParentEdNode && ParentEdNode->GetOutputPin())
+					{
+						ParentEdNode->GetOutputPin()->MakeLinkTo(ChildEdNode->GetInputPin());
+					}
+				}
+			}
+		}
+	}
+	recordStep(TEXT("Diff: Edges"));
+
+	// Dialogue Rows
+	bool bDialogueRowsChanged = false;
+	auto removeRowTexts = [DialogueRowsStringTable](const FDialogueRow& Row, const TSet<FGuid>& KeptRowData)
+	{
+		for (const FDialogueRowData& RowData : Row.DialogueRowData)
+		{
+			if (!KeptRowData.Contains(RowData.RowGUID))
+			{
+				DialogueRowsStringTable->GetMutableStringTable()->RemoveSourceString(RowData.RowGUID.ToString(EGuidFormats::DigitsWithHyphensLower));
+			}
+		}
+	};
+
+	for (const FName& RemovedRowName : RemovedRowNames)
+	{
+		if (const FDialogueRow* RemovedRow = RemovedRowName.IsNone() ? nullptr : DialogueRowsDataTable->FindRow<FDialogueRow>(RemovedRowName, TEXT(""), false))
+		{
+			removeRowTexts(*RemovedRow, TSet<FGuid>());
+			DialogueRowsDataTable->RemoveRow(RemovedRowName);
+			bDialogueRowsChanged = true;
+			OutSummary.RowsRemoved++;
+		}
+	}
+
+	TMap<FString, const FDialogueParticipant*> ParticipantsMap;
+	for (UMounteaDialogueGraphNode* Node : Graph->AllNodes)
+	{
+		UMounteaDialogueGraphNode_DialogueNodeBase* DialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node);
+		if (!DialogueNode) continue;
+
+		const FGuid nodeGuid = DialogueNode->GetNodeGUID();
+		const uint32* newRowHash = newHashes.RowHashes.Find(nodeGuid);
+		const uint32* oldRowHash = oldHashes.RowHashes.Find(nodeGuid);
+		
+		const FName ExistingRowName = DialogueNode->GetRowName();
+		const FDialogueRow* ExistingRow = ExistingRowName.IsNone() ? nullptr : DialogueRowsDataTable->FindRow<FDialogueRow>(ExistingRowName, TEXT(""), false);
+
+		if (!newRowHash)
+		{
+			// Only Rows created by import are removed, manually assigned Rows are kept
+			if (ExistingRow && oldRowHash)
+			{
+				removeRowTexts(*ExistingRow, TSet<FGuid>());
+				DialogueRowsDataTable->RemoveRow(ExistingRowName);
+				DialogueNode->SetRowName(NAME_None);
+				bDialogueRowsChanged = true;
+				OutSummary.RowsRemoved++;
+			}
+			continue;
+		}
+
+		if (ExistingRow && oldRowHash && *oldRowHash == *newRowHash)
+		{
+			OutSummary.RowsUnchanged++;
+			continue;
+		}
+
+		const FString ParticipantName = GetNodeParticipantName(dialogueNodesJsonMap.FindRef(nodeGuid));
+		if (ParticipantName.IsEmpty())
+		{
+			EditorLOG_WARNING(TEXT("[ReimportDialogueGraphIncremental] Participant name not found for NodeId: %s"), *nodeGuid.ToString());
+			continue;
+		}
+
+		const FDialogueParticipant* Participant = nullptr;
+		if (const FDialogueParticipant** CachedParticipant = ParticipantsMap.Find(ParticipantName))
+		{
+			Participant = *CachedParticipant;
+		}
+		else
+		{
+			Participant = ParticipantsDataTable->FindRow<FDialogueParticipant>(FName(*ParticipantName), TEXT(""));
+			ParticipantsMap.Add(ParticipantName, Participant);
+		}
+
+		if (!Participant)
+		{
+			EditorLOG_WARNING(TEXT("[ReimportDialogueGraphIncremental] Participant not found for NodeId: %s"), *nodeGuid.ToString());
+			continue;
+		}
+
+		const TArray<TSharedPtr<FJsonObject>>& Rows = groupedDialogueRows.FindChecked(nodeGuid);
+		const FString NodeId = Rows[0]->GetStringField(TEXT("nodeId"));
+
+		TSet<FGuid> NewRowData;
+		for (const auto& RowObject : Rows)
+		{
+			const FString Id = RowObject->GetStringField(TEXT("id"));
+			DialogueRowsStringTable->GetMutableStringTable()->SetSourceString(Id, RowObject->GetStringField(TEXT("text")));
+			NewRowData.Add(FGuid(Id));
+		}
+
+		FDialogueRow NewRow;
+		BuildDialogueRow(NodeId, Rows, *Participant, NodesStringTable, DialogueRowsStringTable, NewRow);
+
+		const bool bRowExists = ExistingRow != nullptr;
+		FName NewRowName = ExistingRowName;
+		if (bRowExists)
+		{
+			removeRowTexts(*ExistingRow, NewRowData);
+			
+			// Sounds are kept, changed audio files are reimported below
+			for (FDialogueRowData& RowData : NewRow.DialogueRowData)
+			{
+				if (const FDialogueRowData* ExistingRowData = ExistingRow->DialogueRowData.FindByPredicate([&RowData](const FDialogueRowData& Other) { return Other.RowGUID == RowData.RowGUID; }))
+				{
+					RowData.RowSound = ExistingRowData->RowSound;
+				}
+			}
+		}
+
+		// Row names are prefixed with Participant name
+		const FString RowNamePrefix = Participant->ParticipantName.ToString() + TEXT("_");
+		if (!bRowExists || !ExistingRowName.ToString().StartsWith(RowNamePrefix))
+		{
+			int32 RowIndex = DialogueRowsDataTable->GetRowMap().Num();
+			do
+			{
+				NewRowName = FName(*FString::Printf(TEXT("%s%d"), *RowNamePrefix, RowIndex++));
+			}
+			while (DialogueRowsDataTable->GetRowMap().Contains(NewRowName));
+
+			if (bRowExists)
+			{
+				DialogueRowsDataTable->RemoveRow(ExistingRowName);
+			}
+		}
+
+		if (bRowExists)
+		{
+			OutSummary.RowsUpdated++;
+		}
+		else
+		{
+			OutSummary.RowsAdded++;
+		}
+		
+		DialogueRowsDataTable->AddRow(NewRowName, NewRow);
+		DialogueNode->SetDataTable(DialogueRowsDataTable);
+		DialogueNode->SetRowName(NewRowName);
+		bDialogueRowsChanged = true;
+	}
+	recordStep(TEXT("Diff: Dialogue Rows"));
+
+	// Audio
+	TMap<FGuid, FDialogueRowData*> RowDataMap;
+	for (const auto& RowPair : DialogueRowsDataTable->GetRowMap())
+	{
+		if (FDialogueRow* DialogueRow = reinterpret_cast<FDialogueRow*>(RowPair.Value))
+		{
+			for (FDialogueRowData& RowData : DialogueRow->DialogueRowData)
+			{
+				RowDataMap.Add(RowData.RowGUID, &RowData);
+			}
+		}
+	}
+
+	TMap<FString, FString> ChangedAudioFiles;
+	for (const auto& File : ExtractedFiles)
+	{
+		if (!File.Key.StartsWith("audio/") || !File.Key.EndsWith(".wav")) continue;
+
+		FString RelativePath = File.Key;
+		RelativePath.RemoveFromStart(TEXT("audio/"));
+		const FGuid rowDataGuid = FGuid(FPaths::GetBaseFilename(FPaths::GetPath(RelativePath)));
+
+		const uint32* oldAudioHash = oldHashes.AudioHashes.Find(rowDataGuid);
+		const uint32* newAudioHash = newHashes.AudioHashes.Find(rowDataGuid);
+		FDialogueRowData** RowData = RowDataMap.Find(rowDataGuid);
+		if (oldAudioHash && newAudioHash && *oldAudioHash == *newAudioHash && RowData && (*RowData)->RowSound)
+		{
+			OutSummary.AudioUnchanged++;
+			continue;
+		}
+
+		ChangedAudioFiles.Add(File.Key, File.Value);
+	}
+
+	for (const auto& OldAudioHash : oldHashes.AudioHashes)
+	{
+		if (newHashes.AudioHashes.Contains(OldAudioHash.Key)) continue;
+
+		// Sound Wave asset is kept, it might be used somewhere else
+		FDialogueRowData** RowData = RowDataMap.Find(OldAudioHash.Key);
+		if (RowData && (*RowData)->RowSound)
+		{
+			(*RowData)->RowSound = nullptr;
+			bDialogueRowsChanged = true;
+			OutSummary.AudioRemoved++;
+		}
+	}
+
+	if (bDialogueRowsChanged)
+	{
+		UpdateGraphImportDataConfig(Graph, TEXT("dialogueRows.json"), ExtractedFiles["dialogueRows.json"], PackagePath, DialogueRowsDataTable->GetName());
+		
+		SaveAsset(DialogueRowsStringTable);
+		SaveAsset(NodesStringTable);
+		SaveAsset(DialogueRowsDataTable);
+	}
+	else if (OutSummary.NodesAdded + OutSummary.NodesUpdated + OutSummary.NodesRemoved > 0)
+	{
+		SaveAsset(NodesStringTable);
+	}
+
+	if (ChangedAudioFiles.Num() > 0)
+	{
+		ImportAudioFiles(ChangedAudioFiles, Graph, Graph);
+		OutSummary.AudioImported = ChangedAudioFiles.Num();
+	}
+	recordStep(TEXT("Diff: Audio"));
+
+	Graph->ImportHashes = newHashes;
+	Graph->MarkPackageDirty();
+
+	return true;
+}
+
+TSharedPtr<FJsonObject> UMounteaDialogueSystemImportExportHelpers::GetNodeAdditionalInfo(const TSharedPtr<FJsonObject>& NodeObject)
+{
+	const TSharedPtr<FJsonObject>* DataObject = nullptr;
+	const TSharedPtr<FJsonObject>* AdditionalInfoObject = nullptr;
+	if (NodeObject.IsValid() && NodeObject->TryGetObjectField(TEXT("data"), DataObject) && (*DataObject)->TryGetObjectField(TEXT("additionalInfo"), AdditionalInfoObject))
+	{
+		return *AdditionalInfoObject;
+	}
+	return nullptr;
+}
+
+TSubclassOf<UMounteaDialogueGraphNode> UMounteaDialogueSystemImportExportHelpers::GetImportedNodeClass(const FString& NodeType)
+{
+	if (NodeType == "leadNode")
+	{
+		return UMounteaDialogueGraphNode_LeadNode::StaticClass();
+	}
+	if (NodeType == "answerNode")
+	{
+		return UMounteaDialogueGraphNode_AnswerNode::StaticClass();
+	}
+	if (NodeType == "closeDialogueNode")
+	{
+		return UMounteaDialogueGraphNode_CompleteNode::StaticClass();
+	}
+	if (NodeType == "jumpToNode")
+	{
+		return UMounteaDialogueGraphNode_ReturnToNode::StaticClass();
+	}
+	return nullptr;
+}
+
+FString UMounteaDialogueSystemImportExportHelpers::GetNodeParticipantName(const TSharedPtr<FJsonObject>& NodeObject)
+{
+	FString ParticipantName;
+	const TSharedPtr<FJsonObject>* ParticipantObject = nullptr;
+	const TSharedPtr<FJsonObject> AdditionalInfoObject = GetNodeAdditionalInfo(NodeObject);
+	if (AdditionalInfoObject.IsValid() && AdditionalInfoObject->TryGetObjectField(TEXT("participant"), ParticipantObject))
+	{
+		(*ParticipantObject)->TryGetStringField(TEXT("name"), ParticipantName);
+	}
+	return ParticipantName;
+}
+
+FString UMounteaDialogueSystemImportExportHelpers::ToCondensedJson(const TSharedRef<FJsonObject>& JsonObject)
+{
+	FString JsonString;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	FJsonSerializer::Serialize(JsonObject, Writer);
+	return JsonString;
+}
+
+FString FDialogueReimportSummary::ToString() const
+{
+	return FString::Printf(TEXT("Nodes: +%d ~%d -%d (%d unchanged)\nDialogue Rows: +%d ~%d -%d (%d unchanged)\nAudio: %d imported, %d removed (%d unchanged)%s"),
+		NodesAdded, NodesUpdated, NodesRemoved, NodesUnchanged,
+		RowsAdded, RowsUpdated, RowsRemoved, RowsUnchanged,
+		AudioImported, AudioRemoved, AudioUnchanged,
+		bEdgesChanged ? TEXT("\nEdges updated") : TEXT(""));
+}
+
+FString FDialogueImportTimings::ToString() const
+{
+	FString Result = FString::Printf(TEXT("Import took %.2f ms"), GetTotalTime() * 1000.0);
+	for (const auto& Step : Steps)
+	{
+		Result.Append(FString::Printf(TEXT("\n- %s: %.2f ms"), *Step.Key, Step.Value * 1000.0));
+	}
+	return Result;
+}
+
+UStringTable* UMounteaDialogueSystemImportExportHelpers::CreateStringTable(IAssetTools& AssetTools, const FString& PackagePath, const FString& AssetName, TFunction<void(UStringTable*)> PopulateFunction)
+{
+	UStringTable* StringTable = nullptr;
+	
+	FSoftObjectPath StringTableAssetPath = PackagePath + TEXT("/") + AssetName + TEXT(".") + AssetName;
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	FAssetData StringTableAssetData = AssetRegistryModule.Get().GetAssetByObjectPath(StringTableAssetPath);
+	if (StringTableAssetData.IsValid())
+	{
+		StringTable = Cast<UStringTable>(StringTableAssetData.GetAsset());
+	}
+	else
+	{
+		StringTable = Cast<UStringTable>(AssetTools.CreateAsset(AssetName, PackagePath, UStringTable::StaticClass(), nullptr));
+	}
+	
+	if (StringTable)
+	{
+		PopulateFunction(StringTable);
+	}
+	return StringTable;
+}
+
+template <typename RowType>
+UDataTable* UMounteaDialogueSystemImportExportHelpers::CreateDataTable(IAssetTools& AssetTools, const FString& PackagePath, const FString& AssetName)
+{
+	UDataTable* DataTable = nullptr;
+
+	FSoftObjectPath DataTableAssetPath = PackagePath + TEXT("/") + AssetName + TEXT(".") + AssetName;
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	FAssetData DataTableAssetData = AssetRegistryModule.Get().GetAssetByObjectPath(DataTableAssetPath);
+	if (DataTableAssetData.IsValid())
+	{
+		DataTable = Cast<UDataTable>(DataTableAssetData.GetAsset());
+	}
+	else
+	{
+		DataTable = Cast<UDataTable>(
+		AssetTools.CreateAsset(AssetName, PackagePath, UDataTable::StaticClass(), nullptr));
+	}
+	
+	if (DataTable)
+	{
+		DataTable->RowStruct = RowType::StaticStruct();
+	}
+	
+	return DataTable;
+}
+
+void UMounteaDialogueSystemImportExportHelpers::SaveAsset(UObject* Asset)
+{
+	if (!Asset)
+		return;
+
+	Asset->MarkPackageDirty();
+	FAssetRegistryModule::AssetCreated(Asset);
+	const FString PackageName = Asset->GetOutermost()->GetName();
+	const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs saveArgs;
+	{
+		saveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	}
+	UPackage::SavePackage(Asset->GetOutermost(), Asset, *PackageFileName, saveArgs);
+}
+
+void UMounteaDialogueSystemImportExportHelpers::SaveAssets(const TArray<UPackage*>& Packages)
+{
+	TArray<UPackage*> PackagesToSave;
+	PackagesToSave.Reserve(Packages.Num());
+	for (UPackage* Package : Packages)
+	{
+		if (Package)
+		{
+			PackagesToSave.AddUnique(Package);
+		}
+	}
+
+	if (PackagesToSave.Num() == 0)
+		return;
+
+	if (!UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true))
+	{
+		EditorLOG_WARNING(TEXT("[SaveAssets] Failed to save some of %d packages"), PackagesToSave.Num());
+	}
+}
+
+bool UMounteaDialogueSystemImportExportHelpers::GatherAssetsFromGraph(const UMounteaDialogueGraph* Graph, TArray<FDialogueJsonEntry>& OutJsonEntries, TArray<FString>& OutAudioFiles)
+{
+	if (!Graph)
+	{
+		EditorLOG_ERROR(TEXT("[GatherAssetsFromGraph] Invalid Dialogue Graph!"));
+		return false;
+	}
+
+	TSharedRef<TArray<FDialogueNodeData>> AllNodeData = MakeShared<TArray<FDialogueNodeData>>();
+	GatherNodesFromGraph(Graph, *AllNodeData);
+
+	// JSON documents are generated one by one while packing, so only one of them is kept in memory
+	OutJsonEntries.Add({ TEXT("nodes.json"), [AllNodeData]() { return CreateNodesJson(*AllNodeData); } });
+	OutJsonEntries.Add({ TEXT("edges.json"), [Graph]() { return CreateEdgesJson(Graph); } });
+	OutJsonEntries.Add({ TEXT("categories.json"), [Graph]() { return CreateCategoriesJson(Graph); } });
+	OutJsonEntries.Add({ TEXT("dialogueData.json"), [Graph]() { return CreateDialogueDataJson(Graph); } });
+	OutJsonEntries.Add({ TEXT("participants.json"), [Graph]() { return CreateParticipantsJson(Graph); } });
+	OutJsonEntries.Add({ TEXT("dialogueRows.json"), [AllNodeData, Graph]() { return CreateDialogueRowsJson(*AllNodeData, Graph); } });
+
+	// Gather audio files
+	GatherAudioFiles(Graph, OutAudioFiles);
+
+	return true;
+}
+
+void UMounteaDialogueSystemImportExportHelpers::GatherNodesFromGraph(const UMounteaDialogueGraph* Graph, TArray<FDialogueNodeData>& OutNodeData)
+{
+	for (UMounteaDialogueGraphNode* Node : Graph->GetAllNodes())
+	{
+		if (!Node) continue;
+
+		if (Cast<UMounteaDialogueGraphNode_StartNode>(Node))
+			OutNodeData.Add(FDialogueNodeData(TEXT("startNode"), Node));
+		else if (Cast<UMounteaDialogueGraphNode_LeadNode>(Node))
+			OutNodeData.Add(FDialogueNodeData(TEXT("leadNode"), Node));
+		else if (Cast<UMounteaDialogueGraphNode_AnswerNode>(Node))
+			OutNodeData.Add(FDialogueNodeData(TEXT("answerNode"), Node));
+		else if (Cast<UMounteaDialogueGraphNode_CompleteNode>(Node))
+			OutNodeData.Add(FDialogueNodeData(TEXT("closeDialogueNode"), Node));
+		else if (Cast<UMounteaDialogueGraphNode_ReturnToNode>(Node))
+			OutNodeData.Add(FDialogueNodeData(TEXT("jumpToNode"), Node));
+		else
+			EditorLOG_WARNING(TEXT("[GatherNodesFromGraph] Unknown node type: %s"), *Node->GetClass()->GetName());
+	}
+}
+
+bool UMounteaDialogueSystemImportExportHelpers::GatherAudioFiles(const UMounteaDialogueGraph* Graph, TArray<FString>& OutAudioFiles)
+{
+	if (!Graph)
+	{
+		EditorLOG_ERROR(TEXT("[GatherAudioFiles] Invalid Graph provided"));
+		return false;
+	}
+
+	for (const UMounteaDialogueGraphNode* Node : Graph->GetAllNodes())
+	{
+		const UMounteaDialogueGraphNode_DialogueNodeBase* DialogueNode = Cast<UMounteaDialogueGraphNode_DialogueNodeBase>(Node);
+		if (!DialogueNode)
+		{
+			continue;
+		}
+
+		if (!DialogueNode->GetDataTable())
+		{
+			continue;
+		}
+
+		const FDialogueRow* DialogueRow = DialogueNode->GetDataTable()->FindRow<FDialogueRow>(DialogueNode->GetRowName(), TEXT(""));
+		if (!DialogueRow)
+		{
+			continue;
+		}
+
+		for (const FDialogueRowData& RowData : DialogueRow->DialogueRowData)
+		{
+			if (RowData.RowSound)
+			{
+				FString AudioPath = RowData.RowSound->GetOuter()->GetName();
+				OutAudioFiles.AddUnique(AudioPath);
+			}
+		}
+	}
+
+	return true;
+}
+
+FString UMounteaDialogueSystemImportExportHelpers::CreateNodesJson(const TArray<FDialogueNodeData>& NodeData)
+{
+	TArray<TSharedPtr<FJsonValue>> NodesArray;
+
+	for (const FDialogueNodeData& Data : NodeData)
 	{
 		if (!Data.Node)
 		{
@@ -1736,10 +2615,23 @@ FString UMounteaDialogueSystemImportExportHelpers::CreateEdgesJson(const UMounte
 bool UMounteaDialogueSystemImportExportHelpers::ExportAudioFiles(const TArray<FString>& AudioFiles, const FString& ExportPath, TArray<FString>& OutExportedFiles)
 {
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	
+
+	FScopedSlowTask SlowTask(AudioFiles.Num() * 2, LOCTEXT("ExportAudioFiles", "Exporting Dialogue audio files..."));
+	SlowTask.MakeDialog(true);
+
+	// Loading must happen on Game Thread
+	TArray<FAudioExportEntry> AudioEntries;
+	AudioEntries.Reserve(AudioFiles.Num());
 	for (const FString& AudioFile : AudioFiles)
 	{
-		const USoundWave* SoundWave = LoadObject<USoundWave>(nullptr, *AudioFile);
+		SlowTask.EnterProgressFrame(1, FText::FromString(FPaths::GetBaseFilename(AudioFile)));
+		if (SlowTask.ShouldCancel())
+		{
+			EditorLOG_WARNING(TEXT("[ExportAudioFiles] Audio export cancelled"));
+			return false;
+		}
+		
+		USoundWave* SoundWave = LoadObject<USoundWave>(nullptr, *AudioFile);
 		if (!SoundWave)
 		{
 			EditorLOG_ERROR(TEXT("[ExportAudioFiles] Failed to load audio file: %s"), *AudioFile);
@@ -1769,35 +2661,69 @@ bool UMounteaDialogueSystemImportExportHelpers::ExportAudioFiles(const TArray<FS
 			return false;
 		}
 
-		// Get the raw PCM data
-		TArray<uint8> RawPCMData;
-		uint32 SampleRate;
-		uint16 NumChannels;
+		FAudioExportEntry& AudioEntry = AudioEntries.AddDefaulted_GetRef();
+		AudioEntry.SoundWave = SoundWave;
+		AudioEntry.SourcePath = AudioFile;
+		AudioEntry.DestinationPath = DestinationPath.Append(".wav");
+	}
 
-		if (SoundWave->GetImportedSoundWaveData(RawPCMData, SampleRate, NumChannels))
+	bool bExportSucceeded = true;
+	for (int32 BatchStart = 0; BatchStart < AudioEntries.Num() && bExportSucceeded; BatchStart += AudioBatchSize)
+	{
+		if (SlowTask.ShouldCancel())
 		{
-			TArray<uint8> WAVData;
-			CreateWAVFile(RawPCMData, SampleRate, NumChannels, WAVData);
+			EditorLOG_WARNING(TEXT("[ExportAudioFiles] Audio export cancelled"));
+			return false;
+		}
+		
+		const int32 BatchNum = FMath::Min(AudioBatchSize, AudioEntries.Num() - BatchStart);
+		SlowTask.EnterProgressFrame(BatchNum, FText::Format(LOCTEXT("ExportAudioFilesBatch", "Writing audio files {0}/{1}"), BatchStart + BatchNum, AudioEntries.Num()));
 
-			DestinationPath.Append(".wav");
+		// Raw PCM data lives in Sound Wave bulk data, which can only be accessed on Game Thread
+		for (int32 Index = BatchStart; Index < BatchStart + BatchNum; Index++)
+		{
+			FAudioExportEntry& AudioEntry = AudioEntries[Index];
+			AudioEntry.bHasSoundWaveData = AudioEntry.SoundWave->GetImportedSoundWaveData(AudioEntry.RawPCMData, AudioEntry.SampleRate, AudioEntry.NumChannels);
+		}
 
-			// Save the WAV data to the destination file
-			if (!FFileHelper::SaveArrayToFile(WAVData, *DestinationPath))
+		// Encoding and writing WAV files does not touch any UObject
+		ParallelFor(BatchNum, [&AudioEntries, BatchStart](const int32 Index)
+		{
+			FAudioExportEntry& AudioEntry = AudioEntries[BatchStart + Index];
+			if (AudioEntry.bHasSoundWaveData)
 			{
-				EditorLOG_ERROR(TEXT("[ExportAudioFiles] Failed to save audio file: %s"), *DestinationPath);
-				return false;
+				TArray<uint8> WAVData;
+				CreateWAVFile(AudioEntry.RawPCMData, AudioEntry.SampleRate, AudioEntry.NumChannels, WAVData);
+				
+				// Save the WAV data to the destination file
+				AudioEntry.bExported = FFileHelper::SaveArrayToFile(WAVData, *AudioEntry.DestinationPath);
 			}
 
-			OutExportedFiles.Add(DestinationPath);
-		}
-		else
+			// Release memory of processed files right away, voice packs might be huge
+			AudioEntry.RawPCMData.Empty();
+		});
+
+		for (int32 Index = BatchStart; Index < BatchStart + BatchNum; Index++)
 		{
-			EditorLOG_ERROR(TEXT("[ExportAudioFiles] Failed to get imported sound wave data for: %s"), *AudioFile);
-			return false;
+			const FAudioExportEntry& AudioEntry = AudioEntries[Index];
+			if (!AudioEntry.bHasSoundWaveData)
+			{
+				EditorLOG_ERROR(TEXT("[ExportAudioFiles] Failed to get imported sound wave data for: %s"), *AudioEntry.SourcePath);
+				bExportSucceeded = false;
+			}
+			else if (!AudioEntry.bExported)
+			{
+				EditorLOG_ERROR(TEXT("[ExportAudioFiles] Failed to save audio file: %s"), *AudioEntry.DestinationPath);
+				bExportSucceeded = false;
+			}
+			else
+			{
+				OutExportedFiles.Add(AudioEntry.DestinationPath);
+			}
 		}
 	}
 
-	return true;
+	return bExportSucceeded;
 }
 
 void UMounteaDialogueSystemImportExportHelpers::CreateWAVFile(const TArray<uint8>& InPCMData, uint32 InSampleRate, uint16 InNumChannels, TArray<uint8>& OutWAVData)
@@ -1833,29 +2759,34 @@ void UMounteaDialogueSystemImportExportHelpers::CreateWAVFile(const TArray<uint8
 	FMemory::Memcpy(OutWAVData.GetData() + sizeof(WAVHeader), InPCMData.GetData(), InPCMData.Num());
 }
 
-bool UMounteaDialogueSystemImportExportHelpers::PackToMNTEADLG(const TMap<FString, FString>& JsonFiles, const TArray<FString>& ExportedAudioFiles, const FString& OutputPath)
+bool UMounteaDialogueSystemImportExportHelpers::PackToMNTEADLG(const TArray<FDialogueJsonEntry>& JsonEntries, const TArray<FString>& ExportedAudioFiles, const FString& OutputPath)
 {
 	FString ZipFilePath = FPaths::ChangeExtension(OutputPath, TEXT("mnteadlg"));
+
+	const UMounteaDialogueGraphEditorSettings* EditorSettings = GetDefault<UMounteaDialogueGraphEditorSettings>();
+	const int32 CompressionLevel = EditorSettings ? EditorSettings->GetExportCompressionLevel() : ZIP_DEFAULT_COMPRESSION_LEVEL;
 	
-	struct zip_t* zip = zip_open(TCHAR_TO_UTF8(*ZipFilePath), ZIP_DEFAULT_COMPRESSION_LEVEL, 'w');
+	struct zip_t* zip = zip_open(TCHAR_TO_UTF8(*ZipFilePath), CompressionLevel, 'w');
 	if (!zip)
 	{
 		EditorLOG_ERROR(TEXT("[PackToMNTEADLG] Failed to create zip file: %s"), *ZipFilePath);
 		return false;
 	}
 	
-	for (const auto& JsonFile : JsonFiles)
+	for (const FDialogueJsonEntry& JsonEntry : JsonEntries)
 	{
-		if (zip_entry_open(zip, TCHAR_TO_UTF8(*JsonFile.Key)) < 0)
+		if (zip_entry_open(zip, TCHAR_TO_UTF8(*JsonEntry.FileName)) < 0)
 		{
-			EditorLOG_ERROR(TEXT("[PackToMNTEADLG] Failed to open zip entry for JSON file: %s"), *JsonFile.Key);
+			EditorLOG_ERROR(TEXT("[PackToMNTEADLG] Failed to open zip entry for JSON file: %s"), *JsonEntry.FileName);
 			zip_close(zip);
 			return false;
 		}
 
-		if (zip_entry_write(zip, TCHAR_TO_UTF8(*JsonFile.Value), JsonFile.Value.Len()) < 0)
+		// Released right after writing, before next document is generated
+		const FString JsonContent = JsonEntry.Generator ? JsonEntry.Generator() : FString();
+		if (!WriteUTF8ToZipEntry(zip, JsonContent))
 		{
-			EditorLOG_ERROR(TEXT("[PackToMNTEADLG] Failed to write JSON file to zip: %s"), *JsonFile.Key);
+			EditorLOG_ERROR(TEXT("[PackToMNTEADLG] Failed to write JSON file to zip: %s"), *JsonEntry.FileName);
 			zip_entry_close(zip);
 			zip_close(zip);
 			return false;
@@ -1872,10 +2803,16 @@ bool UMounteaDialogueSystemImportExportHelpers::PackToMNTEADLG(const TMap<FStrin
 		return false;
 	}
 	zip_entry_close(zip);
-	
+
+	const FString ExportDirectory = FPaths::GetPath(OutputPath);
 	for (const FString& AudioFile : ExportedAudioFiles)
 	{
-		FString AudioFileName = FPaths::GetCleanFilename(AudioFile);
+		// Keep Row subfolder, importer reads Row GUID from it
+		FString AudioFileName = AudioFile;
+		if (!FPaths::MakePathRelativeTo(AudioFileName, *(ExportDirectory / TEXT(""))))
+		{
+			AudioFileName = FPaths::GetCleanFilename(AudioFile);
+		}
 		FString ZipAudioPath = FString::Printf(TEXT("audio/%s"), *AudioFileName);
 
 		if (zip_entry_open(zip, TCHAR_TO_UTF8(*ZipAudioPath)) < 0)
@@ -1885,16 +2822,8 @@ bool UMounteaDialogueSystemImportExportHelpers::PackToMNTEADLG(const TMap<FStrin
 			return false;
 		}
 
-		TArray<uint8> AudioFileData;
-		if (!FFileHelper::LoadFileToArray(AudioFileData, *AudioFile))
-		{
-			EditorLOG_ERROR(TEXT("[PackToMNTEADLG] Failed to read audio file: %s"), *AudioFile);
-			zip_entry_close(zip);
-			zip_close(zip);
-			return false;
-		}
-
-		if (zip_entry_write(zip, AudioFileData.GetData(), AudioFileData.Num()) < 0)
+		// Streamed from disk in chunks, audio file is never fully loaded
+		if (zip_entry_fwrite(zip, TCHAR_TO_UTF8(*FPaths::ConvertRelativePathToFull(AudioFile))) < 0)
 		{
 			EditorLOG_ERROR(TEXT("[PackToMNTEADLG] Failed to write audio file to zip: %s"), *AudioFileName);
 			zip_entry_close(zip);
@@ -1910,6 +2839,36 @@ bool UMounteaDialogueSystemImportExportHelpers::PackToMNTEADLG(const TMap<FStrin
 	return true;
 }
 
+bool UMounteaDialogueSystemImportExportHelpers::WriteUTF8ToZipEntry(zip_t* Zip, const FString& Content)
+{
+	constexpr int32 ChunkLength = 64 * 1024;
+
+	const TCHAR* ChunkStart = *Content;
+	int32 RemainingLength = Content.Len();
+	while (RemainingLength > 0)
+	{
+		int32 Length = FMath::Min(ChunkLength, RemainingLength);
+
+		// Never split surrogate pair between two chunks
+		if (Length < RemainingLength && StringConv::IsHighSurrogate(ChunkStart[Length - 1]))
+		{
+			Length--;
+		}
+
+		// Byte count of UTF-8 data, not number of characters
+		const FTCHARToUTF8 Converter(ChunkStart, Length);
+		if (zip_entry_write(Zip, Converter.Get(), Converter.Length()) < 0)
+		{
+			return false;
+		}
+
+		ChunkStart += Length;
+		RemainingLength -= Length;
+	}
+
+	return true;
+}
+
 FString UMounteaDialogueSystemImportExportHelpers::CreateCategoriesJson(const UMounteaDialogueGraph* Graph)
 {
 	if (!Graph)
@@ -12,6 +12,19 @@ class UMounteaDialogueGraphNode_DialogueNodeBase;
 class UMounteaDialogueGraph;
 class UMounteaDialogueGraphNode;
 class IAssetTools;
+class USoundWave;
+class UStringTable;
+struct zip_t;
+struct FDialogueImportHashes;
+struct FDialogueParticipant;
+struct FDialogueRow;
+
+// JSON document of exported package, generated only once it is written
+struct FDialogueJsonEntry
+{
+	FString FileName;
+	TFunction<FString()> Generator;
+};
 
 // Define a struct to hold node data
 struct FDialogueNodeData
@@ -22,6 +35,74 @@ struct FDialogueNodeData
 	FDialogueNodeData(const FString &InType, UMounteaDialogueGraphNode *InNode) : Type(InType), Node(InNode) {}
 };
 
+// Timing breakdown of Dialogue import, reported once import is finished
+struct FDialogueImportTimings
+{
+	TArray<TPair<FString, double>> Steps;
+	double StartTime = FPlatformTime::Seconds();
+
+	// Records Step which started at given time
+	void AddStep(const FString& StepName, const double StepStartTime)
+	{ Steps.Emplace(StepName, FPlatformTime::Seconds() - StepStartTime); };
+
+	double GetTotalTime() const
+	{ return FPlatformTime::Seconds() - StartTime; };
+
+	FString ToString() const;
+};
+
+// Changes applied by incremental reimport
+struct FDialogueReimportSummary
+{
+	int32 NodesAdded = 0;
+	int32 NodesUpdated = 0;
+	int32 NodesRemoved = 0;
+	int32 NodesUnchanged = 0;
+
+	int32 RowsAdded = 0;
+	int32 RowsUpdated = 0;
+	int32 RowsRemoved = 0;
+	int32 RowsUnchanged = 0;
+
+	int32 AudioImported = 0;
+	int32 AudioRemoved = 0;
+	int32 AudioUnchanged = 0;
+
+	bool bEdgesChanged = false;
+
+	FString ToString() const;
+};
+
+// Single audio file of imported package
+struct FAudioImportEntry
+{
+	FString TempAudioPath;
+	FString PackageName;
+	FString AssetName;
+	FGuid RowDataGuid;
+
+	// Filled by worker threads
+	TArray<uint8> WAVData;
+	bool bIsValid = false;
+};
+
+// Single Sound Wave of exported Dialogue
+struct FAudioExportEntry
+{
+	const USoundWave* SoundWave = nullptr;
+	FString SourcePath;
+	FString DestinationPath;
+
+	// Filled on Game Thread, bulk data must not be touched by worker threads
+	TArray<uint8> RawPCMData;
+	uint32 SampleRate = 0;
+	uint16 NumChannels = 0;
+	bool bHasSoundWaveData = false;
+
+	// Filled by worker threads
+	bool bExported = false;
+};
+
 /**
  *
  */
@@ -49,9 +130,9 @@ public:
 	
 	// Helper functions for import process
 	static bool IsZipFile(const TArray<uint8>& FileData);
-	static bool ExtractFilesFromZip(const TArray<uint8>& ZipData, TMap<FString, FString>& OutExtractedFiles);
+	static bool ExtractFilesFromZip(const TArray<uint8>& ZipData, TMap<FString, FString>& OutExtractedFiles, TMap<FString, uint32>* OutAudioHashes = nullptr);
 	static bool ValidateExtractedContent(const TMap<FString, FString>& ExtractedFiles);
-	static bool PopulateGraphFromExtractedFiles(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, const FString& SourceFilePath);
+	static bool PopulateGraphFromExtractedFiles(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, const FString& SourceFilePath, FDialogueImportTimings* OutTimings = nullptr);
 	static void ImportAudioFiles(const TMap<FString, FString>& ExtractedFiles, UObject* InParent, UMounteaDialogueGraph* Graph);
 	
 private:
@@ -61,7 +142,18 @@ private:
 	static bool PopulateParticipants(const UMounteaDialogueGraph* Graph, const FString& Json);
 	static bool PopulateNodes(UMounteaDialogueGraph* Graph, const FString& Json);
 	static bool PopulateEdges(UMounteaDialogueGraph* Graph, const FString& Json);
-	static bool PopulateDialogueRows(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles);
+	static bool PopulateDialogueRows(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, FDialogueImportTimings* OutTimings = nullptr);
+	static void BuildDialogueRow(const FString& NodeId, const TArray<TSharedPtr<FJsonObject>>& Rows, const FDialogueParticipant& Participant, const UStringTable* NodesStringTable, const UStringTable* DialogueRowsStringTable, FDialogueRow& OutRow);
+
+	// Helper functions for incremental reimport
+	static bool ComputeImportHashes(const TMap<FString, FString>& ExtractedFiles, const TMap<FString, uint32>& AudioHashes, FDialogueImportHashes& OutHashes);
+	// Applies only inserted, updated and removed Nodes, Rows and audio files. Returns false if Graph needs full reimport.
+	static bool ReimportDialogueGraphIncremental(UMounteaDialogueGraph* Graph, const TMap<FString, FString>& ExtractedFiles, const TMap<FString, uint32>& AudioHashes, const FString& SourceFilePath, FDialogueReimportSummary& OutSummary, FDialogueImportTimings* OutTimings = nullptr);
+	static TSharedPtr<FJsonObject> GetNodeAdditionalInfo(const TSharedPtr<FJsonObject>& NodeObject);
+	static FString GetNodeParticipantName(const TSharedPtr<FJsonObject>& NodeObject);
+	// Node class spawned for exported Node type, nullptr for types which are not spawned, such as Start Node
+	static TSubclassOf<UMounteaDialogueGraphNode> GetImportedNodeClass(const FString& NodeType);
+	static FString ToCondensedJson(const TSharedRef<FJsonObject>& JsonObject);
 	
 	// Utility functions
 	static FString BytesToString(const uint8* Bytes, int32 Count);
@@ -71,11 +163,18 @@ private:
 	template <typename RowType>
 	static UDataTable* CreateDataTable(IAssetTools& AssetTools, const FString& PackagePath, const FString& AssetName);
 	static void SaveAsset(UObject* Asset);
+	// Saves all Packages at once, used for large batches of imported assets
+	static void SaveAssets(const TArray<UPackage*>& Packages);
+
+	// Number of audio files read or written by worker threads before progress is updated
+	static constexpr int32 AudioBatchSize = 32;
 	
 	// Helper functions for export process
-	static bool GatherAssetsFromGraph(const UMounteaDialogueGraph* Graph, TMap<FString, FString>& OutJsonFiles, TArray<FString>& OutAudioFiles);
+	static bool GatherAssetsFromGraph(const UMounteaDialogueGraph* Graph, TArray<FDialogueJsonEntry>& OutJsonEntries, TArray<FString>& OutAudioFiles);
 	static bool ExportAudioFiles(const TArray<FString>& AudioFiles, const FString& ExportPath, TArray<FString>& OutExportedFiles);
-	static bool PackToMNTEADLG(const TMap<FString, FString>& JsonFiles, const TArray<FString>& ExportedAudioFiles, const FString& OutputPath);
+	static bool PackToMNTEADLG(const TArray<FDialogueJsonEntry>& JsonEntries, const TArray<FString>& ExportedAudioFiles, const FString& OutputPath);
+	// Writes Content into opened zip entry as UTF-8, converted in chunks
+	static bool WriteUTF8ToZipEntry(zip_t* Zip, const FString& Content);
 	
 	// Helper functions for gathering specific parts of the graph
 	static void GatherNodesFromGraph(const UMounteaDialogueGraph* Graph, TArray<FDialogueNodeData>& OutNodeData);
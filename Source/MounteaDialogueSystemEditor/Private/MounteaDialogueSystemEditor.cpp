@@ -23,6 +23,8 @@
 #include "Interfaces/IHttpResponse.h"
 #include "Interfaces/IPluginManager.h"
 #include "Popups/MDSPopup.h"
+#include "Search/MounteaDialogueSearchManager.h"
+#include "Validation/MounteaDialogueValidationManager.h"
 #include "Serialization/JsonReader.h"
 #include "Styling/SlateStyleRegistry.h"
 
@@ -401,6 +403,16 @@ void FMounteaDialogueSystemEditor::StartupModule()
 		);
 	}
 	
+	// Dialogue Search Index
+	{
+		FMounteaDialogueSearchManager::Get()->Initialize();
+	}
+
+	// Background Dialogue Validation
+	{
+		FMounteaDialogueValidationManager::Get()->Initialize();
+	}
+	
 	EditorLOG_WARNING(TEXT("MounteaDialogueSystemEditor module has been loaded"));
 }
 
@@ -448,6 +460,16 @@ void FMounteaDialogueSystemEditor::ShutdownModule()
 		}
 	}
 	
+	// Dialogue Search Index
+	{
+		FMounteaDialogueSearchManager::Get()->UnInitialize();
+	}
+
+	// Background Dialogue Validation
+	{
+		FMounteaDialogueValidationManager::Get()->UnInitialize();
+	}
+	
 	// Help Button Cleanup
 	{
 		UToolMenus::UnRegisterStartupCallback(this);
@@ -823,6 +845,24 @@ TSharedRef<SWidget> FMounteaDialogueSystemEditor::MakeMounteaMenuWidget() const
 				FExecuteAction::CreateRaw(this, &FMounteaDialogueSystemEditor::DialoguerButtonClicked)
 			)
 		);
+		
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("MounteaSystemEditor_FixProjectNodesButton_Label", "Fix Mountea Nodes in Project"),
+			LOCTEXT("MounteaSystemEditor_FixProjectNodesButton_ToolTip", "🔧 Replace deprecated Mountea nodes in all project Blueprints\n\n❔ Only Blueprints referencing replaced functions are loaded. Fixed Blueprints are compiled in batches, parents first.\n\n💡 Results and timing are reported in 'Mountea Nodes Fix-up' Message Log."),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Adjust"),
+			FUIAction(
+				FExecuteAction::CreateStatic(&FMounteaDialogueFixUtilities::ReplaceNodesInProjectBlueprints)
+			)
+		);
+		
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("MounteaSystemEditor_ReportProjectNodesButton_Label", "Fix Mountea Nodes in Project (Dry Run)"),
+			LOCTEXT("MounteaSystemEditor_ReportProjectNodesButton_ToolTip", "🔍 Report deprecated Mountea nodes in all project Blueprints\n\n❔ Nothing is modified, affected Blueprints are listed in 'Mountea Nodes Fix-up' Message Log."),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Search"),
+			FUIAction(
+				FExecuteAction::CreateStatic(&FMounteaDialogueFixUtilities::ReportNodesInProjectBlueprints)
+			)
+		);
 	}
 	
 	MenuBuilder.AddMenuEntry(
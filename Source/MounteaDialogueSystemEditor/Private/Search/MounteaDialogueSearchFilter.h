@@ -24,4 +24,7 @@ public:
 	bool bIncludeNodeDecoratorsTypes = true;
 	bool bIncludeNodeData = true;
 	bool bIncludeNodeGUID = false;
+
+	// Searches all indexed Dialogues, not only the edited one
+	bool bSearchAllDialogues = false;
 };
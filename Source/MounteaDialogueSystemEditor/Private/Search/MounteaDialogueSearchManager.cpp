@@ -4,6 +4,7 @@
 
 #include "MounteaDialogueSearchFilter.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
 #include "Ed/EdGraph_MounteaDialogueGraph.h"
 #include "Nodes/MounteaDialogueGraphNode.h"
 #include "Nodes/MounteaDialogueGraphNode_DialogueNodeBase.h"
@@ -167,23 +168,7 @@ bool FMounteaDialogueSearchManager::QueryNodeDecorators(const FMounteaDialogueSe
 	{
 		bContainsSearchString = true;
 
-		FString DecoratorName = InDecorator.DecoratorType->GetClass()->GetName();
-		// Format Name
-		{
-			if (DecoratorName.Contains(TEXT("_GEN_VARIABLE")))
-			{
-				DecoratorName.ReplaceInline(TEXT("_GEN_VARIABLE"), TEXT(""));
-			}
-			if(DecoratorName.EndsWith(TEXT("_C")) && DecoratorName.StartsWith(TEXT("Default__")))
-			{
-				DecoratorName.RightChopInline(9);
-				DecoratorName.LeftChopInline(2);
-			}
-			if (DecoratorName.EndsWith(TEXT("_C")))
-			{
-				DecoratorName.LeftChopInline(2);
-			}
-		}
+		const FString DecoratorName = FormatDecoratorName(InDecorator.DecoratorType->GetClass()->GetName());
 		
 		const FText Category = FText::Format
 		(
@@ -240,6 +225,178 @@ bool FMounteaDialogueSearchManager::QuerySingleDialogue(const FMounteaDialogueSe
 	return bFoundInDialogue;
 }
 
+bool FMounteaDialogueSearchManager::QueryIndexEntry(const FMounteaDialogueSearchFilter& SearchFilter, const FSoftObjectPath& InDialoguePath, const FDialogueSearchIndexEntry& InIndexEntry, const TSharedPtr<FMounteaDialogueSearchResult>& OutParentNode) const
+{
+	if (SearchFilter.SearchString.IsEmpty() || !OutParentNode.IsValid())
+	{
+		return false;
+	}
+
+	bool bContainsSearchString = false;
+
+	const FText DisplayText = FText::Format
+	(
+		LOCTEXT("MounteaDialogueIndexedNodeCategory", "Found results in {0}"),
+		FText::FromString(InIndexEntry.NodeType)
+	);
+
+	const TSharedPtr<FMounteaDialogueSearchResult_IndexedGraphNode> TreeGraphNode = MakeShared<FMounteaDialogueSearchResult_IndexedGraphNode>(DisplayText, OutParentNode);
+	TreeGraphNode->SetCategory(FText::FromString(InIndexEntry.NodeType));
+	TreeGraphNode->SetNodeGUID(InDialoguePath, InIndexEntry.NodeGuid);
+
+	// Search by Title
+	if (SearchFilter.bIncludeNodeTitle && InIndexEntry.NodeTitle.Contains(SearchFilter.SearchString))
+	{
+		bContainsSearchString = true;
+		MakeChildTextNode
+		(
+			TreeGraphNode,
+			FText::FromString(InIndexEntry.NodeTitle),
+			LOCTEXT("NodeTitleKey", "Node Title"),
+			TEXT("Node Title")
+		);
+	}
+
+	// Search by NodeTypeName
+	if (SearchFilter.bIncludeNodeType && InIndexEntry.NodeType.Contains(SearchFilter.SearchString))
+	{
+		bContainsSearchString = true;
+		MakeChildTextNode
+		(
+			TreeGraphNode,
+			FText::FromString(InIndexEntry.NodeType),
+			LOCTEXT("NodeTypeKey", "Node Type"),
+			TEXT("Node Type")
+		);
+	}
+
+	// Search by Decorators
+	if (SearchFilter.bIncludeNodeDecoratorsTypes)
+	{
+		for (int32 Index = 0, Num = InIndexEntry.DecoratorNames.Num(); Index < Num; Index++)
+		{
+			const FString& DecoratorName = InIndexEntry.DecoratorNames[Index];
+			if (DecoratorName.Contains(SearchFilter.SearchString))
+			{
+				bContainsSearchString = true;
+
+				const FText Category = FText::Format
+				(
+					LOCTEXT("DecoratorName", "Node Decorator: {0} at Index: {1}"),
+					FText::FromString(DecoratorName), FText::AsNumber(Index)
+				);
+				MakeChildTextNode
+				(
+					TreeGraphNode,
+					FText::FromString(DecoratorName),
+					Category,
+					Category.ToString()
+				);
+			}
+		}
+	}
+
+	// Search by Node Data, including Row texts which are not available to live search without loading Data Tables
+	if (SearchFilter.bIncludeNodeData)
+	{
+		if (InIndexEntry.RowName.Contains(SearchFilter.SearchString))
+		{
+			bContainsSearchString = true;
+			MakeChildTextNode
+			(
+				TreeGraphNode,
+				FText::FromString(InIndexEntry.RowName),
+				LOCTEXT("NodeDataRowKey", "Node Data"),
+				TEXT("Node Data")
+			);
+		}
+		if (InIndexEntry.TextTokens.Contains(SearchFilter.SearchString))
+		{
+			bContainsSearchString = true;
+			MakeChildTextNode
+			(
+				TreeGraphNode,
+				FText::FromString(InIndexEntry.TextTokens.Left(128)),
+				LOCTEXT("NodeDataTextKey", "Node Data Text"),
+				TEXT("Node Data Text")
+			);
+		}
+	}
+
+	// Search by GUID
+	if (SearchFilter.bIncludeNodeGUID)
+	{
+		const FString FoundGUID = InIndexEntry.NodeGuid.ToString();
+		if (FoundGUID.Contains(SearchFilter.SearchString))
+		{
+			bContainsSearchString = true;
+			MakeChildTextNode
+			(
+				TreeGraphNode,
+				FText::FromString(FoundGUID),
+				LOCTEXT("NodeGUID", "Node GUID"),
+				TEXT("Node GUID")
+			);
+		}
+	}
+
+	if (bContainsSearchString)
+	{
+		OutParentNode->AddChild(TreeGraphNode);
+	}
+
+	return bContainsSearchString;
+}
+
+bool FMounteaDialogueSearchManager::QueryAllDialogues(const FMounteaDialogueSearchFilter& SearchFilter, TSharedPtr<FMounteaDialogueSearchResult>& OutParentNode, const FSoftObjectPath& ExcludedDialogue) const
+{
+	if (SearchFilter.SearchString.IsEmpty() || !OutParentNode.IsValid())
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&SearchMapCriticalSection);
+
+	// Stable order of results, SearchMap is unordered
+	TArray<const FDialogueSearchData*> SortedSearchData;
+	SortedSearchData.Reserve(SearchMap.Num());
+	for (const auto& Itr : SearchMap)
+	{
+		if (Itr.Value.IndexEntries.Num() > 0 && Itr.Value.DialoguePath != ExcludedDialogue)
+		{
+			SortedSearchData.Add(&Itr.Value);
+		}
+	}
+	SortedSearchData.Sort([](const FDialogueSearchData& A, const FDialogueSearchData& B)
+	{
+		return A.DialoguePath.LexicalLess(B.DialoguePath);
+	});
+
+	bool bFoundInAnyDialogue = false;
+	for (const FDialogueSearchData* SearchData : SortedSearchData)
+	{
+		const TSharedPtr<FMounteaDialogueSearchResult_IndexedDialogueNode> TreeDialogueNode = MakeShared<FMounteaDialogueSearchResult_IndexedDialogueNode>
+		(
+			FText::FromString(SearchData->DialoguePath.ToString()), OutParentNode
+		);
+		TreeDialogueNode->SetDialoguePath(SearchData->DialoguePath);
+
+		bool bFoundInDialogue = false;
+		for (const FDialogueSearchIndexEntry& IndexEntry : SearchData->IndexEntries)
+		{
+			bFoundInDialogue = QueryIndexEntry(SearchFilter, SearchData->DialoguePath, IndexEntry, TreeDialogueNode) || bFoundInDialogue;
+		}
+
+		if (bFoundInDialogue)
+		{
+			OutParentNode->AddChild(TreeDialogueNode);
+			bFoundInAnyDialogue = true;
+		}
+	}
+
+	return bFoundInAnyDialogue;
+}
+
 void FMounteaDialogueSearchManager::Initialize(TSharedPtr<FWorkspaceItem> ParentTabCategory)
 {
 	// Must ensure we do not attempt to load the AssetRegistry Module while saving a package, however, if it is loaded already we can safely obtain it
@@ -248,6 +405,7 @@ void FMounteaDialogueSearchManager::Initialize(TSharedPtr<FWorkspaceItem> Parent
 	OnAssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &Self::HandleOnAssetAdded);
 	OnAssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &Self::HandleOnAssetRemoved);
 	OnAssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &Self::HandleOnAssetRenamed);
+	OnAssetUpdatedHandle = AssetRegistry->OnAssetUpdated().AddRaw(this, &Self::HandleOnAssetUpdated);
 
 	if (AssetRegistry->IsLoadingAssets())
 	{
@@ -285,6 +443,11 @@ void FMounteaDialogueSearchManager::UnInitialize()
 			AssetRegistry->OnAssetRenamed().Remove(OnAssetRenamedHandle);
 			OnAssetRenamedHandle.Reset();
 		}
+		if (OnAssetUpdatedHandle.IsValid())
+		{
+			AssetRegistry->OnAssetUpdated().Remove(OnAssetUpdatedHandle);
+			OnAssetUpdatedHandle.Reset();
+		}
 	}
 
 	if (OnAssetLoadedHandle.IsValid())
@@ -292,31 +455,241 @@ void FMounteaDialogueSearchManager::UnInitialize()
 		FCoreUObjectDelegates::OnAssetLoaded.Remove(OnAssetLoadedHandle);
 		OnAssetLoadedHandle.Reset();
 	}
+
+	// Background tasks reference this manager, they must finish before module shuts down
+	bCancelIndexing = true;
+	for (TFuture<void>& IndexTask : IndexTasks)
+	{
+		IndexTask.Wait();
+	}
+	IndexTasks.Empty();
+	bCancelIndexing = false;
+}
+
+void FMounteaDialogueSearchManager::IndexDialogues(const TArray<FAssetData>& InAssetsData)
+{
+	// Tags are read on Game Thread, parsing happens in background
+	TArray<TTuple<FName, FSoftObjectPath, FString, uint32>> SearchIndices;
+	SearchIndices.Reserve(InAssetsData.Num());
+	{
+		FScopeLock Lock(&SearchMapCriticalSection);
+		for (const FAssetData& AssetData : InAssetsData)
+		{
+			if (!IsDialogueAsset(AssetData))
+			{
+				continue;
+			}
+
+			FString SearchIndex;
+			if (!AssetData.GetTagValue(UMounteaDialogueGraph::GetSearchIndexTagName(), SearchIndex))
+			{
+				// Dialogues saved before Search Index existed have no Tag, generate it if Dialogue is loaded
+				if (const UObject* LoadedDialogue = AssetData.FastGetAsset(false))
+				{
+					FAssetData(LoadedDialogue).GetTagValue(UMounteaDialogueGraph::GetSearchIndexTagName(), SearchIndex);
+				}
+			}
+
+			const FSoftObjectPath DialoguePath = AssetData.GetSoftObjectPath();
+			const FName DialogueKey = FName(*DialoguePath.ToString());
+			const uint32 IndexRevision = ++NextIndexRevision;
+			IndexRevisions.Add(DialogueKey, IndexRevision);
+
+			SearchIndices.Emplace(DialogueKey, DialoguePath, MoveTemp(SearchIndex), IndexRevision);
+		}
+	}
+
+	if (SearchIndices.Num() == 0)
+	{
+		return;
+	}
+
+	IndexTasks.RemoveAll([](const TFuture<void>& IndexTask) { return IndexTask.IsReady(); });
+
+	++PendingIndexTasks;
+	IndexTasks.Add(Async(EAsyncExecution::ThreadPool, [this, SearchIndices = MoveTemp(SearchIndices)]()
+	{
+		TArray<TArray<FDialogueSearchIndexEntry>> ParsedIndices;
+		ParsedIndices.SetNum(SearchIndices.Num());
+		for (int32 Index = 0; Index < SearchIndices.Num(); Index++)
+		{
+			if (bCancelIndexing)
+			{
+				--PendingIndexTasks;
+				return;
+			}
+
+			ParseSearchIndex(SearchIndices[Index].Get<2>(), ParsedIndices[Index]);
+		}
+
+		{
+			FScopeLock Lock(&SearchMapCriticalSection);
+			for (int32 Index = 0; Index < SearchIndices.Num(); Index++)
+			{
+				const FName DialogueKey = SearchIndices[Index].Get<0>();
+
+				// Dialogue has been removed or indexed again in the meantime
+				const uint32* LatestRevision = IndexRevisions.Find(DialogueKey);
+				if (!LatestRevision || *LatestRevision != SearchIndices[Index].Get<3>())
+				{
+					continue;
+				}
+
+				FDialogueSearchData& SearchData = SearchMap.FindOrAdd(DialogueKey);
+				SearchData.DialoguePath = SearchIndices[Index].Get<1>();
+				SearchData.IndexEntries = MoveTemp(ParsedIndices[Index]);
+			}
+		}
+
+		--PendingIndexTasks;
+	}));
+}
+
+void FMounteaDialogueSearchManager::ParseSearchIndex(const FString& InSearchIndex, TArray<FDialogueSearchIndexEntry>& OutIndexEntries)
+{
+	OutIndexEntries.Reset();
+
+	TArray<FString> IndexLines;
+	InSearchIndex.ParseIntoArrayLines(IndexLines);
+	OutIndexEntries.Reserve(IndexLines.Num());
+
+	TArray<FString> IndexValues;
+	for (const FString& IndexLine : IndexLines)
+	{
+		// GUID, Title, Type, Row Name, Decorators, Text Tokens
+		IndexLine.ParseIntoArray(IndexValues, TEXT("\t"), false);
+		if (IndexValues.Num() < 6)
+		{
+			continue;
+		}
+
+		FDialogueSearchIndexEntry& IndexEntry = OutIndexEntries.AddDefaulted_GetRef();
+		FGuid::Parse(IndexValues[0], IndexEntry.NodeGuid);
+		IndexEntry.NodeTitle = MoveTemp(IndexValues[1]);
+		IndexEntry.NodeType = MoveTemp(IndexValues[2]);
+		IndexEntry.RowName = MoveTemp(IndexValues[3]);
+		IndexValues[4].ParseIntoArray(IndexEntry.DecoratorNames, TEXT(";"));
+		for (FString& DecoratorName : IndexEntry.DecoratorNames)
+		{
+			DecoratorName = FormatDecoratorName(DecoratorName);
+		}
+		IndexEntry.TextTokens = MoveTemp(IndexValues[5]);
+	}
+}
+
+bool FMounteaDialogueSearchManager::IsDialogueAsset(const FAssetData& InAssetData)
+{
+	return InAssetData.IsValid() && InAssetData.IsInstanceOf(UMounteaDialogueGraph::StaticClass());
+}
+
+FString FMounteaDialogueSearchManager::FormatDecoratorName(const FString& InDecoratorName)
+{
+	FString DecoratorName = InDecoratorName;
+	if (DecoratorName.Contains(TEXT("_GEN_VARIABLE")))
+	{
+		DecoratorName.ReplaceInline(TEXT("_GEN_VARIABLE"), TEXT(""));
+	}
+	if(DecoratorName.EndsWith(TEXT("_C")) && DecoratorName.StartsWith(TEXT("Default__")))
+	{
+		DecoratorName.RightChopInline(9);
+		DecoratorName.LeftChopInline(2);
+	}
+	if (DecoratorName.EndsWith(TEXT("_C")))
+	{
+		DecoratorName.LeftChopInline(2);
+	}
+	return DecoratorName;
 }
 
 void FMounteaDialogueSearchManager::HandleOnAssetAdded(const FAssetData& InAssetData)
 {
-	
+	// Initial scan is indexed in one batch once all files are loaded
+	if (AssetRegistry == nullptr || AssetRegistry->IsLoadingAssets())
+	{
+		return;
+	}
+
+	IndexDialogues({ InAssetData });
 }
 
 void FMounteaDialogueSearchManager::HandleOnAssetRemoved(const FAssetData& InAssetData)
 {
-	
+	if (!IsDialogueAsset(InAssetData))
+	{
+		return;
+	}
+
+	const FName DialogueKey = FName(*InAssetData.GetSoftObjectPath().ToString());
+
+	FScopeLock Lock(&SearchMapCriticalSection);
+	SearchMap.Remove(DialogueKey);
+	IndexRevisions.Remove(DialogueKey);
 }
 
 void FMounteaDialogueSearchManager::HandleOnAssetRenamed(const FAssetData& InAssetData, const FString& InOldName)
 {
-	
+	if (!IsDialogueAsset(InAssetData))
+	{
+		return;
+	}
+
+	{
+		const FName OldDialogueKey = FName(*InOldName);
+
+		FScopeLock Lock(&SearchMapCriticalSection);
+		SearchMap.Remove(OldDialogueKey);
+		IndexRevisions.Remove(OldDialogueKey);
+	}
+
+	IndexDialogues({ InAssetData });
+}
+
+void FMounteaDialogueSearchManager::HandleOnAssetUpdated(const FAssetData& InAssetData)
+{
+	// Tags are updated once Dialogue is saved
+	IndexDialogues({ InAssetData });
 }
 
 void FMounteaDialogueSearchManager::HandleOnAssetLoaded(UObject* InAsset)
 {
-	
+	UMounteaDialogueGraph* Dialogue = Cast<UMounteaDialogueGraph>(InAsset);
+	if (!IsValid(Dialogue))
+	{
+		return;
+	}
+
+	bool bHasSearchIndex = false;
+	{
+		FScopeLock Lock(&SearchMapCriticalSection);
+		FDialogueSearchData& SearchData = SearchMap.FindOrAdd(FName(*FSoftObjectPath(Dialogue).ToString()));
+		SearchData.Dialogue = Dialogue;
+		bHasSearchIndex = SearchData.IndexEntries.Num() > 0;
+	}
+
+	// Dialogues saved before Search Index existed have no Tag, index them once loaded
+	if (!bHasSearchIndex)
+	{
+		IndexDialogues({ FAssetData(Dialogue) });
+	}
 }
 
 void FMounteaDialogueSearchManager::HandleOnAssetRegistryFilesLoaded()
 {
-	
+	if (AssetRegistry == nullptr)
+	{
+		return;
+	}
+
+	if (OnFilesLoadedHandle.IsValid())
+	{
+		AssetRegistry->OnFilesLoaded().Remove(OnFilesLoadedHandle);
+		OnFilesLoadedHandle.Reset();
+	}
+
+	TArray<FAssetData> DialoguesData;
+	AssetRegistry->GetAssetsByClass(UMounteaDialogueGraph::StaticClass()->GetClassPathName(), DialoguesData, true);
+
+	IndexDialogues(DialoguesData);
 }
 
 
@@ -3,17 +3,37 @@
 #pragma once
 #include "MounteaDialogueSearchResult.h"
 #include "AssetRegistry/IAssetRegistry.h"
+#include "Async/Future.h"
 #include "Ed/EdNode_MounteaDialogueGraphNode.h"
 #include "Graph/MounteaDialogueGraph.h"
 
+#include <atomic>
+
 class SEdNode_MounteaDialogueGraphNode;
 class SMounteaDialogueSearch;
 struct FMounteaDialogueSearchFilter;
 class FMounteaDialogueSearchResult;
 
+/**
+ * Single Node of Search Index, parsed from 'MounteaDialogueSearchIndex' Asset Registry Tag.
+ */
+struct FDialogueSearchIndexEntry
+{
+	FGuid NodeGuid;
+	FString NodeTitle;
+	FString NodeType;
+	FString RowName;
+	TArray<FString> DecoratorNames;
+	// Row Title and Row Texts
+	FString TextTokens;
+};
+
 struct FDialogueSearchData
 {
 	TWeakObjectPtr<UMounteaDialogueGraph> Dialogue;
+
+	FSoftObjectPath DialoguePath;
+	TArray<FDialogueSearchIndexEntry> IndexEntries;
 };
 
 class FMounteaDialogueSearchManager
@@ -59,6 +79,33 @@ public:
 		TSharedPtr<FMounteaDialogueSearchResult>& OutParentNode
 	);
 	
+	/**
+	 * Searches for InSearchString in all indexed Dialogues, without loading them. Adds the results as children of OutParentNode.
+	 * Dialogue with ExcludedDialogue path is skipped, as it is expected to be searched live.
+	 * @return True if found anything matching the InSearchString
+	 */
+	bool QueryAllDialogues
+	(
+		const FMounteaDialogueSearchFilter& SearchFilter,
+		TSharedPtr<FMounteaDialogueSearchResult>& OutParentNode,
+		const FSoftObjectPath& ExcludedDialogue = FSoftObjectPath()
+	) const;
+
+	/**
+	 * Searches for InSearchString in the InIndexEntry. Adds the result as a child in OutParentNode.
+	 * @return True if found anything matching the InSearchString
+	 */
+	bool QueryIndexEntry
+	(
+		const FMounteaDialogueSearchFilter& SearchFilter,
+		const FSoftObjectPath& InDialoguePath,
+		const FDialogueSearchIndexEntry& InIndexEntry,
+		const TSharedPtr<FMounteaDialogueSearchResult>& OutParentNode
+	) const;
+
+	// Whether background indexing is still running
+	bool IsIndexing() const { return PendingIndexTasks.load() > 0; }
+	
 	void Initialize(TSharedPtr<FWorkspaceItem> ParentTabCategory = nullptr);
 	
 	void UnInitialize();
@@ -83,6 +130,17 @@ public:
 		return TextNode;
 	}
 	
+	// Reads Search Index Tags of given Dialogues and schedules parsing of them
+	void IndexDialogues(const TArray<FAssetData>& InAssetsData);
+
+	// Parses Search Index Tag value into Index Entries, safe to call from any thread
+	static void ParseSearchIndex(const FString& InSearchIndex, TArray<FDialogueSearchIndexEntry>& OutIndexEntries);
+
+	static bool IsDialogueAsset(const FAssetData& InAssetData);
+
+	// Strips Blueprint generated suffixes and prefixes from Decorator class name
+	static FString FormatDecoratorName(const FString& InDecoratorName);
+
 	// Callback hook from the Asset Registry when an asset is added
 	void HandleOnAssetAdded(const FAssetData& InAssetData);
 
@@ -92,6 +150,9 @@ public:
 	// Callback hook from the Asset Registry, marks the asset for deletion from the cache
 	void HandleOnAssetRenamed(const FAssetData& InAssetData, const FString& InOldName);
 
+	// Callback hook from the Asset Registry when an asset is saved and its tags are updated
+	void HandleOnAssetUpdated(const FAssetData& InAssetData);
+
 	// Callback hook from the Asset Registry when an asset is loaded
 	void HandleOnAssetLoaded(UObject* InAsset);
 
@@ -104,6 +165,19 @@ private:
 	// Maps the Dialogue path => SearchData.
 	TMap<FName, FDialogueSearchData> SearchMap;
 
+	// SearchMap is written from background indexing tasks
+	mutable FCriticalSection SearchMapCriticalSection;
+
+	// Latest indexing revision of each Dialogue, older background results are discarded
+	TMap<FName, uint32> IndexRevisions;
+	uint32 NextIndexRevision = 0;
+
+	std::atomic<int32> PendingIndexTasks = 0;
+
+	// In-flight background indexing, waited for in UnInitialize
+	TArray<TFuture<void>> IndexTasks;
+	std::atomic<bool> bCancelIndexing = false;
+
 	// Because we are unable to query for the module on another thread, cache it for use later
 	IAssetRegistry* AssetRegistry = nullptr;
 
@@ -111,6 +185,7 @@ private:
 	FDelegateHandle OnAssetAddedHandle;
 	FDelegateHandle OnAssetRemovedHandle;
 	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnAssetUpdatedHandle;
 	FDelegateHandle OnFilesLoadedHandle;
 	FDelegateHandle OnAssetLoadedHandle;
 };
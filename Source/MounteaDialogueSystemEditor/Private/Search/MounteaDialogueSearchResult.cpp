@@ -103,4 +103,28 @@ TSharedRef<SWidget> FMounteaDialogueSearchResult_GraphNode::CreateIcon() const
 
 #pragma endregion 
 
+#pragma region Search_Index
+
+FMounteaDialogueSearchResult_IndexedDialogueNode::FMounteaDialogueSearchResult_IndexedDialogueNode(const FText& InDisplayText, const TSharedPtr<FMounteaDialogueSearchResult>& InParent)
+: Super(InDisplayText, InParent)
+{
+	Category = LOCTEXT("MounteaDialogueSearchResult_IndexedDialogueNodeCategory", "Dialogue");
+}
+
+FReply FMounteaDialogueSearchResult_IndexedDialogueNode::OnClick(TWeakPtr<FAssetEditor_MounteaDialogueGraph> DialogueEditorPtr)
+{
+	return FMounteaDialogueGraphEditorUtilities::OpenEditorAndJumpToNodeGUID(DialoguePath, FGuid()) ? FReply::Handled() : FReply::Unhandled();
+}
+
+FMounteaDialogueSearchResult_IndexedGraphNode::FMounteaDialogueSearchResult_IndexedGraphNode(const FText& InDisplayText, const TSharedPtr<FMounteaDialogueSearchResult>& InParent)
+: Super(InDisplayText, InParent)
+{}
+
+FReply FMounteaDialogueSearchResult_IndexedGraphNode::OnClick(TWeakPtr<FAssetEditor_MounteaDialogueGraph> DialogueEditorPtr)
+{
+	return FMounteaDialogueGraphEditorUtilities::OpenEditorAndJumpToNodeGUID(DialoguePath, NodeGUID) ? FReply::Handled() : FReply::Unhandled();
+}
+
+#pragma endregion 
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -220,4 +220,38 @@ public:
 
 protected:
 	TWeakObjectPtr<const UEdNode_MounteaDialogueGraphNode> GraphNode;
+};
+
+// Tree Node result that represents indexed Dialogue, which is not necessarily loaded
+class FMounteaDialogueSearchResult_IndexedDialogueNode : public FMounteaDialogueSearchResult
+{
+	typedef FMounteaDialogueSearchResult Super;
+	
+public:
+	FMounteaDialogueSearchResult_IndexedDialogueNode(const FText& InDisplayText, const TSharedPtr<FMounteaDialogueSearchResult>& InParent);
+
+	virtual FReply OnClick(TWeakPtr<FAssetEditor_MounteaDialogueGraph> DialogueEditorPtr) override;
+	
+	void SetDialoguePath(const FSoftObjectPath& InDialoguePath) { DialoguePath = InDialoguePath; }
+	const FSoftObjectPath& GetDialoguePath() const { return DialoguePath; }
+
+protected:
+	FSoftObjectPath DialoguePath;
+};
+
+// Tree Node result that represents indexed Node, loads its Dialogue only when clicked
+class FMounteaDialogueSearchResult_IndexedGraphNode : public FMounteaDialogueSearchResult
+{
+	typedef FMounteaDialogueSearchResult Super;
+	
+public:
+	FMounteaDialogueSearchResult_IndexedGraphNode(const FText& InDisplayText, const TSharedPtr<FMounteaDialogueSearchResult>& InParent);
+
+	virtual FReply OnClick(TWeakPtr<FAssetEditor_MounteaDialogueGraph> DialogueEditorPtr) override;
+	
+	void SetNodeGUID(const FSoftObjectPath& InDialoguePath, const FGuid& InNodeGUID) { DialoguePath = InDialoguePath; NodeGUID = InNodeGUID; }
+
+protected:
+	FSoftObjectPath DialoguePath;
+	FGuid NodeGUID;
 };
\ No newline at end of file
@@ -145,7 +145,14 @@ void SMounteaDialogueSearch::MakeSearchQuery(const FMounteaDialogueSearchFilter&
 
 	if (DialogueEditorPtr.IsValid())
 	{
-		FMounteaDialogueSearchManager::Get()->QuerySingleDialogue(SearchFilter, DialogueEditorPtr.Pin()->GetEditingGraphSafe(), RootSearchResult);
+		UMounteaDialogueGraph* EditingDialogue = DialogueEditorPtr.Pin()->GetEditingGraphSafe();
+		FMounteaDialogueSearchManager::Get()->QuerySingleDialogue(SearchFilter, EditingDialogue, RootSearchResult);
+
+		// Edited Dialogue is searched live, as it might contain unsaved changes
+		if (SearchFilter.bSearchAllDialogues)
+		{
+			FMounteaDialogueSearchManager::Get()->QueryAllDialogues(SearchFilter, RootSearchResult, FSoftObjectPath(EditingDialogue));
+		}
 		
 		const TArray<TSharedPtr<FMounteaDialogueSearchResult>>& Children = RootSearchResult->GetChildren();
 		if (Children.Num() == 1 && Children[0].IsValid())
@@ -400,6 +407,27 @@ TSharedRef<SWidget> SMounteaDialogueSearch::FillFilterEntries()
 		NAME_None,
 		EUserInterfaceActionType::ToggleButton
 	);
+	MenuBuilder.AddMenuSeparator();
+	MenuBuilder.AddMenuEntry
+	(
+		LOCTEXT("SearchAllDialogues", "Search All Dialogues"),
+		LOCTEXT("SearchAllDialogues_ToolTip", "Search all Dialogues using Search Index, without loading them.\nDialogues are indexed when saved."),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateLambda([this]()
+			{
+				CurrentFilter.bSearchAllDialogues = !CurrentFilter.bSearchAllDialogues;
+				MakeSearchQuery(CurrentFilter);
+			}),
+			FCanExecuteAction(),
+			FIsActionChecked::CreateLambda([this]() -> bool
+			{
+				return CurrentFilter.bSearchAllDialogues;
+			})
+		),
+		NAME_None,
+		EUserInterfaceActionType::ToggleButton
+	);
 
 	return MenuBuilder.MakeWidget();
 }
@@ -127,6 +127,13 @@ protected:
 	UPROPERTY(config, EditDefaultsOnly, Category = "NodesSettings")
 	bool bAllowRenameNodes;
 
+	/**
+	 * Zoomed out Nodes are drawn as simple boxes with title only.
+	 * Decorators info and editable title are displayed once zoomed in, keeping large Graphs responsive.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "NodesSettings")
+	bool bSimplifyZoomedOutNodes = true;
+
 	/**
 	 * Select a Node Class and specify Override Colour for this Node type.
 	 * Only non-abstract classes are allowed!
@@ -179,6 +186,10 @@ protected:
 	UPROPERTY(config, EditDefaultsOnly, Category = "NodeWiring", meta=(ToolTip="[BETA] Feature]"))
 	bool bUseAdvancedWiring;
 
+	// Wires which are completely outside of the visible Graph area are not drawn.
+	UPROPERTY(config, EditDefaultsOnly, Category = "NodeWiring")
+	bool bCullOffscreenWires = true;
+
 	UPROPERTY(config, EditDefaultsOnly, AdvancedDisplay, Category = "NodeWiring", meta=(ToolTip="[BETA] Feature]", EditCondition="bUseAdvancedWiring"))
 	FVector2D AdvancedWiringConnectionTangent = FVector2D(0.0f, 350.f);
 
@@ -212,6 +223,47 @@ protected:
 
 #pragma endregion
 
+#pragma region Validation
+
+	/**
+	 * Whether Dialogue Graphs should be validated in background once edited or saved.
+	 * Only changed Nodes are validated again, results are posted to 'Mountea Dialogue Validation' Message Log.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Validation")
+	bool bBackgroundValidation = true;
+
+	// Delay after last change before background validation starts.
+	UPROPERTY(config, EditDefaultsOnly, Category = "Validation", meta=(EditCondition="bBackgroundValidation", UIMin=0.f, ClampMin=0.f, Units="Seconds"))
+	float BackgroundValidationDelay = 1.f;
+
+	// Maximum time background validation can take within one frame, remaining Nodes are validated next frame.
+	UPROPERTY(config, EditDefaultsOnly, AdvancedDisplay, Category = "Validation", meta=(EditCondition="bBackgroundValidation", UIMin=0.5f, ClampMin=0.5f, Units="Milliseconds"))
+	float BackgroundValidationBudget = 4.f;
+
+#pragma endregion
+
+#pragma region Import
+
+	/**
+	 * Reimport updates only Nodes, Dialogue Rows and audio files which changed since last import.
+	 * Unchanged assets are left untouched. Disable to always recreate the whole Dialogue.
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Import")
+	bool bIncrementalReimport = true;
+
+#pragma endregion
+
+#pragma region Export
+
+	/**
+	 * Compression level of exported '.mnteadlg' files.
+	 * 0 stores files without compression (fastest), 9 is the best compression (slowest).
+	 */
+	UPROPERTY(config, EditDefaultsOnly, Category = "Export", meta=(UIMin=0, ClampMin=0, UIMax=9, ClampMax=9))
+	int32 ExportCompressionLevel = 6;
+
+#pragma endregion
+
 #pragma region GameplayTags
 
 	/**
@@ -260,6 +312,9 @@ public:
 	bool AllowRenameNodes() const
 	{ return bAllowRenameNodes; };
 
+	bool SimplifyZoomedOutNodes() const
+	{ return bSimplifyZoomedOutNodes; };
+
 	bool FindNodeBackgroundColourOverride(const TSoftClassPtr<UMounteaDialogueGraphNode> NodeClass, FLinearColor& BackgroundColour)
 	{
 		if (OverrideNodeBackgroundColours.Contains(NodeClass))
@@ -297,6 +352,9 @@ public:
 	bool AllowAdvancedWiring() const
 	{ return bUseAdvancedWiring; };
 
+	bool CullOffscreenWires() const
+	{ return bCullOffscreenWires; };
+
 	FVector2D GetAdvancedWiringConnectionTangent() const
 	{ return AdvancedWiringConnectionTangent; };
 
@@ -337,6 +395,33 @@ public:
 	
 #pragma endregion
 
+#pragma region Validation_Getters
+
+	bool AllowBackgroundValidation() const
+	{ return bBackgroundValidation; };
+
+	float GetBackgroundValidationDelay() const
+	{ return BackgroundValidationDelay; };
+
+	float GetBackgroundValidationBudget() const
+	{ return BackgroundValidationBudget; };
+
+#pragma endregion
+
+#pragma region Import_Getters
+
+	bool AllowIncrementalReimport() const
+	{ return bIncrementalReimport; };
+
+#pragma endregion
+
+#pragma region Export_Getters
+
+	int32 GetExportCompressionLevel() const
+	{ return ExportCompressionLevel; };
+
+#pragma endregion
+
 #pragma region GameplayTags_Getters
 
 	bool AllowCheckTagUpdate() const
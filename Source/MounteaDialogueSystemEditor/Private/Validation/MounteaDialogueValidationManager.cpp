@@ -0,0 +1,283 @@
+// Copyright Dominik Pavlicek 2023. All Rights Reserved.
+
+#include "MounteaDialogueValidationManager.h"
+
+#include "Graph/MounteaDialogueGraph.h"
+#include "Helpers/MounteaDialogueGraphEditorHelpers.h"
+#include "Logging/MessageLog.h"
+#include "MessageLogInitializationOptions.h"
+#include "MessageLogModule.h"
+#include "Misc/DataValidation.h"
+#include "Misc/UObjectToken.h"
+#include "Settings/MounteaDialogueGraphEditorSettings.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+#define LOCTEXT_NAMESPACE "MounteaDialogueValidationManager"
+
+FMounteaDialogueValidationManager* FMounteaDialogueValidationManager::Instance = nullptr;
+
+FMounteaDialogueValidationManager* FMounteaDialogueValidationManager::Get()
+{
+	if (Instance == nullptr)
+	{
+		Instance = new Self();
+	}
+
+	return Instance;
+}
+
+FMounteaDialogueValidationManager::FMounteaDialogueValidationManager()
+{}
+
+FMounteaDialogueValidationManager::~FMounteaDialogueValidationManager()
+{
+	UnInitialize();
+}
+
+void FMounteaDialogueValidationManager::Initialize()
+{
+	FMessageLogModule& MessageLogModule = FModuleManager::LoadModuleChecked<FMessageLogModule>("MessageLog");
+	if (!MessageLogModule.IsRegisteredLogListing(GetMessageLogName()))
+	{
+		FMessageLogInitializationOptions InitOptions;
+		InitOptions.bShowPages = true;
+		InitOptions.bShowFilters = true;
+		MessageLogModule.RegisterLogListing(GetMessageLogName(), LOCTEXT("MounteaDialogueValidationLog", "Mountea Dialogue Validation"), InitOptions);
+	}
+
+	OnPackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &Self::HandleOnPackageSaved);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &Self::Tick));
+}
+
+void FMounteaDialogueValidationManager::UnInitialize()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (OnPackageSavedHandle.IsValid())
+	{
+		UPackage::PackageSavedWithContextEvent.Remove(OnPackageSavedHandle);
+		OnPackageSavedHandle.Reset();
+	}
+
+	if (FModuleManager::Get().IsModuleLoaded("MessageLog"))
+	{
+		FMessageLogModule& MessageLogModule = FModuleManager::GetModuleChecked<FMessageLogModule>("MessageLog");
+		if (MessageLogModule.IsRegisteredLogListing(GetMessageLogName()))
+		{
+			MessageLogModule.UnregisterLogListing(GetMessageLogName());
+		}
+	}
+
+	PendingRequests.Empty();
+	ActiveJobs.Empty();
+}
+
+void FMounteaDialogueValidationManager::RequestValidation(UMounteaDialogueGraph* InDialogue, const bool bImmediate)
+{
+	const UMounteaDialogueGraphEditorSettings* EditorSettings = GetDefault<UMounteaDialogueGraphEditorSettings>();
+	if (!IsValid(InDialogue) || !EditorSettings || !EditorSettings->AllowBackgroundValidation())
+	{
+		return;
+	}
+
+	FDialogueValidationRequest& Request = PendingRequests.FindOrAdd(InDialogue);
+	Request.StartTime = FPlatformTime::Seconds() + (bImmediate ? 0.0 : EditorSettings->GetBackgroundValidationDelay());
+	Request.bNotify |= bImmediate;
+}
+
+void FMounteaDialogueValidationManager::CancelValidation(const UMounteaDialogueGraph* InDialogue)
+{
+	PendingRequests.Remove(InDialogue);
+	ActiveJobs.RemoveAll([InDialogue](const FDialogueValidationJob& Job)
+	{
+		return Job.Dialogue.Get() == InDialogue;
+	});
+}
+
+bool FMounteaDialogueValidationManager::Tick(float DeltaTime)
+{
+	if (PendingRequests.Num() == 0 && ActiveJobs.Num() == 0)
+	{
+		return true;
+	}
+
+	// Validation might call Blueprint code, which is not allowed while saving or collecting garbage
+	if (UE::IsSavingPackages() || IsGarbageCollecting())
+	{
+		return true;
+	}
+	
+	const UMounteaDialogueGraphEditorSettings* EditorSettings = GetDefault<UMounteaDialogueGraphEditorSettings>();
+	if (!EditorSettings || !EditorSettings->AllowBackgroundValidation())
+	{
+		PendingRequests.Empty();
+		ActiveJobs.Empty();
+		return true;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (auto RequestItr = PendingRequests.CreateIterator(); RequestItr; ++RequestItr)
+	{
+		if (!RequestItr.Key().IsValid())
+		{
+			RequestItr.RemoveCurrent();
+			continue;
+		}
+
+		if (RequestItr.Value().StartTime <= CurrentTime)
+		{
+			StartJob(RequestItr.Key().Get(), RequestItr.Value().bNotify);
+			RequestItr.RemoveCurrent();
+		}
+	}
+
+	const double BudgetEndTime = CurrentTime + EditorSettings->GetBackgroundValidationBudget() / 1000.0;
+	while (ActiveJobs.Num() > 0 && FPlatformTime::Seconds() < BudgetEndTime)
+	{
+		FDialogueValidationJob& ActiveJob = ActiveJobs[0];
+
+		const double NodeStartTime = FPlatformTime::Seconds();
+		const bool bHasMoreNodes = ProcessJob(ActiveJob);
+		ActiveJob.ValidationTime += FPlatformTime::Seconds() - NodeStartTime;
+		
+		if (!bHasMoreNodes)
+		{
+			FinishJob(ActiveJob);
+			ActiveJobs.RemoveAt(0);
+		}
+	}
+
+	return true;
+}
+
+void FMounteaDialogueValidationManager::StartJob(UMounteaDialogueGraph* InDialogue, const bool bNotify)
+{
+	// Dialogue has changed since running validation started
+	ActiveJobs.RemoveAll([InDialogue](const FDialogueValidationJob& Job)
+	{
+		return Job.Dialogue.Get() == InDialogue;
+	});
+
+	FDialogueValidationJob& NewJob = ActiveJobs.AddDefaulted_GetRef();
+	NewJob.Dialogue = InDialogue;
+	NewJob.StartTime = FPlatformTime::Seconds();
+	NewJob.bNotify = bNotify;
+
+	NewJob.Nodes.Reserve(InDialogue->AllNodes.Num());
+	for (UMounteaDialogueGraphNode* Node : InDialogue->AllNodes)
+	{
+		if (Node)
+		{
+			NewJob.Nodes.Add(Node);
+		}
+	}
+}
+
+bool FMounteaDialogueValidationManager::ProcessJob(FDialogueValidationJob& InJob) const
+{
+	const UMounteaDialogueGraph* Dialogue = InJob.Dialogue.Get();
+	if (!Dialogue || !InJob.Nodes.IsValidIndex(InJob.NextNodeIndex))
+	{
+		return false;
+	}
+
+	const UMounteaDialogueGraphNode* Node = InJob.Nodes[InJob.NextNodeIndex++].Get();
+	if (Node)
+	{
+		FDataValidationContext NodeContext;
+		bool bCacheHit = false;
+		
+		InJob.bIsValid &= Dialogue->ValidateNodeCached(Node, NodeContext, false, bCacheHit);
+		NodeContext.SplitIssues(InJob.Warnings, InJob.Errors);
+
+		if (bCacheHit)
+		{
+			InJob.CachedNodes++;
+		}
+		else
+		{
+			InJob.ValidatedNodes++;
+		}
+	}
+
+	return InJob.Nodes.IsValidIndex(InJob.NextNodeIndex);
+}
+
+void FMounteaDialogueValidationManager::FinishJob(const FDialogueValidationJob& InJob) const
+{
+	UMounteaDialogueGraph* Dialogue = InJob.Dialogue.Get();
+	if (!Dialogue)
+	{
+		return;
+	}
+
+	// Graph scoped validation is cheap, no need to slice it
+	FDataValidationContext GraphContext;
+	const bool bIsValid = Dialogue->ValidateGraphScope(GraphContext, false) && InJob.bIsValid;
+
+	TArray<FText> Errors, Warnings;
+	GraphContext.SplitIssues(Warnings, Errors);
+	Errors.Append(InJob.Errors);
+	Warnings.Append(InJob.Warnings);
+
+	UE_LOG(LogMounteaDialogueSystemEditor, Verbose, TEXT("[FinishJob] %s validated: %d Nodes validated, %d Nodes cached, took %.2f ms"), *Dialogue->GetName(), InJob.ValidatedNodes, InJob.CachedNodes, InJob.ValidationTime * 1000.0);
+
+	// Debounced validation runs after every edit, valid result is only reported when validation was requested explicitly
+	const bool bHasIssues = !bIsValid || Errors.Num() > 0 || Warnings.Num() > 0;
+	if (!bHasIssues && !InJob.bNotify)
+	{
+		return;
+	}
+
+	FMessageLog ValidationLog(GetMessageLogName());
+	ValidationLog.NewPage(FText::Format(LOCTEXT("ValidationPage", "{0} ({1})"), FText::FromString(Dialogue->GetName()), FText::AsTime(FDateTime::Now())));
+
+	for (const FText& Error : Errors)
+	{
+		ValidationLog.Error()
+			->AddToken(FUObjectToken::Create(Dialogue))
+			->AddToken(FTextToken::Create(Error));
+	}
+	for (const FText& Warning : Warnings)
+	{
+		ValidationLog.Warning()
+			->AddToken(FUObjectToken::Create(Dialogue))
+			->AddToken(FTextToken::Create(Warning));
+	}
+
+	if (bIsValid && Errors.Num() == 0)
+	{
+		ValidationLog.Info()
+			->AddToken(FUObjectToken::Create(Dialogue))
+			->AddToken(FTextToken::Create(LOCTEXT("DialogueValid", "Dialogue is valid.")));
+	}
+	else if (InJob.bNotify)
+	{
+		ValidationLog.Notify(FText::Format(LOCTEXT("DialogueInvalid", "{0} has {1} validation error(s)."), FText::FromString(Dialogue->GetName()), Errors.Num()), EMessageSeverity::Error);
+	}
+}
+
+void FMounteaDialogueValidationManager::HandleOnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (!Package || ObjectSaveContext.IsProceduralSave())
+	{
+		return;
+	}
+
+	ForEachObjectWithPackage(Package, [this](UObject* Object)
+	{
+		if (UMounteaDialogueGraph* Dialogue = Cast<UMounteaDialogueGraph>(Object))
+		{
+			RequestValidation(Dialogue, true);
+		}
+		return true;
+	}, false);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,102 @@
+// Copyright Dominik Pavlicek 2023. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+
+struct FDialogueValidationRequest
+{
+	// Earliest time validation can start
+	double StartTime = 0.0;
+	// Whether Message Log should be opened if Dialogue is invalid
+	bool bNotify = false;
+};
+
+/**
+ * Single Dialogue being validated in background.
+ * Nodes are captured once the job starts, Nodes added later are validated by next job.
+ */
+struct FDialogueValidationJob
+{
+	TWeakObjectPtr<UMounteaDialogueGraph> Dialogue;
+	TArray<TWeakObjectPtr<UMounteaDialogueGraphNode>> Nodes;
+	int32 NextNodeIndex = 0;
+
+	TArray<FText> Errors;
+	TArray<FText> Warnings;
+	bool bIsValid = true;
+
+	int32 ValidatedNodes = 0;
+	int32 CachedNodes = 0;
+	double StartTime = 0.0;
+	// Time actually spent validating, without frames in between
+	double ValidationTime = 0.0;
+	bool bNotify = false;
+};
+
+/**
+ * Validates Dialogues in background once they are edited or saved.
+ * 
+ * Validation runs on Game Thread, as Nodes and Decorators might be Blueprints and query Data Tables,
+ * but it is time-sliced by 'Background Validation Budget' so editing and saving never waits for it.
+ * Only Nodes whose Validation Hash changed are validated again, results of other Nodes are taken from Dialogue cache.
+ * Results are posted to 'Mountea Dialogue Validation' Message Log.
+ */
+class FMounteaDialogueValidationManager
+{
+private:
+	typedef FMounteaDialogueValidationManager Self;
+
+public:
+	static Self* Get();
+
+	static FName GetMessageLogName()
+	{ return FName(TEXT("MounteaDialogueValidation")); };
+
+public:
+	FMounteaDialogueValidationManager();
+	~FMounteaDialogueValidationManager();
+
+	void Initialize();
+	void UnInitialize();
+
+	/**
+	 * Schedules background validation of given Dialogue.
+	 * Requests within 'Background Validation Delay' are merged, running validation of the same Dialogue is restarted.
+	 * 
+	 * @param InDialogue	Dialogue to validate.
+	 * @param bImmediate	Whether to skip delay, used once Dialogue is saved.
+	 */
+	void RequestValidation(UMounteaDialogueGraph* InDialogue, const bool bImmediate = false);
+
+	void CancelValidation(const UMounteaDialogueGraph* InDialogue);
+
+	bool IsValidating() const
+	{ return ActiveJobs.Num() > 0 || PendingRequests.Num() > 0; };
+
+private:
+
+	bool Tick(float DeltaTime);
+
+	void StartJob(UMounteaDialogueGraph* InDialogue, const bool bNotify);
+	void FinishJob(const FDialogueValidationJob& InJob) const;
+
+	// Validates next Node of the Job, returns false once there is nothing left to validate
+	bool ProcessJob(FDialogueValidationJob& InJob) const;
+
+	void HandleOnPackageSaved(const FString& PackageFileName, UPackage* Package, class FObjectPostSaveContext ObjectSaveContext);
+
+private:
+	static Self* Instance;
+
+	TMap<TWeakObjectPtr<UMounteaDialogueGraph>, FDialogueValidationRequest> PendingRequests;
+
+	TArray<FDialogueValidationJob> ActiveJobs;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle OnPackageSavedHandle;
+};
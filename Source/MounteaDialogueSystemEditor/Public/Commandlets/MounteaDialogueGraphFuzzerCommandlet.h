@@ -0,0 +1,124 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MounteaDialogueGraphFuzzerCommandlet.generated.h"
+
+class UMounteaDialogueDecoratorBase;
+class UMounteaDialogueGraph;
+class UMounteaDialogueGraphNode;
+
+/**
+ * Decides outcome of Decorator while Graph is fuzzed.
+ * Decorators cannot be evaluated without World and Participants, so each Decorator class is resolved to a Stub instead.
+ */
+using FMounteaDialogueFuzzerDecoratorStub = TFunction<bool(const UMounteaDialogueDecoratorBase* Decorator, FRandomStream& RandomStream)>;
+
+/**
+ * Statistics of single walked path.
+ */
+struct FMounteaDialogueFuzzerPath
+{
+	// Indexes of visited Nodes in order
+	TArray<int32> Nodes;
+
+	// Sum of declared Evaluation costs of all evaluated Decorators
+	int64 EvaluationCost = 0;
+	int32 Evaluations = 0;
+
+	// How many times was already visited Node visited again
+	int32 LoopCount = 0;
+
+	// Highest number of allowed Child Nodes at any step
+	int32 MaxAllowedChildren = 0;
+
+	// Dialogue Row Data visited along the path
+	int32 RowsVisited = 0;
+
+	// Path was cut by step or loop limit instead of reaching Node without allowed children
+	bool bTruncated = false;
+};
+
+/**
+ * UMounteaDialogueGraphFuzzerCommandlet
+ *
+ * Walks all branches of Dialogue Graphs without World and reports paths which are much more expensive than the rest.
+ * Decorators are replaced by Stubs, default Stub can be overridden per Decorator class from command line or by 'RegisterDecoratorStub'.
+ *
+ * Usage:
+ * UnrealEditor-Cmd <Project> -run=MounteaDialogueGraphFuzzer -nullrhi [Options]
+ *
+ * Options:
+ * -Path=/Game/Dialogues		Only Graphs under this path are fuzzed
+ * -Mode=Exhaustive|Random		Exhaustive walks every branch, Random walks '-Walks' random paths (default Exhaustive)
+ * -Walks=1000					Number of random walks per Graph
+ * -MaxSteps=256				Maximum Nodes visited per path
+ * -MaxLoops=2					How many times single Node can be revisited per path
+ * -MaxPaths=10000				Maximum paths explored per Graph
+ * -Seed=0						Seed of random walks and Random Stubs
+ * -Decorators=Pass|Fail|Random	Default Stub of all Decorators (default Pass)
+ * -PassChance=0.5				Chance of Random Stub to pass
+ * -DecoratorStubs=ClassA:Fail,ClassB:Random	Stubs of specific Decorator classes
+ * -CliffFactor=4				Path is a cost cliff if it is this many times more expensive than median path
+ * -Report=Path.csv				Writes statistics of all paths to CSV file
+ * -FailOnCliff					Returns error if any cost cliff was found
+ */
+UCLASS()
+class MOUNTEADIALOGUESYSTEMEDITOR_API UMounteaDialogueGraphFuzzerCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaDialogueGraphFuzzerCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/**
+	 * Registers Stub used for given Decorator class and its children, unless more specific Stub is registered.
+	 * Stubs from command line take precedence.
+	 */
+	static void RegisterDecoratorStub(const UClass* DecoratorClass, FMounteaDialogueFuzzerDecoratorStub Stub);
+	static void UnregisterDecoratorStub(const UClass* DecoratorClass);
+
+protected:
+
+	void ParseOptions(const FString& Params);
+	bool FuzzGraph(const UMounteaDialogueGraph* Graph);
+
+	void WalkExhaustive(const UMounteaDialogueGraphNode* Node, FMounteaDialogueFuzzerPath& Path, TMap<const UMounteaDialogueGraphNode*, int32>& VisitCounts, TArray<FMounteaDialogueFuzzerPath>& OutPaths);
+	void WalkRandom(const UMounteaDialogueGraphNode* StartNode, TArray<FMounteaDialogueFuzzerPath>& OutPaths);
+
+	/**
+	 * Visits Node, updates Path and returns Nodes which can follow it.
+	 * Returns false if Path has to stop at this Node.
+	 */
+	bool VisitNode(const UMounteaDialogueGraphNode* Node, FMounteaDialogueFuzzerPath& Path, TMap<const UMounteaDialogueGraphNode*, int32>& VisitCounts, TArray<const UMounteaDialogueGraphNode*>& OutNextNodes);
+	bool EvaluateChildNode(const UMounteaDialogueGraphNode* ChildNode, FMounteaDialogueFuzzerPath& Path);
+	const FMounteaDialogueFuzzerDecoratorStub& FindDecoratorStub(const UMounteaDialogueDecoratorBase* Decorator) const;
+
+	void ReportGraph(const UMounteaDialogueGraph* Graph, TArray<FMounteaDialogueFuzzerPath>& Paths);
+
+protected:
+
+	static TMap<const UClass*, FMounteaDialogueFuzzerDecoratorStub>& GetRegisteredStubs();
+
+	TMap<const UClass*, FMounteaDialogueFuzzerDecoratorStub> CommandLineStubs;
+	FMounteaDialogueFuzzerDecoratorStub DefaultStub;
+
+	FRandomStream RandomStream;
+
+	FString PathFilter;
+	bool bExhaustive = true;
+	int32 Walks = 1000;
+	int32 MaxSteps = 256;
+	int32 MaxLoops = 2;
+	int32 MaxPaths = 10000;
+	float CliffFactor = 4.f;
+	bool bFailOnCliff = false;
+
+	int32 CliffsFound = 0;
+	TArray<FString> ReportLines;
+};